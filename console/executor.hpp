@@ -19,11 +19,16 @@
 #ifndef LIBBITCOIN_BS_EXECUTOR_HPP
 #define LIBBITCOIN_BS_EXECUTOR_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <functional>
 #include <future>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 #include <bitcoin/server.hpp>
 
 namespace libbitcoin {
@@ -91,6 +96,46 @@ private:
     void scan_slabs() const;
     void scan_buckets() const;
     void scan_collisions() const;
+    size_t scan_threads() const;
+
+    // Invoke shard(index, first, last) for each shard of [0, count) on its
+    // own thread, returning once all are joined (index is less than threads).
+    template <typename Shard>
+    static void parallel(size_t threads, size_t count, const Shard& shard)
+    {
+        const auto shards = std::max(one, std::min(threads, count));
+        const auto width = system::ceilinged_divide(count, shards);
+        std::vector<std::thread> workers{};
+        workers.reserve(shards);
+        for (size_t index{}; index < shards; ++index)
+        {
+            const auto first = std::min(count, index * width);
+            workers.emplace_back(shard, index, first,
+                std::min(count, first + width));
+        }
+
+        for (auto& worker: workers)
+            worker.join();
+    }
+
+    // Benchmarks (sample(index, items) times one operation, false is fail).
+    using bench_sample = std::function<bool(size_t index, size_t& items)>;
+    using bench_factory = bench_sample(executor::*)(size_t samples) const;
+    struct bench_workload
+    {
+        std::string description;
+        bench_factory factory;
+    };
+
+    void run_bench(const std::string& name) const;
+    size_t bench_threads() const;
+    static std::vector<size_t> bench_indexes(size_t samples, size_t limit);
+    bench_sample bench_address(size_t samples) const;
+    bench_sample bench_wire_size(size_t samples) const;
+    bench_sample bench_tx(size_t samples) const;
+    bench_sample bench_headers(size_t samples) const;
+    bench_sample bench_history(size_t samples) const;
+    bench_sample bench_filter(size_t samples) const;
 
     // Command line (defaults to do_run).
     bool do_help();
@@ -106,6 +151,7 @@ private:
     bool do_slabs();
     bool do_buckets();
     bool do_collisions();
+    bool do_bench();
     bool do_get(const system::hash_digest& hash);
     bool do_put(const system::hash_digest& hash);
 
@@ -154,8 +200,8 @@ private:
     static const std::unordered_map<uint8_t, std::string> toggles_menu_;
     static const std::unordered_map<uint8_t, bool> defined_;
 
-    // Runtime events.
-    static const std::unordered_map<uint8_t, std::string> fired_;
+    // Named benchmark workloads.
+    static const std::map<std::string, bench_workload> benches_;
 
     parser& metadata_;
     server_node::ptr node_{};
@@ -165,6 +211,7 @@ private:
 
     std::istream& input_;
     std::ostream& output_;
+    mutable std::mutex output_mutex_{};
     network::logger log_{};
     network::capture capture_{ input_, close_ };
     std_array<std::atomic_bool, add1(network::levels::verbose)> toggle_;
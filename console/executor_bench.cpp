@@ -0,0 +1,366 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "executor.hpp"
+#include "localize.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <vector>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace network;
+using namespace system;
+using format = boost_format;
+
+// Benchmarks.
+// ----------------------------------------------------------------------------
+// Each workload selects its sample keys from the store before timing (with
+// a fixed seed, so runs over the same store are comparable). Samples are
+// then sharded across threads and each is timed individually. Per-shard
+// latencies are merged and reported as percentiles, with the count of
+// items (rows or bytes) read by successful samples.
+
+// Header range read width (a p2p headers message).
+constexpr size_t header_range = 2'000;
+
+// Queries are not canceled within a sample.
+static const std::atomic_bool uncanceled{ false };
+
+const std::map<std::string, executor::bench_workload> executor::benches_
+{
+    { "address", { "address index conflict walk (rows)",
+        &executor::bench_address } },
+    { "filter", { "compact filter read (bytes)",
+        &executor::bench_filter } },
+    { "headers", { "confirmed header range read (headers)",
+        &executor::bench_headers } },
+    { "history", { "address history walk (rows)",
+        &executor::bench_history } },
+    { "tx", { "random transaction lookup (bytes)",
+        &executor::bench_tx } },
+    { "wire_size", { "block wire size sweep (bytes)",
+        &executor::bench_wire_size } }
+};
+
+size_t executor::bench_threads() const
+{
+    const auto threads = metadata_.configured.bench_threads;
+    return is_zero(threads) ? std::max(one,
+        size_t{ std::thread::hardware_concurrency() }) : threads;
+}
+
+// Uniformly distributed indexes in [0, limit), empty if limit is zero.
+std::vector<size_t> executor::bench_indexes(size_t samples, size_t limit)
+{
+    std::vector<size_t> indexes{};
+    if (is_zero(limit))
+        return indexes;
+
+    std::mt19937_64 engine{ 42u };
+    std::uniform_int_distribution<size_t> distribution{ zero, sub1(limit) };
+    indexes.resize(samples);
+    for (auto& index: indexes)
+        index = distribution(engine);
+
+    return indexes;
+}
+
+// Address keys are the script hashes of the first output of random txs.
+static std::vector<hash_digest> address_keys(const server_node::query& query,
+    const std::vector<size_t>& indexes)
+{
+    using namespace database;
+    std::vector<hash_digest> keys{};
+    keys.reserve(indexes.size());
+    for (const auto index: indexes)
+    {
+        const tx_link link{ possible_narrow_cast<tx_link::integer>(index) };
+        const auto outputs = query.get_outputs(link);
+        if (is_null(outputs) || outputs->empty())
+            return {};
+
+        keys.push_back(outputs->front()->script().hash());
+    }
+
+    return keys;
+}
+
+executor::bench_sample executor::bench_address(size_t samples) const
+{
+    if (!query_.address_enabled())
+    {
+        logger(format(BS_BENCH_DISABLED) % "address" % "address");
+        return {};
+    }
+
+    const auto indexes = bench_indexes(samples, query_.tx_records());
+    const auto keys = address_keys(query_, indexes);
+    if (keys.empty())
+        return {};
+
+    return [this, keys](size_t index, size_t& items)
+    {
+        database::output_links out{};
+        if (query_.to_address_outputs(out, keys.at(index)))
+            return false;
+
+        items = out.size();
+        return true;
+    };
+}
+
+executor::bench_sample executor::bench_history(size_t samples) const
+{
+    if (!query_.address_enabled())
+    {
+        logger(format(BS_BENCH_DISABLED) % "history" % "address");
+        return {};
+    }
+
+    const auto indexes = bench_indexes(samples, query_.tx_records());
+    const auto keys = address_keys(query_, indexes);
+    if (keys.empty())
+        return {};
+
+    // Turbo is disabled, concurrency is provided by bench_threads.
+    return [this, keys](size_t index, size_t& items)
+    {
+        database::histories histories{};
+        database::height_link cursor{};
+        if (query_.get_history(uncanceled, cursor, histories, keys.at(index),
+            max_size_t, false))
+            return false;
+
+        items = histories.size();
+        return true;
+    };
+}
+
+executor::bench_sample executor::bench_tx(size_t samples) const
+{
+    const auto indexes = bench_indexes(samples, query_.tx_records());
+    if (indexes.empty())
+        return {};
+
+    return [this, indexes](size_t index, size_t& items)
+    {
+        using namespace database;
+        const auto value = indexes.at(index);
+        const tx_link link{ possible_narrow_cast<tx_link::integer>(value) };
+        const auto tx = query_.get_transaction(link, true);
+        if (!tx)
+            return false;
+
+        items = tx->serialized_size(true);
+        return true;
+    };
+}
+
+executor::bench_sample executor::bench_headers(size_t samples) const
+{
+    const auto top = query_.get_top_confirmed();
+    const auto indexes = bench_indexes(samples, add1(top));
+    if (indexes.empty())
+        return {};
+
+    return [this, top, indexes](size_t index, size_t& items)
+    {
+        const auto start = indexes.at(index);
+        const auto stop = std::min(add1(top), start + header_range);
+        for (auto height = start; height < stop; ++height)
+            if (!query_.get_header(query_.to_confirmed(height)))
+                return false;
+
+        items = stop - start;
+        return true;
+    };
+}
+
+executor::bench_sample executor::bench_wire_size(size_t samples) const
+{
+    const auto top = query_.get_top_confirmed();
+    const auto indexes = bench_indexes(samples, add1(top));
+    if (indexes.empty())
+        return {};
+
+    return [this, indexes](size_t index, size_t& items)
+    {
+        const auto link = query_.to_confirmed(indexes.at(index));
+        return query_.get_block_size(items, link, true);
+    };
+}
+
+executor::bench_sample executor::bench_filter(size_t samples) const
+{
+    if (!query_.filter_enabled())
+    {
+        logger(format(BS_BENCH_DISABLED) % "filter" % "filter");
+        return {};
+    }
+
+    const auto top = query_.get_top_confirmed();
+    const auto indexes = bench_indexes(samples, add1(top));
+    if (indexes.empty())
+        return {};
+
+    return [this, indexes](size_t index, size_t& items)
+    {
+        data_chunk filter{};
+        const auto link = query_.to_confirmed(indexes.at(index));
+        if (!query_.get_filter_body(filter, link))
+            return false;
+
+        items = filter.size();
+        return true;
+    };
+}
+
+void executor::run_bench(const std::string& name) const
+{
+    const auto& config = metadata_.configured;
+    const auto& output = config.bench_format;
+    if (output != "text" && output != "json" && output != "csv")
+    {
+        logger(format(BS_BENCH_FORMAT) % output);
+        return;
+    }
+
+    if (name == "list")
+    {
+        for (const auto& bench: benches_)
+            logger(format(BS_BENCH_LIST) % bench.first %
+                bench.second.description);
+
+        return;
+    }
+
+    if (name != "all" && !benches_.contains(name))
+    {
+        logger(format(BS_BENCH_UNKNOWN) % name);
+        return;
+    }
+
+    const auto threads = bench_threads();
+    const auto samples = config.bench_samples;
+    if (output == "csv")
+        logger(BS_BENCH_CSV_HEADER);
+
+    for (const auto& bench: benches_)
+    {
+        if (canceled())
+            break;
+
+        if (name != "all" && name != bench.first)
+            continue;
+
+        const auto sample = (this->*bench.second.factory)(samples);
+        if (!sample)
+        {
+            logger(format(BS_BENCH_EMPTY) % bench.first);
+            continue;
+        }
+
+        // Progress would corrupt machine-readable output.
+        if (output == "text")
+            logger(format(BS_BENCH_PREPARE) % bench.first % samples %
+                threads);
+
+        // Each shard records into its own latencies and totals.
+        struct totals
+        {
+            size_t failed{};
+            size_t items{};
+        };
+
+        // Samples not run (canceled) retain the sentinel.
+        constexpr auto unrun = max_uint64;
+        std::vector<uint64_t> latencies(samples, unrun);
+        std::vector<totals> partials(std::max(one, std::min(threads,
+            samples)));
+
+        const auto start = fine_clock::now();
+        parallel(threads, samples, [&](size_t shard, size_t first,
+            size_t last)
+        {
+            auto& total = partials.at(shard);
+            for (auto index = first; !canceled() && index < last; ++index)
+            {
+                size_t items{};
+                const auto begin = fine_clock::now();
+                const auto success = sample(index, items);
+                const auto span = fine_clock::now() - begin;
+                latencies.at(index) = duration_cast<nanoseconds>(span).count();
+                if (success)
+                    total.items += items;
+                else
+                    ++total.failed;
+            }
+        });
+
+        const auto span = duration_cast<microseconds>(fine_clock::now() -
+            start);
+
+        totals total{};
+        for (const auto& partial: partials)
+        {
+            total.failed += partial.failed;
+            total.items += partial.items;
+        }
+
+        // Only completed samples contribute to the percentiles and rate.
+        std::erase(latencies, unrun);
+        const auto completed = latencies.size();
+
+        // Percentiles by nearest rank, in microseconds.
+        std::sort(latencies.begin(), latencies.end());
+        const auto rank = [&](double percentile)
+        {
+            if (latencies.empty())
+                return 0.0;
+
+            const auto size = latencies.size();
+            const auto index = std::min(sub1(size),
+                static_cast<size_t>(percentile * size));
+            return latencies.at(index) / 1'000.0;
+        };
+
+        const auto seconds = span.count() / 1'000'000.0;
+        const auto rate = is_zero(span.count()) ? 0.0 : completed / seconds;
+        const auto formatter = output == "json" ? BS_BENCH_JSON :
+            (output == "csv" ? BS_BENCH_CSV : BS_BENCH_TEXT);
+
+        if (output == "text")
+            logger(format(formatter) % bench.first % completed % total.failed %
+                total.items % seconds % rate % rank(0.50) % rank(0.90) %
+                rank(0.99) % rank(0.999) % rank(1.0));
+        else
+            logger(format(formatter) % bench.first % threads % completed %
+                total.failed % total.items % seconds % rate % rank(0.50) %
+                rank(0.90) % rank(0.99) % rank(0.999) % rank(1.0));
+    }
+
+    if (canceled())
+        logger(BS_OPERATION_CANCELED);
+}
+
+} // namespace server
+} // namespace libbitcoin
@@ -171,6 +171,18 @@ bool executor::do_collisions()
     return close_store();
 }
 
+// --b[e]nch
+bool executor::do_bench()
+{
+    log_.stop();
+    if (!check_store_path() ||
+        !open_store())
+        return false;
+
+    run_bench(metadata_.configured.bench);
+    return close_store();
+}
+
 // --[g]et
 bool executor::do_get(const system::hash_digest& hash)
 {
@@ -239,6 +251,9 @@ bool executor::dispatch()
     if (config.information)
         return do_information();
 
+    if (!config.bench.empty())
+        return do_bench();
+
     if (config.settings)
         return do_settings();
 
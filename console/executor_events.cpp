@@ -18,51 +18,24 @@
  */
 #include "executor.hpp"
 
-#include <unordered_map>
+#include <algorithm>
+#include <string>
 #include <bitcoin/server.hpp>
 
 namespace libbitcoin {
 namespace server {
 
-using namespace node;
-
-const std::unordered_map<uint8_t, std::string> executor::fired_
+// The library event name, padded for column alignment in the event log.
+static std::string to_fired(uint8_t event_)
 {
-    { events::header_archived,      "header_archived....." },
-    { events::header_organized,     "header_organized...." },
-    { events::header_reorganized,   "header_reorganized.." },
-
-    { events::block_archived,       "block_archived......" },
-    { events::block_buffered,       "block_buffered......" },
-    { events::block_validated,      "block_validated....." },
-    { events::block_confirmed,      "block_confirmed....." },
-    { events::block_unconfirmable,  "block_unconfirmable." },
-    { events::validate_bypassed,    "validate_bypassed..." },
-    { events::confirm_bypassed,     "confirm_bypassed...." },
-
-    { events::tx_archived,          "tx_archived........." },
-    { events::tx_validated,         "tx_validated........" },
-    { events::tx_invalidated,       "tx_invalidated......" },
-
-    { events::block_organized,      "block_organized....." },
-    { events::block_reorganized,    "block_reorganized..." },
+    constexpr size_t width = 20;
+    auto name = server_metrics::to_name(event_);
+    if (name.empty())
+        name = "unknown";
 
-    { events::template_issued,      "template_issued....." },
-
-    { events::snapshot_secs,        "snapshot_secs......." },
-    { events::prune_msecs,          "prune_msecs........." },
-    { events::reload_msecs,         "reload_msecs........" },
-    { events::block_usecs,          "block_usecs........." },
-    { events::ancestry_msecs,       "ancestry_msecs......" },
-    { events::filter_msecs,         "filter_msecs........" },
-    { events::filterhashes_msecs,   "filterhashes_msecs.." },
-    { events::filterchecks_msecs,   "filterchecks_msecs.." },
-    { events::ecdsa_secs,           "ecdsa_secs.........." },
-    { events::schnorr_secs,         "schnorr_secs........" },
-    { events::silent_secs,          "silent_secs........." },
-
-    { events::unknown,              "unknown............." }
-};
+    name.resize(std::max(name.size(), width), '.');
+    return name;
+}
 
 // Events.
 // ----------------------------------------------------------------------------
@@ -91,7 +64,7 @@ void executor::subscribe_events(std::ostream& sink)
                 return false;
 
             const auto time = duration_cast<seconds>(point - start).count();
-            sink << fired_.at(event_) << " " << value << " " << time << std::endl;
+            sink << to_fired(event_) << " " << value << " " << time << std::endl;
             return true;
         }
     );
@@ -19,6 +19,7 @@
 #include "executor.hpp"
 #include "localize.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 namespace libbitcoin {
@@ -131,7 +132,11 @@ void executor::log_stopping()
 void executor::logger(const std::string& message) const
 {
     if (log_.stopped())
+    {
+        // Parallel scans write from worker threads when the log is stopped.
+        std::lock_guard lock{ output_mutex_ };
         output_ << message << std::endl;
+    }
     else
         log_.write(network::levels::application) << message << std::endl;
 }
@@ -139,7 +144,10 @@ void executor::logger(const std::string& message) const
 void executor::logger(const boost_format& message) const
 {
     if (log_.stopped())
+    {
+        std::lock_guard lock{ output_mutex_ };
         output_ << message << std::endl;
+    }
     else
         log_.write(network::levels::application) << message << std::endl;
 }
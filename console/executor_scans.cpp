@@ -20,7 +20,11 @@
 #include "localize.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace libbitcoin {
 namespace server {
@@ -73,31 +77,104 @@ void executor::scan_flags() const
         span.count());
 }
 
+// Parallel scans.
+// ----------------------------------------------------------------------------
+// Slab, bucket and collision scans partition their domain into contiguous
+// shards, one per thread. Each shard accumulates into its own partial totals
+// (shared bucket counters are incremented atomically, so memory does not
+// scale with threads), which are merged once all shards are joined.
+
+size_t executor::scan_threads() const
+{
+    const auto threads = metadata_.configured.scan_threads;
+    return is_zero(threads) ? std::max(one,
+        size_t{ std::thread::hardware_concurrency() }) : threads;
+}
+
+// Compact bucket counters saturate, so the distribution accumulates all
+// frequencies at or above the maximum as the maximum.
+using counter_t = uint8_t;
+using counters = std_vector<counter_t>;
+static void saturate(counter_t& counter)
+{
+    std::atomic_ref<counter_t> value{ counter };
+    auto prior = value.load(std::memory_order_relaxed);
+    while (prior < max_uint8 && !value.compare_exchange_weak(prior,
+        possible_narrow_cast<counter_t>(add1(prior)),
+        std::memory_order_relaxed));
+}
+
+// Accumulate the frequency (entries per bucket) distribution of a window of
+// counters, from partial distributions of its shards, returning the filled
+// bucket count of the window.
+using distribution = std::map<size_t, size_t>;
+static size_t distribute(distribution& out, size_t threads,
+    const counters& list)
+{
+    std::vector<distribution> partials(threads);
+    parallel(threads, list.size(), [&](size_t shard, size_t first,
+        size_t last)
+    {
+        auto& partial = partials.at(shard);
+        for (auto index = first; index < last; ++index)
+            ++partial[list.at(index)];
+    });
+
+    size_t empty{};
+    for (const auto& partial: partials)
+    {
+        for (const auto& [frequency, buckets]: partial)
+        {
+            out[frequency] += buckets;
+            if (is_zero(frequency))
+                empty += buckets;
+        }
+    }
+
+    return list.size() - empty;
+}
+
 // input and output table slab counts.
 void executor::scan_slabs() const
 {
     logger(BS_INFORMATION_SLABS);
     logger(BS_OPERATION_INTERRUPT);
-    database::tx_link::integer link{};
-    size_t inputs{}, outputs{};
+    constexpr auto frequency = 100'000u;
     const auto start = logger::now();
-    constexpr auto frequency = 100'000;
-
-    // Tx (record) links are sequential and so iterable, however the terminal
-    // condition assumes all tx entries fully written (ok for stopped node).
-    // A running node cannot safely iterate over record links, but stopped can.
-    for (auto puts = query_.put_counts(link); to_bool(puts.first) && !canceled();
-        puts = query_.put_counts(++link))
+    const auto threads = scan_threads();
+    const auto records = query_.tx_records();
+    logger(format(BS_SCAN_SHARDS) % "tx" % threads);
+
+    // Tx (record) links are sequential and so partitionable, however this
+    // assumes all tx entries fully written (ok for stopped node). A running
+    // node cannot safely iterate over record links, but stopped can.
+    std::vector<std::pair<size_t, size_t>> puts(threads);
+    parallel(threads, records, [&](size_t shard, size_t first, size_t last)
     {
-        inputs += puts.first;
-        outputs += puts.second;
-        if (is_zero(link % frequency))
-            logger(format(BS_INFORMATION_SLABS_ROW) % link % inputs % outputs);
-    }
+        auto& [inputs, outputs] = puts.at(shard);
+        for (auto link = first; link < last && !canceled(); ++link)
+        {
+            const auto counts = query_.put_counts(
+                possible_narrow_cast<database::tx_link::integer>(link));
+
+            inputs += counts.first;
+            outputs += counts.second;
+            if (is_zero(link % frequency))
+                logger(format(BS_INFORMATION_SLABS_SHARD) % shard % link %
+                    inputs % outputs);
+        }
+    });
 
     if (canceled())
         logger(BS_OPERATION_CANCELED);
 
+    size_t inputs{}, outputs{};
+    for (const auto& shard: puts)
+    {
+        inputs += shard.first;
+        outputs += shard.second;
+    }
+
     const auto span = duration_cast<seconds>(logger::now() - start);
     logger(format(BS_INFORMATION_STOP) % inputs % outputs % span.count());
 }
@@ -108,335 +185,267 @@ void executor::scan_buckets() const
     constexpr auto block_frequency = 10'000u;
     constexpr auto tx_frequency = 1'000'000u;
     constexpr auto put_frequency = 10'000'000u;
+    const auto threads = scan_threads();
 
     logger(BS_OPERATION_INTERRUPT);
 
-    auto filled = zero;
-    auto bucket = max_size_t;
-    auto start = logger::now();
-    while (!canceled() && (++bucket < query_.header_buckets()))
-    {
-        const auto top = query_.top_header(bucket);
-        if (!top.is_terminal())
-            ++filled;
-
-        if (is_zero(bucket % block_frequency))
-            logger(format("header" BS_READ_ROW) % bucket %
-                duration_cast<seconds>(logger::now() - start).count());
-    }
-
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
-
-    auto span = duration_cast<seconds>(logger::now() - start);
-    logger(format("header" BS_READ_ROW) % (to_double(filled) / bucket) %
-        span.count());
-
-    // ------------------------------------------------------------------------
-
-    filled = zero;
-    bucket = max_size_t;
-    start = logger::now();
-    while (!canceled() && (++bucket < query_.tx_buckets()))
+    // Each shard counts its filled and scanned buckets.
+    const auto scan = [&](const std::string& table, size_t buckets,
+        size_t frequency, const auto& is_filled)
     {
-        const auto top = query_.top_tx(bucket);
-        if (!top.is_terminal())
-            ++filled;
-
-        if (is_zero(bucket % tx_frequency))
-            logger(format("tx" BS_READ_ROW) % bucket %
-                duration_cast<seconds>(logger::now() - start).count());
-    }
+        logger(format(BS_SCAN_SHARDS) % table % threads);
+        const auto start = logger::now();
+        std::vector<std::pair<size_t, size_t>> counts(threads);
+        parallel(threads, buckets, [&](size_t shard, size_t first,
+            size_t last)
+        {
+            auto& [filled, scanned] = counts.at(shard);
+            for (auto bucket = first; bucket < last && !canceled(); ++bucket)
+            {
+                ++scanned;
+                if (is_filled(bucket))
+                    ++filled;
 
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
+                if (is_zero(bucket % frequency))
+                    logger(format(BS_SCAN_ROW) % table % shard % bucket %
+                        duration_cast<seconds>(logger::now() - start).count());
+            }
+        });
 
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("tx" BS_READ_ROW) % (to_double(filled) / bucket) %
-        span.count());
+        if (canceled())
+            logger(BS_OPERATION_CANCELED);
 
-    // ------------------------------------------------------------------------
+        size_t filled{}, scanned{};
+        for (const auto& shard: counts)
+        {
+            filled += shard.first;
+            scanned += shard.second;
+        }
 
-    filled = zero;
-    bucket = max_size_t;
-    start = logger::now();
-    while (!canceled() && (++bucket < query_.ins_buckets()))
-    {
-        const auto top = query_.top_point(bucket);
-        if (!top.is_terminal())
-            ++filled;
+        const auto span = duration_cast<seconds>(logger::now() - start);
+        logger(format(BS_SCAN_RATE) % table % (to_double(filled) / scanned) %
+            span.count());
+    };
 
-        if (is_zero(bucket % put_frequency))
-            logger(format("point" BS_READ_ROW) % bucket %
-                duration_cast<seconds>(logger::now() - start).count());
-    }
+    scan("header", query_.header_buckets(), block_frequency,
+        [&](size_t bucket)
+        {
+            return !query_.top_header(bucket).is_terminal();
+        });
 
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
+    scan("tx", query_.tx_buckets(), tx_frequency,
+        [&](size_t bucket)
+        {
+            return !query_.top_tx(bucket).is_terminal();
+        });
 
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("point" BS_READ_ROW) % (to_double(filled) / bucket) %
-        span.count());
+    scan("point", query_.ins_buckets(), put_frequency,
+        [&](size_t bucket)
+        {
+            return !query_.top_point(bucket).is_terminal();
+        });
 }
 
 // hashmap collision distributions.
-// BUGBUG: the vector allocations are exceessive and can result in sigkill.
-// BUGBUG: must process each header independently as buckets may not coincide.
+// Tables are scanned one at a time, each in bucket windows sized to the
+// memory budget (compact counters, and the bloom filters of the point
+// table). Records are not stored in bucket order, so each window re-walks
+// every record of the table and discards keys outside of the window: a
+// table requiring n windows is read n times. The default budget (4GiB) is
+// sized to production hosts, bounding allocation at the cost of passes over
+// the largest tables, while zero (unbounded) allocates the counters of the
+// full table in one pass. Records are sharded across threads within each
+// pass.
 void executor::scan_collisions() const
 {
     using namespace database;
     using hint = header_link::integer;
-    constexpr auto empty = 0u;
     constexpr auto block_frequency = 10'000u;
     constexpr auto tx_frequency = 1'000'000u;
     constexpr auto put_frequency = 10'000'000u;
-    constexpr auto count = [](const auto& list)
+    const auto threads = scan_threads();
+    const auto budget = metadata_.configured.scan_memory * 1024u * 1024u;
+
+    // TODO: expose filter type from hashhead to table.
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr size_t m = 32;
+    constexpr size_t k = floored_log2(m);
+    using bloom_t = bloom<m, k>;
+    ////using sieve_t = sieve<m, 3>;
+    ///////////////////////////////////////////////////////////////////////////
+
+    constexpr auto empty_bloom = unmask_right<bloom_t::type>(m);
+    using entropy_t = uint64_t;
+
+    // Per pass shard: keys counted within the window and bloom collisions.
+    struct totals
     {
-        return std::accumulate(list.begin(), list.end(), zero,
-            [](size_t total, const auto& value)
-            {
-                return total + to_int(to_bool(value));
-            });
+        size_t inserts{};
+        size_t collisions{};
     };
-    constexpr auto dump = [&](const auto& list)
+
+    // Visit each key of the table as (bucket, entropy) by record index.
+    const auto scan = [&](const std::string& table, size_t buckets,
+        size_t records, size_t frequency, bool screen,
+        const auto& visit) -> totals
     {
-        // map frequency to length.
-        std::map<size_t, size_t> map{};
-        for (const auto value: list)
-            ++map[value];
+        const auto start = logger::now();
+        const auto bytes = sizeof(counter_t) +
+            (screen ? sizeof(bloom_t::type) : zero);
+        const auto window = is_zero(budget) ? buckets :
+            std::max(one, budget / bytes);
+
+        totals total{};
+        size_t filled{};
+        distribution frequencies{};
+        for (size_t low{}; low < buckets && !canceled(); low += window)
+        {
+            const auto high = std::min(buckets, low + window);
+            logger(format(BS_SCAN_PASS) % table % low % high % threads);
 
-        return map;
-    };
+            counters counts(high - low, counter_t{});
+            std_vector<bloom_t::type> filter(screen ? high - low : zero,
+                empty_bloom);
 
-    logger(BS_OPERATION_INTERRUPT);
+            std::vector<totals> shards(threads);
+            parallel(threads, records, [&](size_t shard, size_t first,
+                size_t last)
+            {
+                auto& partial = shards.at(shard);
+                for (auto index = first; index < last && !canceled(); ++index)
+                {
+                    visit(index, [&](size_t bucket, entropy_t entropy)
+                    {
+                        if (bucket < low || bucket >= high)
+                            return;
+
+                        const auto offset = bucket - low;
+                        saturate(counts.at(offset));
+                        ++partial.inserts;
+                        if (!screen)
+                            return;
+
+                        // Concurrent screens of a bucket are resolved by
+                        // compare-exchange. The filter is a union of bits,
+                        // so only attribution of collisions depends upon
+                        // insertion order.
+                        std::atomic_ref<bloom_t::type> value
+                        {
+                            filter.at(offset)
+                        };
+
+                        auto prev = value.load(std::memory_order_relaxed);
+                        auto next = bloom_t::screen(prev, entropy);
+                        while (!value.compare_exchange_weak(prev, next,
+                            std::memory_order_relaxed))
+                            next = bloom_t::screen(prev, entropy);
+
+                        partial.collisions += to_int(
+                            bloom_t::is_collision(prev, next));
+                    });
+
+                    if (is_zero(index % frequency))
+                        logger(format(BS_SCAN_ROW) % table % shard % index %
+                            duration_cast<seconds>(logger::now() -
+                                start).count());
+                }
+            });
 
-    // header & txs (txs is a proxy for validated_bk)
-    // ------------------------------------------------------------------------
+            for (const auto& partial: shards)
+            {
+                total.inserts += partial.inserts;
+                total.collisions += partial.collisions;
+            }
 
-    auto index = max_size_t;
-    auto start = logger::now();
-    const auto header_buckets = query_.header_buckets();
-    const auto header_records = query_.header_records();
-    std_vector<size_t> header(header_buckets, empty);
-    std_vector<size_t> txs(header_buckets, empty);
-    while (!canceled() && (++index < header_records))
-    {
-        const header_link link{ possible_narrow_cast<hint>(index) };
-        const auto key = query_.get_header_key(link.value);
-        ++header.at(database::keys::hash(key) % header_buckets);
-        ++txs.at(database::keys::hash(
-            link.operator data_array<header_link::size>()) %
-            header_buckets);
-
-        if (is_zero(index % block_frequency))
-            logger(format("header/txs" BS_READ_ROW) % index %
-                duration_cast<seconds>(logger::now() - start).count());
-    }
+            // Counters are released before the next window is allocated.
+            filled += distribute(frequencies, threads, counts);
+        }
 
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
+        if (canceled())
+            logger(BS_OPERATION_CANCELED);
 
-    // ........................................................................
-    
-    const auto header_count = count(header);
-    auto span = duration_cast<seconds>(logger::now() - start);
-    logger(format("header: %1% in %2%s buckets %3% filled %4% rate %5% ") %
-        index % span.count() % header_buckets % header_count %
-        (to_double(header_count) / header_buckets));
+        const auto span = duration_cast<seconds>(logger::now() - start);
+        logger(format("%1%: %2% in %3%s buckets %4% filled %5% rate %6%") %
+            table % total.inserts % span.count() % buckets % filled %
+            (to_double(filled) / buckets));
 
-    for (const auto& entry: dump(header))
-        logger(format("header: %1% frequency: %2%") %
-            entry.first % entry.second);
+        for (const auto& entry: frequencies)
+            logger(format("%1%: %2% frequency: %3%") % table %
+                entry.first % entry.second);
 
-    header.clear();
-    header.shrink_to_fit();
+        return total;
+    };
 
-    // ........................................................................
+    logger(BS_OPERATION_INTERRUPT);
 
-    const auto txs_count = count(txs);
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("txs: %1% in %2%s buckets %3% filled %4% rate %5%") %
-        index % span.count() % header_buckets % txs_count %
-        (to_double(txs_count) / header_buckets));
+    // header & txs (txs is a proxy for validated_bk)
+    // ------------------------------------------------------------------------
 
-    for (const auto& entry: dump(txs))
-        logger(format("txs: %1% frequency: %2%") %
-            entry.first % entry.second);
- 
-    txs.clear();
-    txs.shrink_to_fit();
+    const auto header_buckets = query_.header_buckets();
+    const auto header_records = query_.header_records();
+    scan("header", header_buckets, header_records, block_frequency, false,
+        [&](size_t index, const auto& count)
+        {
+            const header_link link{ possible_narrow_cast<hint>(index) };
+            const auto key = query_.get_header_key(link.value);
+            count(keys::hash(key) % header_buckets, entropy_t{});
+        });
+
+    scan("txs", header_buckets, header_records, block_frequency, false,
+        [&](size_t index, const auto& count)
+        {
+            const header_link link{ possible_narrow_cast<hint>(index) };
+            count(keys::hash(link.operator data_array<header_link::size>()) %
+                header_buckets, entropy_t{});
+        });
 
     // tx & strong_tx (strong_tx is a proxy for validated_tx)
     // ------------------------------------------------------------------------
 
-    index = max_size_t;
-    start = logger::now();
     const auto tx_buckets = query_.tx_buckets();
     const auto tx_records = query_.tx_records();
-    std_vector<size_t> tx(tx_buckets, empty);
-    std_vector<size_t> strong_tx(tx_buckets, empty);
-    while (!canceled() && (++index < tx_records))
-    {
-        const tx_link link{ possible_narrow_cast<tx_link::integer>(index) };
-        const auto key = query_.get_tx_key(link.value);
-        ++tx.at(database::keys::hash(key) % tx_buckets);
-        ++strong_tx.at(database::keys::hash(
-            link.operator data_array<tx_link::size>()) % tx_buckets);
-    
-        if (is_zero(index % tx_frequency))
-            logger(format("tx & strong_tx" BS_READ_ROW) % index %
-                duration_cast<seconds>(logger::now() - start).count());
-    }
-    
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
-    
-    // ........................................................................
-    
-    const auto tx_count = count(tx);
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("tx: %1% in %2%s buckets %3% filled %4% rate %5%") %
-        index % span.count() % tx_buckets % tx_count %
-        (to_double(tx_count) / tx_buckets));
-    
-    for (const auto& entry: dump(tx))
-        logger(format("tx: %1% frequency: %2%") %
-            entry.first % entry.second);
-    
-    tx.clear();
-    tx.shrink_to_fit();
-    
-    // ........................................................................
-    
-    const auto strong_tx_count = count(strong_tx);
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("strong_tx: %1% in %2%s buckets %3% filled %4% rate %5%") %
-        index % span.count() % tx_buckets % strong_tx_count %
-        (to_double(strong_tx_count) / tx_buckets));
-    
-    for (const auto& entry: dump(strong_tx))
-        logger(format("strong_tx: %1% frequency: %2%") %
-            entry.first % entry.second);
-    
-    strong_tx.clear();
-    strong_tx.shrink_to_fit();
-    
+    scan("tx", tx_buckets, tx_records, tx_frequency, false,
+        [&](size_t index, const auto& count)
+        {
+            const tx_link link{ possible_narrow_cast<tx_link::integer>(index) };
+            const auto key = query_.get_tx_key(link.value);
+            count(keys::hash(key) % tx_buckets, entropy_t{});
+        });
+
+    scan("strong_tx", tx_buckets, tx_records, tx_frequency, false,
+        [&](size_t index, const auto& count)
+        {
+            const tx_link link{ possible_narrow_cast<tx_link::integer>(index) };
+            count(keys::hash(link.operator data_array<tx_link::size>()) %
+                tx_buckets, entropy_t{});
+        });
+
     // point
     // ------------------------------------------------------------------------
 
-    index = max_size_t;
-    start = logger::now();
+    // If and only if coinbase bucket is one (one coinbase per height).
     const auto point_buckets = query_.ins_buckets();
-    std_vector<size_t> spend(point_buckets, empty);
-    auto inserts = zero;
-
-    // TODO: expose filter type from hashhead to table.
-    ///////////////////////////////////////////////////////////////////////////
-    constexpr size_t m = 32;
-    constexpr size_t k = floored_log2(m);
-    using bloom_t = bloom<m, k>;
-    ////using sieve_t = sieve<m, 3>;
-    ///////////////////////////////////////////////////////////////////////////
-
-    constexpr auto empty_bloom = unmask_right<bloom_t::type>(m);
-    std_vector<bloom_t::type> bloom_filter(point_buckets, empty_bloom);
-    size_t bloom_collisions{};
-    size_t bloom_subtotal{};
-
-    ////constexpr auto empty_sieve = unmask_right<sieve_t::type>(m);
-    ////std_vector<sieve_t::type> sieve_filter(point_buckets, empty_sieve);
-    ////size_t sieve_collisions{};
-    ////size_t sieve_subtotal{};
-
-    size_t coinbases{};
-    size_t window{};
-
-    const auto top = query_.get_top_associated();
-    for (index = zero; index <= top && !canceled(); ++index)
-    {
-        ++coinbases;
-        const auto link = query_.to_candidate(index);
-        const auto transactions = query_.to_transactions(link);
-        for (const auto& transaction: transactions)
+    const auto heights = add1(query_.get_top_associated());
+    const auto total = scan("point", point_buckets, heights, put_frequency,
+        true, [&](size_t height, const auto& count)
         {
-            const auto points = query_.to_points(transaction);
-            for (const auto& point: points)
+            const auto link = query_.to_candidate(height);
+            for (const auto& transaction: query_.to_transactions(link))
             {
-                // If and only if coinbase bucket is one.
-                const auto key = query_.get_point(point);
-                const auto bucket = database::keys::bucket(key, point_buckets);
-                const auto entropy = database::keys::thumb(key);
-                ++spend.at(bucket);
-                ++inserts;
-                ++window;
-
-                auto prev = bloom_filter.at(bucket);
-                auto next = bloom_t::screen(prev, entropy);
-                bloom_filter.at(bucket) = next;
-                auto coll = to_int(bloom_t::is_collision(prev, next));
-                bloom_collisions += coll;
-                bloom_subtotal += coll;
-
-                ////prev = sieve_filter.at(bucket);
-                ////next = sieve_t::screen(prev, entropy);
-                ////sieve_filter.at(bucket) = next;
-                ////coll = to_int(sieve_t::is_collision(prev, next));
-                ////sieve_collisions += coll;
-                ////sieve_subtotal += coll;
-
-                if (is_zero(inserts % put_frequency))
+                for (const auto& point: query_.to_points(transaction))
                 {
-                    logger(format("point: %1% bloom fps %2% rate %3$.7f in %4% secs.") %
-                        inserts % bloom_collisions %
-                        (to_double(bloom_subtotal) / window) %
-                        duration_cast<seconds>(logger::now() - start).count());
-
-                    ////logger(format("point: %1% sieve fps %2% rate %3$.7f in %4% secs.") %
-                    ////    inserts % sieve_collisions % 
-                    ////    (to_double(sieve_subtotal) / window) %
-                    ////    duration_cast<seconds>(logger::now() - start).count());
-
-                    ////sieve_subtotal = zero;
-                    bloom_subtotal = zero;
-                    window = zero;
+                    const auto key = query_.get_point(point);
+                    count(keys::bucket(key, point_buckets), keys::thumb(key));
                 }
             }
-        }
-    }
-
-    if (canceled())
-        logger(BS_OPERATION_CANCELED);
-
-    // ........................................................................
-
-    const auto point_count = count(spend);
-    span = duration_cast<seconds>(logger::now() - start);
-    logger(format("point: %1% in %2%s buckets %3% filled %4% rate %5%") %
-        inserts % span.count() % point_buckets % point_count %
-        (to_double(point_count) / point_buckets));
+        });
 
-    const auto spends = inserts - coinbases;
-    const auto bloom_spend_collisions = bloom_collisions - coinbases;
+    const auto coinbases = heights;
+    const auto spends = total.inserts - coinbases;
+    const auto bloom_spend_collisions = total.collisions - coinbases;
     logger(format("bloom: %1% fps of %2% spends (ex %3% cbs) rate %4%") %
         bloom_spend_collisions % spends % coinbases %
         (to_double(bloom_spend_collisions) / spends));
-
-    ////const auto sieve_spend_collisions = sieve_collisions - coinbases;
-    ////logger(format("sieve: %1% fps of %2% spends (ex %3% cbs) rate %4%") %
-    ////    sieve_spend_collisions % spends % coinbases %
-    ////    (to_double(sieve_spend_collisions) / spends));
-
-    for (const auto& entry: dump(spend))
-        logger(format("point: %1% frequency: %2%") %
-            entry.first % entry.second);
-
-
-    ////spend.clear();
-    ////spend.shrink_to_fit();
-    ////bloom_filter.clear();
-    ////bloom_filter.shrink_to_fit();
-    ////sieve_filter.clear();
-    ////sieve_filter.shrink_to_fit();
 }
 
 } // namespace server
@@ -163,6 +163,8 @@
     "Table slabs..."
 #define BS_INFORMATION_SLABS_ROW \
     "   @tx       :%1%, inputs:%2%, outputs:%3%"
+#define BS_INFORMATION_SLABS_SHARD \
+    "   shard %1% @tx:%2%, inputs:%3%, outputs:%4%"
 #define BS_INFORMATION_STOP \
     "   input     :%1%\n" \
     "   output    :%2%\n" \
@@ -205,6 +207,43 @@
 #define BS_READ_ROW \
     ": %1% in %2% secs."
 
+// --slabs, --buckets, --collisions
+#define BS_SCAN_SHARDS \
+    "Scanning %1% in %2% shards..."
+#define BS_SCAN_PASS \
+    "Scanning %1% buckets [%2%..%3%) in %4% shards..."
+#define BS_SCAN_ROW \
+    "%1% shard %2%: %3% in %4% secs."
+#define BS_SCAN_RATE \
+    "%1%: %2% in %3% secs."
+
+// --bench
+#define BS_BENCH_LIST \
+    "   %1%: %2%"
+#define BS_BENCH_UNKNOWN \
+    "Unknown benchmark '%1%', use 'list' to display workloads."
+#define BS_BENCH_FORMAT \
+    "Unknown bench_format '%1%', use 'text', 'json' or 'csv'."
+#define BS_BENCH_DISABLED \
+    "Benchmark '%1%' skipped, requires %2% index."
+#define BS_BENCH_EMPTY \
+    "Benchmark '%1%' skipped, no samples in store."
+#define BS_BENCH_PREPARE \
+    "Benchmark '%1%' %2% samples on %3% threads..."
+#define BS_BENCH_TEXT \
+    "%1%: samples %2% failed %3% items %4% in %5% secs rate %6%/s " \
+    "(us) p50 %7% p90 %8% p99 %9% p999 %10% max %11%"
+#define BS_BENCH_JSON \
+    "{\"name\":\"%1%\",\"threads\":%2%,\"samples\":%3%," \
+    "\"failed\":%4%,\"items\":%5%,\"seconds\":%6%,\"rate\":%7%," \
+    "\"p50_us\":%8%,\"p90_us\":%9%,\"p99_us\":%10%," \
+    "\"p999_us\":%11%,\"max_us\":%12%}"
+#define BS_BENCH_CSV_HEADER \
+    "name,threads,samples,failed,items,seconds,rate," \
+    "p50_us,p90_us,p99_us,p999_us,max_us"
+#define BS_BENCH_CSV \
+    "%1%,%2%,%3%,%4%,%5%,%6%,%7%,%8%,%9%,%10%,%11%,%12%"
+
 // --write
 #define BS_WRITE_ROW \
     ": %1% in %2% span."
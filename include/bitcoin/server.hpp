@@ -18,6 +18,7 @@
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/error.hpp>
+#include <bitcoin/server/events.hpp>
 #include <bitcoin/server/parser.hpp>
 #include <bitcoin/server/server_node.hpp>
 #include <bitcoin/server/settings.hpp>
@@ -42,6 +43,7 @@
 #include <bitcoin/server/interfaces/btcd.hpp>
 #include <bitcoin/server/interfaces/electrum.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
+#include <bitcoin/server/interfaces/method_map.hpp>
 #include <bitcoin/server/interfaces/native.hpp>
 #include <bitcoin/server/interfaces/stratum_v1.hpp>
 #include <bitcoin/server/interfaces/stratum_v2.hpp>
@@ -82,6 +84,23 @@
 #include <bitcoin/server/protocols/protocol_stratum_v1.hpp>
 #include <bitcoin/server/protocols/protocol_stratum_v2.hpp>
 #include <bitcoin/server/protocols/protocols.hpp>
+#include <bitcoin/server/services/block_notifications.hpp>
+#include <bitcoin/server/services/block_stats_cache.hpp>
+#include <bitcoin/server/services/block_templates.hpp>
+#include <bitcoin/server/services/block_waiters.hpp>
+#include <bitcoin/server/services/chain_tx_index.hpp>
+#include <bitcoin/server/services/chase_hub.hpp>
+#include <bitcoin/server/services/executor_pools.hpp>
+#include <bitcoin/server/services/query_deadline.hpp>
+#include <bitcoin/server/services/rate_limits.hpp>
+#include <bitcoin/server/services/request_metrics.hpp>
+#include <bitcoin/server/services/server_metrics.hpp>
+#include <bitcoin/server/services/stratum_accounts.hpp>
+#include <bitcoin/server/services/stratum_jobs.hpp>
+#include <bitcoin/server/services/transaction_batch.hpp>
+#include <bitcoin/server/services/services.hpp>
+#include <bitcoin/server/services/share_validator.hpp>
+#include <bitcoin/server/services/vardiff.hpp>
 #include <bitcoin/server/sessions/session.hpp>
 #include <bitcoin/server/sessions/session_handshake.hpp>
 #include <bitcoin/server/sessions/session_server.hpp>
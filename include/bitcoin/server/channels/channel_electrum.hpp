@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <bitcoin/server/channels/channel.hpp>
+#include <bitcoin/server/channels/channel_rpc.hpp>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -33,7 +34,7 @@ namespace server {
 /// Channel for electrum channels (non-http json-rpc).
 class BCS_API channel_electrum
   : public server::channel,
-    public network::channel_rpc<interface::electrum>,
+    public server::channel_rpc<interface::electrum>,
     protected network::tracker<channel_electrum>
 {
 public:
@@ -46,7 +47,7 @@ public:
         const node::configuration& config, const options_t& options) NOEXCEPT
       : server::channel(log, socket, identifier, config),
         options_(options),
-        network::channel_rpc<interface::electrum>(log, socket, identifier,
+        server::channel_rpc<interface::electrum>(log, socket, identifier,
             config.network, options),
         network::tracker<channel_electrum>(log)
     {
@@ -80,6 +81,15 @@ public:
         return options_;
     }
 
+protected:
+    /// The method name is taken once from each request as it is dispatched.
+    inline void dispatch(
+        const network::rpc::request_cptr& request) NOEXCEPT override
+    {
+        set_request(request->message.method);
+        server::channel_rpc<interface::electrum>::dispatch(request);
+    }
+
 private:
     // This is thread safe.
     const options_t& options_;
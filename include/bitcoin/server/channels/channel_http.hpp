@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SERVER_CHANNELS_CHANNEL_HTTP_HPP
 
 #include <memory>
+#include <string>
+#include <utility>
 #include <bitcoin/server/channels/channel.hpp>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
@@ -30,6 +32,8 @@ namespace server {
 /// Channel for http services, websocket frames read as Body (a json-rpc
 /// service instantiates with network::rpc::request). An in-band service
 /// (e.g. btcd authenticate) authorizes after upgrade, so its upgrade is open.
+/// Adds the write of a json message serialized once and shared by any number
+/// of channels (notifications).
 template <typename Body = network::http::string_value, bool InBand = false>
 class BCS_API channel_http
   : public server::channel,
@@ -38,6 +42,7 @@ class BCS_API channel_http
 {
 public:
     typedef std::shared_ptr<channel_http> ptr;
+    using shared_text = std::shared_ptr<const std::string>;
 
     inline channel_http(const network::logger& log,
         const network::socket::ptr& socket, uint64_t identifier,
@@ -49,6 +54,31 @@ public:
     {
     }
 
+    /// Write the serialized json message as a response body that references
+    /// it, retaining it until the write completes (requires strand).
+    inline void write_shared(const shared_text& message,
+        network::result_handler&& handler) NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        using namespace network::http;
+        static const auto json = from_media_type(media_type::application_json);
+
+        response response{ status::ok, 11 };
+        response.set(field::content_type, json);
+        response.body() = span_body::value_type
+        {
+            const_cast<uint8_t*>(pointer_cast<const uint8_t>(message->data())),
+            message->size()
+        };
+
+        response.prepare_payload();
+        this->send(std::move(response),
+            [message, handler = std::move(handler)](const code& ec) NOEXCEPT
+            {
+                handler(ec);
+            });
+    }
+
 protected:
     using value_type = network::http::body::value_type;
 
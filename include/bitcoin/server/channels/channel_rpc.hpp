@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_CHANNELS_CHANNEL_RPC_HPP
+#define LIBBITCOIN_SERVER_CHANNELS_CHANNEL_RPC_HPP
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Intermediate json-rpc (non-http) channel, adding the write of a message
+/// serialized once and shared by any number of channels (notifications), and
+/// the method of the request in service (set by a derived channel's dispatch,
+/// so that protocols do not restate it per handler).
+template <typename Interface>
+class BCS_API channel_rpc
+  : public network::channel_rpc<Interface>
+{
+public:
+    using base = network::channel_rpc<Interface>;
+    using shared_text = std::shared_ptr<const std::string>;
+    using clock = std::chrono::steady_clock;
+    using base::base;
+
+    /// The method of the request in service, empty if none (requires strand).
+    inline const std::string& method() const NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        return method_;
+    }
+
+    /// Take the method and dispatch time of the request in service, false if
+    /// none (requires strand). The request is then no longer in service.
+    inline bool take_request(std::string& method,
+        clock::time_point& started) NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        if (method_.empty())
+            return false;
+
+        method = std::move(method_);
+        started = started_;
+        method_.clear();
+        return true;
+    }
+
+    /// Write the serialized message (including its delimiter) by reference,
+    /// retaining it until the write completes (requires strand).
+    inline void write_shared(const shared_text& message,
+        network::result_handler&& handler) NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        this->write(network::asio::const_buffer{ message->data(),
+            message->size() },
+            [message, handler = std::move(handler)](const code& ec) NOEXCEPT
+            {
+                handler(ec);
+            });
+    }
+
+protected:
+    /// Set the request in service, as it is dispatched (requires strand).
+    inline void set_request(const std::string& method) NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        method_ = method;
+        started_ = clock::now();
+    }
+
+private:
+    // These are protected by strand.
+    std::string method_{};
+    clock::time_point started_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
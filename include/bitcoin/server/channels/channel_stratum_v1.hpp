@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <bitcoin/server/channels/channel.hpp>
+#include <bitcoin/server/channels/channel_rpc.hpp>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -31,7 +32,7 @@ namespace server {
 /// Channel for stratum v1 channels (non-http json-rpc).
 class BCS_API channel_stratum_v1
   : public server::channel,
-    public network::channel_rpc<interface::stratum_v1>,
+    public server::channel_rpc<interface::stratum_v1>,
     protected network::tracker<channel_stratum_v1>
 {
 public:
@@ -43,7 +44,7 @@ public:
         const network::socket::ptr& socket, uint64_t identifier,
         const node::configuration& config, const options_t& options) NOEXCEPT
       : server::channel(log, socket, identifier, config),
-        network::channel_rpc<interface::stratum_v1>(log, socket, identifier,
+        server::channel_rpc<interface::stratum_v1>(log, socket, identifier,
             config.network, options),
         network::tracker<channel_stratum_v1>(log)
     {
@@ -22,6 +22,7 @@
 #include <bitcoin/server/channels/channel.hpp>
 #include <bitcoin/server/channels/channel_electrum.hpp>
 #include <bitcoin/server/channels/channel_http.hpp>
+#include <bitcoin/server/channels/channel_rpc.hpp>
 #include <bitcoin/server/channels/channel_stratum_v1.hpp>
 #include <bitcoin/server/channels/channel_stratum_v2.hpp>
 
@@ -48,8 +49,11 @@ node::channel
 
 server::channel → node::channel
 ├── channel_stratum_v2 → network::channel
-├── channel_stratum_v1 → network::channel_rpc<interface::stratum_v1>
-├── channel_electrum   → network::channel_rpc<interface::electrum>
+├── channel_stratum_v1 → server::channel_rpc<interface::stratum_v1>
+├── channel_electrum   → server::channel_rpc<interface::electrum>
 └── channel_http<Body> → network::channel_http
 
+server::channel_rpc<Interface> → network::channel_rpc<Interface>
+(adds write of a shared serialized message)
+
 */
@@ -59,6 +59,14 @@ public:
     bool slabs{};
     bool buckets{};
     bool collisions{};
+    size_t scan_threads{};
+    size_t scan_memory{ 4096 };
+
+    /// Benchmarks.
+    std::string bench{};
+    size_t bench_threads{};
+    size_t bench_samples{ 1000 };
+    std::string bench_format{ "text" };
 
     /// Ad-hoc Testing.
     system::config::hash256 get{};
@@ -85,7 +85,8 @@ namespace std::placeholders
 // configuration  : define settings
 // parser         : define configuration
 // /channels      : define configuration
-// server_node    : define configuration
+// /services      : define /parsers
+// server_node    : define configuration /services
 // session        : define                   [forward: server_node]
 // /protocols     : define /channels         [session.hpp]
 // /sessions      : define /protocols        [forward: server_node]
\ No newline at end of file
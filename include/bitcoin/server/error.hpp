@@ -69,7 +69,15 @@ enum error_t : uint8_t
     maximum_depth,
     wrong_version,
     server_error,
-    method_unauthorized
+    method_unauthorized,
+    rate_limited,
+    query_canceled,
+
+    /// server (stratum share codes)
+    stale_job,
+    duplicate_share,
+    low_difficulty,
+    validator_busy
 };
 
 // No current need for error_code equivalence mapping.
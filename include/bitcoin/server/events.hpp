@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_EVENTS_HPP
+#define LIBBITCOIN_SERVER_EVENTS_HPP
+
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Server event identifiers, numbered following node events.
+enum server_events : uint8_t
+{
+    /// Session startup durations (milliseconds).
+    admin_start_msecs = node::events::unknown + 1,
+    native_start_msecs,
+    bitcoind_start_msecs,
+    btcd_start_msecs,
+    electrum_start_msecs,
+    stratum1_start_msecs,
+    stratum2_start_msecs,
+    sessions_start_msecs
+};
+
+// Limited by admin json number domain and sentinel bit.
+static_assert(server_events::sessions_start_msecs < 53u);
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -31,7 +31,10 @@ struct admin_methods
     static constexpr std::tuple methods
     {
         method<"log_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" },
-        method<"event_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" }
+        method<"event_subscribe", uint8_t, optional<0_u64>>{ "version", "filter" },
+        method<"stratum_workers", uint8_t>{ "version" },
+        method<"request_metrics", uint8_t>{ "version" },
+        method<"metrics", uint8_t>{ "version" }
     };
 
     template <typename... Args>
@@ -44,6 +47,9 @@ struct admin_methods
 
     using log_subscribe = at<0>;
     using event_subscribe = at<1>;
+    using stratum_workers = at<2>;
+    using request_metrics = at<3>;
+    using metrics = at<4>;
 };
 
 /// ?format=data|text|json (via query string).
@@ -58,6 +64,24 @@ struct admin_methods
 /// /v1/log/subscribe?filter=[mask] {stream}
 /// /v1/event/subscribe?filter=[mask] {stream}
 
+/// The workers result is the share accounting of each stratum worker (as
+/// authorized by name), with the accepted share rate per minute over the most
+/// recent aggregation window.
+
+/// /v1/stratum/workers
+
+/// The requests result is the count, error count, response bytes and latency
+/// quantiles (microseconds) of each method of each request interface, since
+/// startup. The text format is the Prometheus exposition of the same.
+
+/// /v1/metrics/requests?format=json|text
+
+/// The metrics result is the Prometheus exposition (text only) of fired node
+/// and server events, accepted connections by interface, open channels,
+/// chain heights, store table body sizes and request metrics, for scraping.
+
+/// /v1/metrics
+
 } // namespace interface
 } // namespace server
 } // namespace libbitcoin
@@ -57,9 +57,9 @@ struct bitcoind_blockchain_methods
         method<"getdifficulty">{},
         method<"preciousblock">{ unimplemented },
         method<"scanblocks">{ unimplemented },
-        method<"waitforblock">{ unimplemented },
-        method<"waitforblockheight">{ unimplemented },
-        method<"waitfornewblock">{ unimplemented },
+        method<"waitforblock", string_t, optional<0.0>>{ "blockhash", "timeout" },
+        method<"waitforblockheight", number_t, optional<0.0>>{ "height", "timeout" },
+        method<"waitfornewblock", optional<0.0>>{ "timeout" },
         method<"getmempoolancestors">{ unimplemented },
         method<"getmempoolcluster">{ unimplemented },
         method<"getmempooldescendants">{ unimplemented },
@@ -32,9 +32,9 @@ struct bitcoind_mining_methods
     {
         method<"getnetworkhashps", optional<120.0>, optional<-1.0>>{ "nblocks", "height" },
         method<"getmininginfo">{},
-        method<"submitblock">{ unimplemented },
+        method<"submitblock", string_t, optional<""_t>>{ "hexdata", "dummy" },
         method<"submitheader">{ unimplemented },
-        method<"getblocktemplate">{ unimplemented },
+        method<"getblocktemplate", optional<empty::object>>{ "template_request" },
         method<"getprioritisedtransactions">{ unimplemented },
         method<"prioritisetransaction">{ unimplemented }
     };
@@ -32,6 +32,7 @@
 #include <bitcoin/server/interfaces/bitcoind_wallet.hpp>
 #include <bitcoin/server/interfaces/btcd.hpp>
 #include <bitcoin/server/interfaces/electrum.hpp>
+#include <bitcoin/server/interfaces/method_map.hpp>
 #include <bitcoin/server/interfaces/native.hpp>
 #include <bitcoin/server/interfaces/stratum_v1.hpp>
 #include <bitcoin/server/interfaces/stratum_v2.hpp>
@@ -58,6 +59,21 @@ using native                 = publish<native_methods>;
 using stratum_v1             = publish<stratum_v1_methods>;
 using stratum_v2             = publish<stratum_v2_methods>;
 
+/// Method name lookup for the json-rpc interfaces offered to the attached
+/// protocols of a channel (one probe per protocol, independent of the size
+/// of the interfaces).
+using bitcoind_map = method_map<
+    bitcoind_blockchain,
+    bitcoind_control,
+    bitcoind_mining,
+    bitcoind_network,
+    bitcoind_notifications,
+    bitcoind_test,
+    bitcoind_transaction,
+    bitcoind_utility,
+    bitcoind_wallet>;
+using btcd_map = method_map<btcd>;
+
 } // namespace interface
 } // namespace server
 } // namespace libbitcoin
@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_INTERFACES_METHOD_MAP_HPP
+#define LIBBITCOIN_SERVER_INTERFACES_METHOD_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+namespace interface {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+/// A method name and its interface within a set of published interfaces.
+struct method_entry
+{
+    std::string_view name{};
+    uint8_t group{};
+};
+
+/// Perfect hash table over Size unique names (hash and displace). A name is
+/// hashed to a bucket, the bucket seed rehashes it to its slot, and the slot
+/// holds the entry position, so a lookup is one probe and one comparison.
+template <size_t Size>
+struct method_table
+{
+    static constexpr size_t slots = std::bit_ceil(std::max(two * Size, one));
+    static constexpr size_t buckets = std::max(slots / 8u, one);
+
+    /// fnv-1a, seeded.
+    static constexpr uint32_t hash(const std::string_view& name,
+        uint32_t seed) NOEXCEPT
+    {
+        auto value = uint32_t{ 0x811c9dc5 } ^ (seed * uint32_t{ 0x9e3779b9 });
+        for (const auto character: name)
+        {
+            value ^= static_cast<uint8_t>(character);
+            value *= uint32_t{ 0x01000193 };
+        }
+
+        return value ^ (value >> 15);
+    }
+
+    static constexpr size_t bucket(const std::string_view& name) NOEXCEPT
+    {
+        return hash(name, 0) & sub1(buckets);
+    }
+
+    static constexpr size_t slot(const std::string_view& name,
+        uint32_t seed) NOEXCEPT
+    {
+        return hash(name, seed) & sub1(slots);
+    }
+
+    /// The entry of the named method, nullptr if not found.
+    constexpr const method_entry* find(
+        const std::string_view& name) const NOEXCEPT
+    {
+        const auto position = positions[slot(name, seeds[bucket(name)])];
+        if (is_zero(position))
+            return nullptr;
+
+        const auto& item = entries[sub1(position)];
+        return item.name == name ? &item : nullptr;
+    }
+
+    std::array<method_entry, Size> entries{};
+    std::array<uint32_t, buckets> seeds{};
+    std::array<uint16_t, slots> positions{};
+    bool valid{};
+};
+
+/// The number of methods in the interfaces.
+template <typename... Interfaces>
+constexpr size_t method_count() NOEXCEPT
+{
+    return (zero + ... + std::tuple_size_v<
+        std::remove_cvref_t<decltype(Interfaces::methods)>>);
+}
+
+/// Build the table at compile time, invalid if a name is not unique.
+template <typename... Interfaces>
+constexpr auto make_method_table() NOEXCEPT
+{
+    constexpr auto size = method_count<Interfaces...>();
+    using table = method_table<size>;
+    table out{};
+
+    // Entries in template (group) and interface order.
+    size_t position{};
+    uint8_t group{};
+    ((std::apply([&](const auto&... items) NOEXCEPT
+    {
+        ((out.entries[position++] = method_entry
+        {
+            std::string_view{ items.name }, group
+        }), ...);
+    }, Interfaces::methods), ++group), ...);
+
+    // Identical names cannot be displaced apart.
+    for (size_t left{}; left < size; ++left)
+        for (auto right = add1(left); right < size; ++right)
+            if (out.entries[left].name == out.entries[right].name)
+                return out;
+
+    std::array<size_t, size> homes{};
+    std::array<size_t, table::buckets> counts{};
+    std::array<size_t, table::buckets> order{};
+    for (size_t index{}; index < size; ++index)
+    {
+        homes[index] = table::bucket(out.entries[index].name);
+        ++counts[homes[index]];
+    }
+
+    // Place the fullest buckets first, while most slots are free.
+    for (size_t index{}; index < table::buckets; ++index)
+        order[index] = index;
+
+    std::sort(order.begin(), order.end(), [&](size_t left, size_t right)
+    {
+        return counts[left] > counts[right];
+    });
+
+    // Find a seed for each bucket that places its names in free slots.
+    constexpr uint32_t limit = 1u << 16;
+    std::array<size_t, size> placed{};
+    for (const auto current: order)
+    {
+        if (is_zero(counts[current]))
+            break;
+
+        uint32_t seed{ 1 };
+        for (; seed < limit; ++seed)
+        {
+            size_t count{};
+            auto fits = true;
+            for (size_t index{}; fits && index < size; ++index)
+            {
+                if (homes[index] != current)
+                    continue;
+
+                const auto slot = table::slot(out.entries[index].name,
+                    seed);
+                fits = is_zero(out.positions[slot]);
+                for (size_t prior{}; fits && prior < count; ++prior)
+                    fits = table::slot(out.entries[placed[prior]].name,
+                        seed) != slot;
+
+                placed[count++] = index;
+            }
+
+            if (!fits)
+                continue;
+
+            for (size_t prior{}; prior < count; ++prior)
+            {
+                const auto index = placed[prior];
+                const auto slot = table::slot(out.entries[index].name,
+                    seed);
+                out.positions[slot] = static_cast<uint16_t>(add1(index));
+            }
+
+            break;
+        }
+
+        if (seed == limit)
+            return out;
+
+        out.seeds[current] = seed;
+    }
+
+    out.valid = true;
+    return out;
+}
+
+/// Compile-time method name lookup across a set of published interfaces.
+/// Maps a method name to its interface (group, in template order) with one
+/// table probe, independent of the number of methods. Names must be unique
+/// across the interfaces. The terminal protocol resolves the group of each
+/// request once and dispatches it only to the protocol that owns the group,
+/// whose typed dispatcher then performs its own lookup.
+template <typename... Interfaces>
+class method_map
+{
+public:
+    static constexpr auto table = make_method_table<Interfaces...>();
+    static_assert(table.valid, "method names must be unique");
+
+    /// The number of interfaces (groups) within the map.
+    static constexpr size_t groups = sizeof...(Interfaces);
+
+    /// The group ordinal of the interface within the map.
+    template <typename Interface>
+    static constexpr uint8_t group() NOEXCEPT
+    {
+        static_assert((std::is_same_v<Interface, Interfaces> || ...));
+        constexpr std::array<bool, sizeof...(Interfaces)> matches
+        {
+            std::is_same_v<Interface, Interfaces>...
+        };
+
+        return static_cast<uint8_t>(std::distance(matches.begin(),
+            std::find(matches.begin(), matches.end(), true)));
+    }
+
+    /// The entry of the named method, nullptr if not found.
+    static constexpr const method_entry* find(
+        const std::string_view& name) NOEXCEPT
+    {
+        return table.find(name);
+    }
+
+    /// True if the named method is defined by the interface.
+    template <typename Interface>
+    static constexpr bool contains(const std::string_view& name) NOEXCEPT
+    {
+        const auto entry = find(name);
+        return !is_null(entry) && entry->group == group<Interface>();
+    }
+};
+
+BC_POP_WARNING()
+
+} // namespace interface
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -49,7 +49,13 @@ public:
     static constexpr auto slabs_variable = "slabs";
     static constexpr auto buckets_variable = "buckets";
     static constexpr auto collisions_variable = "collisions";
+    static constexpr auto scan_threads_variable = "scan_threads";
+    static constexpr auto scan_memory_variable = "scan_memory";
     static constexpr auto information_variable = "information";
+    static constexpr auto bench_variable = "bench";
+    static constexpr auto bench_threads_variable = "bench_threads";
+    static constexpr auto bench_samples_variable = "bench_samples";
+    static constexpr auto bench_format_variable = "bench_format";
     static constexpr auto get_variable = "get";
     static constexpr auto put_variable = "put";
     static constexpr auto config_variable = "config";
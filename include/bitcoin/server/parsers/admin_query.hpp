@@ -38,6 +38,7 @@ namespace admin
         {
             constexpr auto html = "html";
             constexpr auto json = "json";
+            constexpr auto text = "text";
         }
     }
 }
@@ -19,11 +19,50 @@
 #ifndef LIBBITCOIN_SERVER_PARSERS_BLOCK_STATS_HPP
 #define LIBBITCOIN_SERVER_PARSERS_BLOCK_STATS_HPP
 
+#include <array>
 #include <bitcoin/server/define.hpp>
 
 namespace libbitcoin {
 namespace server {
 
+/// Fixed-width summary of a block, sufficient to produce all getblockstats
+/// statistics without the block or its prevouts. Minimums are normalized to
+/// zero when there are no non-coinbase transactions.
+struct block_stats_record
+{
+    uint64_t height{};
+    uint32_t time{};
+    uint32_t median_time_past{};
+    uint64_t txs{};
+    uint64_t inputs{};
+    uint64_t outputs{};
+    uint64_t utxos{};
+    uint64_t total_output{};
+    uint64_t total_fee{};
+    uint64_t max_fee{};
+    uint64_t min_fee{};
+    uint64_t median_fee{};
+    uint64_t max_fee_rate{};
+    uint64_t min_fee_rate{};
+    uint64_t max_tx_size{};
+    uint64_t min_tx_size{};
+    uint64_t median_tx_size{};
+    uint64_t total_size{};
+    uint64_t total_weight{};
+    uint64_t witness_txs{};
+    uint64_t witness_size{};
+    uint64_t witness_weight{};
+    std::array<uint64_t, 5> fee_rate_percentiles{};
+};
+
+/// Summarize a prevout-populated block (sorts for medians and percentiles).
+BCS_API block_stats_record block_summary(const system::chain::block& block,
+    size_t height, uint32_t median_time_past, bool repeat) NOEXCEPT;
+
+/// All bitcoind getblockstats statistics of a block summary.
+BCS_API network::rpc::object_t block_stats(const block_stats_record& record,
+    const system::hash_digest& hash, uint64_t subsidy) NOEXCEPT;
+
 /// All bitcoind getblockstats statistics of a prevout-populated block.
 BCS_API network::rpc::object_t block_stats(const system::chain::block& block,
     size_t height, uint32_t median_time_past, uint64_t subsidy,
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_SERVER_PARSERS_NATIVE_QUERY_HPP
 #define LIBBITCOIN_SERVER_PARSERS_NATIVE_QUERY_HPP
 
+#include <string_view>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/native_target.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -52,6 +54,12 @@ namespace native
 
 // TODO: move into native namespace.
 
+/// Parse the target query string and accepts into the request's media,
+/// witness, turbo and stop (in place, no allocation). False if the target
+/// is not a valid uri or a query token is invalid.
+BCS_API bool native_query(native_request& out, const std::string_view& target,
+    const network::http::media_types& accepts) NOEXCEPT;
+
 BCS_API bool native_query(network::rpc::request_t& out,
     const network::http::request& request) NOEXCEPT;
 BCS_API bool native_query(network::rpc::request_t& out,
@@ -19,11 +19,77 @@
 #ifndef LIBBITCOIN_SERVER_PARSERS_NATIVE_TARGET_HPP
 #define LIBBITCOIN_SERVER_PARSERS_NATIVE_TARGET_HPP
 
+#include <optional>
+#include <string_view>
 #include <bitcoin/server/define.hpp>
 
 namespace libbitcoin {
 namespace server {
 
+/// Native interface methods, in interface::native_methods order.
+enum class native_method : uint8_t
+{
+    configuration,
+    top,
+    top_subscribe,
+    block,
+    block_header,
+    block_header_context,
+    block_details,
+    block_txs,
+    block_filter,
+    block_filter_hash,
+    block_filter_header,
+    block_tx,
+    block_subscribe,
+    tx,
+    tx_header,
+    tx_details,
+    tx_subscribe,
+    inputs,
+    input,
+    input_script,
+    input_witness,
+    outputs,
+    output,
+    output_script,
+    output_spender,
+    output_spenders,
+    output_subscribe,
+    address,
+    address_confirmed,
+    address_unconfirmed,
+    address_balance,
+    address_subscribe
+};
+
+/// Compact native request, parsed in place from the target (no allocation).
+/// Fields not applicable to the method retain their defaults.
+struct native_request
+{
+    native_method method{};
+    uint8_t version{};
+    uint8_t type{};
+    uint32_t index{};
+    uint32_t position{};
+    std::optional<uint32_t> height{};
+    std::optional<system::hash_digest> hash{};
+
+    /// Set by native_query (from query string or accept header).
+    network::http::media_type media{ network::http::media_type::unknown };
+    bool witness{ true };
+    bool turbo{ true };
+    bool stop{ false };
+};
+
+/// The interface name of the method.
+BCS_API std::string_view to_method(native_method method) NOEXCEPT;
+
+/// Parse the target path (query string ignored) into the request.
+BCS_API code native_target(native_request& out,
+    const std::string_view& path) NOEXCEPT;
+
+/// Parse the target path into a json-rpc named params request model.
 BCS_API code native_target(network::rpc::request_t& out,
     const std::string_view& path) NOEXCEPT;
 
@@ -26,6 +26,9 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_html.hpp>
+#include <bitcoin/server/services/request_metrics.hpp>
+#include <bitcoin/server/services/server_metrics.hpp>
+#include <bitcoin/server/services/stratum_accounts.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -43,7 +46,10 @@ public:
         const network::channel::ptr& channel,
         const options_t& options) NOEXCEPT
       : protocol_html(session, channel, options),
-        network::tracker<protocol_admin>(session->log)
+        network::tracker<protocol_admin>(session->log),
+        accounts_(session->server().accounts()),
+        requests_(session->server().metrics()),
+        counters_(session->server().counters())
     {
     }
 
@@ -78,6 +84,12 @@ protected:
         uint8_t version, uint64_t filter) NOEXCEPT;
     bool handle_get_event_subscribe(const code& ec, interface::event_subscribe,
         uint8_t version, uint64_t filter) NOEXCEPT;
+    bool handle_get_stratum_workers(const code& ec,
+        interface::stratum_workers, uint8_t version) NOEXCEPT;
+    bool handle_get_request_metrics(const code& ec,
+        interface::request_metrics, uint8_t version) NOEXCEPT;
+    bool handle_get_metrics(const code& ec, interface::metrics,
+        uint8_t version) NOEXCEPT;
 
 protected:
     /// Notification event handlers (protocol strand).
@@ -95,13 +107,20 @@ private:
         filter_t& filter) NOEXCEPT;
     static bool update_filter(uint64_t& prior, uint64_t value,
         filter_t& filter) NOEXCEPT;
+    static bool is_acceptable(const std::string& method,
+        network::http::media_type media) NOEXCEPT;
+    std::string store_metrics() const NOEXCEPT;
 
     // These are thread safe.
+    stratum_accounts& accounts_;
+    request_metrics& requests_;
+    server_metrics& counters_;
     filter_t log_state_{};
     filter_t event_state_{};
 
-    // This is protected by strand.
+    // These are protected by strand.
     dispatcher dispatcher_{};
+    network::http::media_type media_{};
 };
 
 } // namespace server
@@ -19,10 +19,14 @@
 #ifndef LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_HPP
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_BITCOIND_HPP
 
+#include <array>
 #include <memory>
+#include <string>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_http.hpp>
+#include <bitcoin/server/services/services.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -30,9 +34,10 @@ namespace server {
 /// Common base for the bitcoind interface subgroup protocols, and the
 /// terminal default responder. Subgroup protocols carry their own interface
 /// dispatchers and are attached to the channel before this class, which is
-/// attached last. A subgroup claims each request it dispatches (via the
-/// channel latch), so default responses are sent here exactly once and only
-/// when no subgroup has claimed the request.
+/// attached last and is routed to each subgroup by its interface group. The
+/// terminal alone receives unclaimed requests, resolves the group of each
+/// once, and dispatches it only to the owning subgroup, otherwise responding
+/// by default.
 class BCS_API protocol_bitcoind
   : public server::protocol_http,
     protected network::tracker<protocol_bitcoind>
@@ -48,16 +53,27 @@ public:
         const options_t& options) NOEXCEPT
       : server::protocol_http(session, channel, options),
         network::tracker<protocol_bitcoind>(session->log),
+        limiter_(session->server().limits().find(options.name)),
+        enforced_(!options.credentials.empty()),
+        metrics_(session->server().metrics()),
+        interface_(options.name),
         p2kh_(session->server_settings().wallet.p2kh_prefix),
         p2sh_(session->server_settings().wallet.p2sh_prefix),
         witness_(session->server_settings().wallet.witness_prefix)
     {
     }
 
+    /// Route requests of the interface group to its owning subgroup protocol
+    /// (terminal only, before start).
+    void route(uint8_t group, const ptr& owner) NOEXCEPT;
+
 protected:
     using post = network::http::method::post;
     using options = network::http::method::options;
 
+    /// Release the routes (owners are attached to the same channel).
+    void stopping(const code& ec) NOEXCEPT override;
+
     /// Terminal dispatch (unclaimed requests only).
     void handle_receive_get(const code& ec,
         const network::http::method::get::cptr& get) NOEXCEPT override;
@@ -68,6 +84,13 @@ protected:
     void dispatch_websocket(
         const network::http::request& request) NOEXCEPT override;
 
+    /// Routed dispatch of a validated request to the owner of its interface
+    /// group, subgroups override (the terminal owns no group).
+    virtual void dispatch_post(const post::cptr& post,
+        const network::rpc::request_t& message) NOEXCEPT;
+    virtual void dispatch_frame(const network::http::request& request,
+        const network::rpc::request_t& message) NOEXCEPT;
+
     /// The method names reported by help (channel-registered on start).
     std::string help_names() const NOEXCEPT;
 
@@ -131,6 +154,14 @@ protected:
         const network::http::request_cptr& request) NOEXCEPT;
     void set_rpc_request(const network::rpc::request_t& message) NOEXCEPT;
 
+    /// Debit the method cost from the requesting client (the authenticated
+    /// user of a post where credentials are enforced, otherwise the peer
+    /// address), false if its tokens are exhausted.
+    /// The query time is debited and the request metrics are recorded when
+    /// the response is sent (requires strand).
+    bool admitted(const std::string& method,
+        const network::http::request& request) NOEXCEPT;
+
     /// Validate a transaction given next block context (node utility).
     code validate_tx(const system::chain::transaction& tx) const NOEXCEPT;
     code broadcast_tx(const system::chain::transaction::cptr& tx) NOEXCEPT;
@@ -145,9 +176,25 @@ private:
     // Obtain cached request and clear cache (requires strand).
     network::http::request_cptr reset_rpc_request() NOEXCEPT;
 
+    // The user name of a basic authorization header, empty if invalid.
+    static std::string to_user(const network::http::request& request) NOEXCEPT;
+
+    // The owner of the method's interface group, this if none (one probe).
+    protocol_bitcoind& owner(const std::string& method) NOEXCEPT;
+
+    // These are thread safe.
+    rate_limiter* const limiter_;
+    const bool enforced_;
+    request_metrics& metrics_;
+    const std::string& interface_;
+
     // These are protected by strand.
     network::rpc::version version_{};
     network::rpc::id_option id_{};
+    std::string method_{};
+    std::string client_{};
+    rate_limiter::clock::time_point started_{};
+    std::array<ptr, interface::bitcoind_map::groups> routes_{};
 
 protected:
     // These are thread safe.
@@ -23,6 +23,9 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind_dispatch.hpp>
+#include <bitcoin/server/services/block_stats_cache.hpp>
+#include <bitcoin/server/services/block_waiters.hpp>
+#include <bitcoin/server/services/chain_tx_index.hpp>
 
 namespace libbitcoin {
 
@@ -47,11 +50,16 @@ public:
         const network::channel::ptr& channel,
         const options_t& options) NOEXCEPT
       : protocol_bitcoind_dispatch<rpc_interface>(session, channel, options),
-        network::tracker<protocol_bitcoind_blockchain>(session->log)
+        network::tracker<protocol_bitcoind_blockchain>(session->log),
+        stats_cache_(session->server().stats_cache()),
+        tx_index_(session->server().tx_index()),
+        waiters_(session->server().waiters()),
+        wait_timer_(channel->service().get_executor())
     {
     }
 
     void start() NOEXCEPT override;
+    void stopping(const code& ec) NOEXCEPT override;
 
 protected:
     /// Handlers.
@@ -117,11 +125,13 @@ protected:
     bool handle_scan_blocks(const code& ec,
         rpc_interface::scan_blocks) NOEXCEPT;
     bool handle_wait_for_block(const code& ec,
-        rpc_interface::wait_for_block) NOEXCEPT;
+        rpc_interface::wait_for_block, const std::string& blockhash,
+        double timeout) NOEXCEPT;
     bool handle_wait_for_block_height(const code& ec,
-        rpc_interface::wait_for_block_height) NOEXCEPT;
+        rpc_interface::wait_for_block_height, double height,
+        double timeout) NOEXCEPT;
     bool handle_wait_for_new_block(const code& ec,
-        rpc_interface::wait_for_new_block) NOEXCEPT;
+        rpc_interface::wait_for_new_block, double timeout) NOEXCEPT;
     bool handle_get_mempool_ancestors(const code& ec,
         rpc_interface::get_mempool_ancestors) NOEXCEPT;
     bool handle_get_mempool_cluster(const code& ec,
@@ -138,6 +148,28 @@ protected:
         rpc_interface::get_tx_spending_prevout) NOEXCEPT;
     bool handle_import_mempool(const code& ec,
         rpc_interface::import_mempool) NOEXCEPT;
+
+    /// Long-poll waits (a parked request is released or times out).
+    void park_wait(block_waiters::key id, uint32_t milliseconds) NOEXCEPT;
+    void handle_wait_released(const code& ec,
+        size_t sequence) NOEXCEPT;
+    void handle_wait_timer(const network::boost_code& ec,
+        size_t sequence) NOEXCEPT;
+    void do_wait_released(size_t sequence) NOEXCEPT;
+    void do_wait_expired(size_t sequence) NOEXCEPT;
+    void send_top() NOEXCEPT;
+
+private:
+    // These are thread safe.
+    block_stats_cache& stats_cache_;
+    chain_tx_index& tx_index_;
+    block_waiters& waiters_;
+
+    // These are protected by strand.
+    bool waiting_{};
+    size_t wait_sequence_{};
+    block_waiters::key wait_id_{};
+    boost::asio::steady_timer wait_timer_;
 };
 
 } // namespace server
@@ -27,9 +27,10 @@ namespace libbitcoin {
 namespace server {
 
 /// Interface subgroup dispatch, the common shape of the bitcoind subgroup
-/// protocols. Carries the subgroup interface dispatcher and claims each
-/// request defined by the interface, silently deferring all others to the
-/// terminal responder (protocol_bitcoind, attached last). All subgroups are
+/// protocols. Carries the subgroup interface dispatcher and owns the group of
+/// the interface. Requests are not received from the channel, they are
+/// resolved and routed here by the terminal responder (protocol_bitcoind,
+/// attached last), only when defined by the interface. All subgroups are
 /// explicitly instantiated (with their dispatchers) in the implementation
 /// translation unit, isolating the dispatch metaprogramming there.
 template <typename Interface>
@@ -39,7 +40,11 @@ class protocol_bitcoind_dispatch
 public:
     using rpc_dispatcher = network::rpc::dispatcher<Interface>;
 
-    /// Subscribe to the post and websocket transports of the interface.
+    /// The interface group routed here by the terminal responder.
+    static constexpr uint8_t group =
+        interface::bitcoind_map::group<Interface>();
+
+    /// Publish the interface method names (requests are routed).
     void start() NOEXCEPT override;
 
     void stopping(const code& ec) NOEXCEPT override;
@@ -52,13 +57,13 @@ protected:
     {
     }
 
-    /// The post transport of the interface subgroup.
-    void handle_receive_post(const code& ec,
-        const post::cptr& post) NOEXCEPT override;
+    /// The post transport of the interface subgroup (routed).
+    void dispatch_post(const post::cptr& post,
+        const network::rpc::request_t& message) NOEXCEPT override;
 
-    /// The websocket transport of the interface subgroup.
-    void dispatch_websocket(
-        const network::http::request& request) NOEXCEPT override;
+    /// The websocket transport of the interface subgroup (routed).
+    void dispatch_frame(const network::http::request& request,
+        const network::rpc::request_t& message) NOEXCEPT override;
 
     /// Subgroup handler wiring (dispatcher subscription).
     template <class Derived, typename Method, typename... Args>
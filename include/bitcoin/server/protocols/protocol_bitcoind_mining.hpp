@@ -23,6 +23,8 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind_dispatch.hpp>
+#include <bitcoin/server/services/block_templates.hpp>
+#include <bitcoin/server/services/block_waiters.hpp>
 
 namespace libbitcoin {
 
@@ -47,11 +49,14 @@ public:
         const network::channel::ptr& channel,
         const options_t& options) NOEXCEPT
       : protocol_bitcoind_dispatch<rpc_interface>(session, channel, options),
-        network::tracker<protocol_bitcoind_mining>(session->log)
+        network::tracker<protocol_bitcoind_mining>(session->log),
+        templates_(session->server().templates()),
+        waiters_(session->server().waiters())
     {
     }
 
     void start() NOEXCEPT override;
+    void stopping(const code& ec) NOEXCEPT override;
 
 protected:
     /// Handlers.
@@ -61,15 +66,37 @@ protected:
     bool handle_get_mining_info(const code& ec,
         rpc_interface::get_mining_info) NOEXCEPT;
     bool handle_submit_block(const code& ec,
-        rpc_interface::submit_block) NOEXCEPT;
+        rpc_interface::submit_block, const std::string& hexdata,
+        const std::string&) NOEXCEPT;
     bool handle_submit_header(const code& ec,
         rpc_interface::submit_header) NOEXCEPT;
     bool handle_get_block_template(const code& ec,
-        rpc_interface::get_block_template) NOEXCEPT;
+        rpc_interface::get_block_template,
+        const network::rpc::object_t& template_request) NOEXCEPT;
     bool handle_get_prioritised_transactions(const code& ec,
         rpc_interface::get_prioritised_transactions) NOEXCEPT;
     bool handle_prioritise_transaction(const code& ec,
         rpc_interface::prioritise_transaction) NOEXCEPT;
+
+    /// Template long-poll (a parked request is released by a new top).
+    void handle_poll_released(const code& ec, size_t sequence) NOEXCEPT;
+    void do_poll_released(size_t sequence) NOEXCEPT;
+
+    /// Templates and submitted blocks.
+    block_template::cptr current_template() NOEXCEPT;
+    void handle_organize(const code& ec, size_t height) NOEXCEPT;
+    void complete_submit_block(const code& ec) NOEXCEPT;
+    void send_template(const block_template& value) NOEXCEPT;
+
+private:
+    // These are thread safe.
+    block_templates& templates_;
+    block_waiters& waiters_;
+
+    // These are protected by strand.
+    bool waiting_{};
+    size_t wait_sequence_{};
+    block_waiters::key wait_id_{};
 };
 
 } // namespace server
@@ -27,6 +27,7 @@
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_bitcoind.hpp>
+#include <bitcoin/server/services/services.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -49,9 +50,13 @@ public:
         const options_t& options) NOEXCEPT
       : server::protocol_bitcoind(session, channel, options),
         network::tracker<protocol_btcd>(session->log),
+        writer_(std::dynamic_pointer_cast<channel_t>(channel)),
         options_(options),
         turbo_(session->database_settings().turbo),
-        notification_strand_(channel->service().get_executor())
+        notices_(session->server().notices()),
+        hub_(session->server().hub()),
+        notification_strand_(session->server().pools().service(options.name,
+            channel->service()).get_executor())
     {
     }
 
@@ -129,6 +134,10 @@ protected:
     void send_notification(const std::string& method,
         network::rpc::array_t&& params, size_t size_hint) NOEXCEPT;
 
+    /// Send a notification serialized once for all subscribers, written
+    /// from the shared buffer (requires strand).
+    void send_shared(const channel_t::shared_text& notification) NOEXCEPT;
+
 protected:
     using point = system::chain::point;
     using hash_digest = system::hash_digest;
@@ -168,7 +177,7 @@ protected:
 
     void do_connected(node::header_t link) NOEXCEPT;
     void do_disconnected(node::header_t link) NOEXCEPT;
-    void notify_connected(const header_cptr& header, size_t height,
+    void notify_connected(const block_notification::cptr& notice,
         const array_ptr& txs) NOEXCEPT;
     void notify_disconnected(const header_cptr& header,
         size_t height) NOEXCEPT;
@@ -200,16 +209,26 @@ private:
             BIND_SAFE(BIND_SHARED(method, args)));
     }
 
+    // Chase events required by block notifications.
+    static constexpr chase_hub::events block_events =
+        chase_hub::organized | chase_hub::reorganized;
+
     // These are thread safe.
+    const channel_t::ptr writer_;
     const options_t& options_;
     const bool turbo_;
+    block_notifications& notices_;
+    chase_hub& hub_;
     std::atomic_bool stopping_{};
     std::atomic_bool subscribed_blocks_{};
 
+    // This is protected by strand (set upon start, reset upon stop).
+    chase_hub::subscriber_ptr subscriber_{};
+
     // This is protected by strand.
     btcd_dispatcher btcd_dispatcher_{};
 
-    // This is thread safe, uses network threadpool.
+    // This is thread safe, uses interface pool or network threadpool.
     network::asio::strand notification_strand_;
 
     // These are protected by notification strand.
@@ -21,11 +21,13 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/parsers/parsers.hpp>
 #include <bitcoin/server/protocols/protocol_rpc.hpp>
+#include <bitcoin/server/services/services.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -46,8 +48,15 @@ public:
         turbo_(session->database_settings().turbo),
         p2kh_(session->server_settings().wallet.p2kh_prefix),
         p2sh_(session->server_settings().wallet.p2sh_prefix),
+        deadlines_(query_deadline::parse(options.query_deadlines)),
+        notices_(session->server().notices()),
+        hub_(session->server().hub()),
+        transactions_(transaction_batch::duration{
+            session->server_settings().batches.electrum.window_msecs },
+            session->server_settings().batches.electrum.maximum_batch),
         channel_(std::dynamic_pointer_cast<channel_t>(channel)),
-        notification_strand_(channel_->service().get_executor()),
+        notification_strand_(session->server().pools().service(options.name,
+            channel_->service()).get_executor()),
         network::tracker<protocol_electrum>(session->log)
     {
     }
@@ -242,10 +251,14 @@ protected:
     void get_mempool(const hash_digest& hash) NOEXCEPT;
     void list_unspent(const hash_digest& hash) NOEXCEPT;
 
-    void do_get_balance(const hash_digest& hash) NOEXCEPT;
-    void do_get_history(const hash_digest& hash) NOEXCEPT;
-    void do_get_mempool(const hash_digest& hash) NOEXCEPT;
-    void do_list_unspent(const hash_digest& hash) NOEXCEPT;
+    void do_get_balance(const hash_digest& hash,
+        const query_deadline::ptr& deadline) NOEXCEPT;
+    void do_get_history(const hash_digest& hash,
+        const query_deadline::ptr& deadline) NOEXCEPT;
+    void do_get_mempool(const hash_digest& hash,
+        const query_deadline::ptr& deadline) NOEXCEPT;
+    void do_list_unspent(const hash_digest& hash,
+        const query_deadline::ptr& deadline) NOEXCEPT;
 
     void complete_get_balance(const code& ec, uint64_t confirmed, int64_t unconfirmed) NOEXCEPT;
     void complete_get_history(const code& ec, const histories& histories) NOEXCEPT;
@@ -264,6 +277,13 @@ protected:
     void do_scripthash(node::header_t link) NOEXCEPT;
     void do_reorganized(node::header_t link) NOEXCEPT;
 
+    /// Release the subscriber upon stop (it binds this protocol).
+    void do_release() NOEXCEPT;
+
+    /// Accumulate a transaction event, statuses are recomputed per batch.
+    void batch_transaction(node::transaction_t link) NOEXCEPT;
+    void do_transactions() NOEXCEPT;
+
     /// Address.
     /// -----------------------------------------------------------------------
 
@@ -311,11 +331,22 @@ protected:
         return options_;
     }
 
+    /// Start the deadline of a store query of the method in service
+    /// (requires strand).
+    query_deadline::ptr start_query() NOEXCEPT;
+
 private:
     // Aliases.
     using array_t = network::rpc::array_t;
     using object_t = network::rpc::object_t;
 
+    // Chase events required by each subscription type.
+    static constexpr chase_hub::events header_events = chase_hub::organized;
+    static constexpr chase_hub::events outpoint_events =
+        chase_hub::organized | chase_hub::transaction;
+    static constexpr chase_hub::events address_events =
+        chase_hub::organized | chase_hub::transaction | chase_hub::reorganized;
+
     // Post to notification strand.
     template <class Derived, typename Method, typename... Args>
     inline auto notify(Method&& method, Args&&... args) NOEXCEPT
@@ -359,6 +390,10 @@ private:
     const bool turbo_;
     const uint8_t p2kh_;
     const uint8_t p2sh_;
+    const query_deadline::timeouts deadlines_;
+    block_notifications& notices_;
+    chase_hub& hub_;
+    transaction_batch transactions_;
     std::atomic_bool stopping_{};
     std::atomic_bool subscribed_height_{};
     std::atomic_bool subscribed_header_{};
@@ -368,9 +403,16 @@ private:
     // This is mostly thread safe, and used in a thread safe manner.
     const channel_t::ptr channel_;
 
-    // This is thread safe, uses network threadpool.
+    // This is thread safe, uses interface pool or network threadpool.
     network::asio::strand notification_strand_;
 
+    // This is set upon start, thread safe thereafter, and reset upon stop
+    // by the notification strand (its last reader).
+    chase_hub::subscriber_ptr subscriber_{};
+
+    // This is protected by strand.
+    std::vector<query_deadline::ptr> queries_{};
+
     // These are protected by notification strand.
     std::map<point, outpoint_subscription> outpoint_subscriptions_{};
     std::map<hash_digest, address_subscription> address_subscriptions_{};
@@ -19,9 +19,13 @@
 #ifndef LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_HTML_HPP
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_HTML_HPP
 
+#include <chrono>
+#include <string>
+#include <string_view>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/protocols/protocol_http.hpp>
+#include <bitcoin/server/services/request_metrics.hpp>
 #include <bitcoin/server/settings.hpp>
 
 namespace libbitcoin {
@@ -42,6 +46,7 @@ protected:
         const options_t& options) NOEXCEPT
       : server::protocol_http(session, channel, options),
         options_(options),
+        metrics_(session->server().metrics()),
         network::tracker<protocol_html>(session->log)
     {
     }
@@ -58,6 +63,11 @@ protected:
     virtual void dispatch_embedded(
         const network::http::request& request) NOEXCEPT;
 
+    /// Time the dispatched interface method, recorded by the next sender. A
+    /// request without a sent response (failure) is recorded untimed upon
+    /// the next request (requires strand).
+    void start_request(const std::string_view& method) NOEXCEPT;
+
     /// Senders.
     virtual void send_json(boost::json::value&& model, size_t size_hint,
         const network::http::request& request={}) NOEXCEPT;
@@ -94,8 +104,18 @@ protected:
         const std::string& target = "/") const NOEXCEPT;
 
 private:
-    // This is thread safe.
+    using clock = std::chrono::steady_clock;
+
+    // Record the started request, if any (requires strand).
+    void complete_request(size_t bytes) NOEXCEPT;
+
+    // These are thread safe.
     const options_t& options_;
+    request_metrics& metrics_;
+
+    // These are protected by strand.
+    std::string method_{};
+    clock::time_point started_{};
 };
 
 } // namespace server
@@ -25,7 +25,9 @@
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
+#include <bitcoin/server/parsers/parsers.hpp>
 #include <bitcoin/server/protocols/protocol_html.hpp>
+#include <bitcoin/server/services/services.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -37,14 +39,18 @@ class BCS_API protocol_native
 public:
     typedef std::shared_ptr<protocol_native> ptr;
     using interface = server::interface::native;
-    using dispatcher = network::rpc::dispatcher<interface>;
 
     inline protocol_native(const auto& session,
         const network::channel::ptr& channel,
         const options_t& options) NOEXCEPT
       : protocol_html(session, channel, options),
         turbo_(session->database_settings().turbo),
-        notification_strand_(channel->service().get_executor()),
+        notification_strand_(session->server().pools().service(options.name,
+            channel->service()).get_executor()),
+        hub_(session->server().hub()),
+        transactions_(transaction_batch::duration{
+            session->server_settings().batches.native.window_msecs },
+            session->server_settings().batches.native.maximum_batch),
         network::tracker<protocol_native>(session->log)
     {
     }
@@ -53,18 +59,15 @@ public:
     void stopping(const code& ec) NOEXCEPT override;
 
 protected:
-    template <class Derived, typename Method, typename... Args>
-    inline void subscribe(Method&& method, Args&&... args) NOEXCEPT
-    {
-        dispatcher_.subscribe(BIND_SHARED(method, args));
-    }
-
     /// Dispatch.
     bool try_dispatch_object(
         const network::http::request& request) NOEXCEPT override;
     void dispatch_websocket(
         const network::http::request& request) NOEXCEPT override;
 
+    /// Invoke the interface handler for a parsed request.
+    void dispatch(const native_request& model) NOEXCEPT;
+
 
     /// Event handlers.
     /// -----------------------------------------------------------------------
@@ -184,7 +187,12 @@ protected:
     /// -----------------------------------------------------------------------
     void do_top(node::header_t link, media_type media) NOEXCEPT;
     void do_block(node::header_t link, media_type media) NOEXCEPT;
-    void do_transaction(node::transaction_t link, media_type media) NOEXCEPT;
+    void do_transactions(const transaction_batch::links& links,
+        media_type media) NOEXCEPT;
+
+    /// Accumulate a transaction event, notified as one array per batch.
+    void batch_transaction(node::transaction_t link) NOEXCEPT;
+    void drain_transactions() NOEXCEPT;
 
 private:
     static constexpr uint8_t text = to_value(media_type::text_plain);
@@ -251,14 +259,29 @@ private:
     database::header_link to_header(const std::optional<uint32_t>& height,
         const std::optional<system::hash_cptr>& hash) NOEXCEPT;
 
-    // These are thread safe, strand uses network threadpool.
+    /// Chase events required by each subscription type.
+    static constexpr chase_hub::events top_events =
+        chase_hub::block | chase_hub::reorganized;
+    static constexpr chase_hub::events block_events = chase_hub::block;
+    static constexpr chase_hub::events tx_events = chase_hub::transaction;
+
+    /// Join or leave the chase event lists upon a subscription change.
+    void update_events(media_type prior, media_type value,
+        chase_hub::events events) NOEXCEPT;
+
+    // These are thread safe, strand uses interface pool or network threadpool.
     network::asio::strand notification_strand_;
     const bool turbo_;
+    chase_hub& hub_;
+    transaction_batch transactions_;
+
+    // This is protected by strand (set upon start, reset upon stop).
+    chase_hub::subscriber_ptr subscriber_{};
 
     // These are thread safe.
     std::atomic_bool stopping_{};
 
-    // Unconditional (all).
+    // Unconditional (all), chase events joined only while subscribed.
     std::atomic<media_type> top_subscribe_{ media_type::unknown };
     std::atomic<media_type> block_subscribe_{ media_type::unknown };
     std::atomic<media_type> tx_subscribe_{ media_type::unknown };
@@ -268,9 +291,6 @@ private:
 
     // TODO: map of scripthashes (notify on instances).
     std::atomic_bool address_subscribe_{};
-
-    // This is protected by strand.
-    dispatcher dispatcher_{};
 };
 
 } // namespace server
@@ -19,10 +19,17 @@
 #ifndef LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_RPC_HPP
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_RPC_HPP
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/protocols/protocol.hpp>
+#include <bitcoin/server/services/executor_pools.hpp>
+#include <bitcoin/server/services/rate_limits.hpp>
+#include <bitcoin/server/services/request_metrics.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -43,9 +50,98 @@ protected:
         const network::channel::ptr& channel, const options_t& options) NOEXCEPT
       : server::protocol(session, channel),
         network::protocol_rpc<Channel>(session, channel, options),
-        network::tracker<server::protocol_rpc<Channel>>(session->log)
+        network::tracker<server::protocol_rpc<Channel>>(session->log),
+        writer_(std::dynamic_pointer_cast<Channel>(channel)),
+        pool_(session->server().pools().find(options.name)),
+        limiter_(session->server().limits().find(options.name)),
+        metrics_(session->server().metrics()),
+        interface_(options.name),
+        client_(is_null(limiter_) ? std::string{} :
+            this->authority().ip().to_string())
     {
     }
+
+    /// Post to the dedicated interface pool, false if none (use PARALLEL).
+    template <typename Handler>
+    inline bool pooled(Handler&& handler) NOEXCEPT
+    {
+        if (is_null(pool_))
+            return false;
+
+        boost::asio::post(*pool_, std::forward<Handler>(handler));
+        return true;
+    }
+
+    /// Debit the cost of the method in service from the peer address, false
+    /// if exhausted (requires strand).
+    inline bool admitted() NOEXCEPT
+    {
+        return is_null(limiter_) || limiter_->admit(client_, writer_->method());
+    }
+
+    /// Debit the peer address by the measured cost of a completed query.
+    inline void charge(size_t rows,
+        const rate_limiter::clock::duration& elapsed) NOEXCEPT
+    {
+        if (!is_null(limiter_))
+            limiter_->charge(client_, rows, elapsed);
+    }
+
+    /// Senders (shadow the base senders to record the request in service).
+    inline void send_result(network::rpc::value_t&& result,
+        size_t size_hint, auto&&... args) NOEXCEPT
+    {
+        complete_request(size_hint, false);
+        network::protocol_rpc<Channel>::send_result(std::move(result),
+            size_hint, std::forward<decltype(args)>(args)...);
+    }
+
+    inline void send_code(const code& ec, auto&&... args) NOEXCEPT
+    {
+        complete_request(two * ec.message().size(), true);
+        network::protocol_rpc<Channel>::send_code(ec,
+            std::forward<decltype(args)>(args)...);
+    }
+
+    /// Send a notification serialized once for all channels, written from
+    /// the shared buffer (requires strand). A failed write stops the channel.
+    inline void send_shared(
+        const typename Channel::shared_text& notification) NOEXCEPT
+    {
+        BC_ASSERT(this->stranded());
+        writer_->write_shared(notification,
+            [channel = writer_](const code& ec) NOEXCEPT
+            {
+                if (ec)
+                    channel->stop(ec);
+            });
+    }
+
+private:
+    using clock = typename Channel::clock;
+
+    // Record the request in service, if any (requires strand).
+    // The channel sets the request as it is dispatched, from its method.
+    inline void complete_request(size_t bytes, bool error) NOEXCEPT
+    {
+        typename clock::time_point started{};
+        if (!writer_->take_request(method_, started))
+            return;
+
+        metrics_.record(interface_, method_, clock::now() - started, bytes,
+            error);
+    }
+
+    // These are thread safe.
+    const typename Channel::ptr writer_;
+    executor_pools::service_t* const pool_;
+    rate_limiter* const limiter_;
+    request_metrics& metrics_;
+    const std::string& interface_;
+    const std::string client_;
+
+    // This is protected by strand (retains capacity across requests).
+    std::string method_{};
 };
 
 #define SUBSCRIBE_RPC(...) SUBSCRIBE_CHANNEL(void, __VA_ARGS__)
@@ -20,10 +20,19 @@
 #define LIBBITCOIN_SERVER_PROTOCOLS_PROTOCOL_STRATUM_V1_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <bitcoin/server/channels/channels.hpp>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_rpc.hpp>
+#include <bitcoin/server/services/block_templates.hpp>
+#include <bitcoin/server/services/chase_hub.hpp>
+#include <bitcoin/server/services/share_validator.hpp>
+#include <bitcoin/server/services/stratum_accounts.hpp>
+#include <bitcoin/server/services/stratum_jobs.hpp>
+#include <bitcoin/server/services/vardiff.hpp>
 
 namespace libbitcoin {
 namespace server {
@@ -40,11 +49,18 @@ public:
         const network::channel::ptr& channel,
         const options_t& options) NOEXCEPT
       : protocol_rpc<channel_stratum_v1>(session, channel, options),
-        network::tracker<protocol_stratum_v1>(session->log)
+        network::tracker<protocol_stratum_v1>(session->log),
+        templates_(session->server().templates()),
+        jobs_(session->server().jobs()),
+        accounts_(session->server().accounts()),
+        validator_(session->server().validator()),
+        hub_(session->server().hub()),
+        vardiff_(session->server_settings().stratum_v1)
     {
     }
 
     void start() NOEXCEPT override;
+    void stopping(const code& ec) NOEXCEPT override;
 
 protected:
     /// Handlers (client requests).
@@ -57,7 +73,7 @@ protected:
     bool handle_mining_submit(const code& ec,
         rpc_interface::mining_submit, const std::string& worker_name,
         const std::string& job_id, const std::string& extranonce2,
-        double ntime, const std::string& nonce) NOEXCEPT;
+        const std::string& ntime, const std::string& nonce) NOEXCEPT;
     bool handle_mining_extranonce_subscribe(const code& ec,
         rpc_interface::mining_extranonce_subscribe) NOEXCEPT;
     bool handle_mining_extranonce_unsubscribe(const code& ec,
@@ -84,6 +100,50 @@ protected:
     bool handle_client_rejected(const code& ec,
         rpc_interface::client_rejected, const std::string& job_id,
         const std::string& reject_reason) NOEXCEPT;
+
+    /// Chase events (notifies the job of a new template).
+    bool handle_chase(const code& ec, node::chase event_,
+        node::event_value value) NOEXCEPT;
+    void do_organized() NOEXCEPT;
+
+    /// Share validation (hashing is performed on the threadpool).
+    void do_validate() NOEXCEPT;
+    void handle_share(const code& ec, const system::hash_digest& hash,
+        const system::chain::block::cptr& block, uint32_t difficulty,
+        const share_counter::ptr& counter) NOEXCEPT;
+    void complete_submit(const code& ec, const system::hash_digest& hash,
+        uint32_t difficulty, const share_counter::ptr& counter) NOEXCEPT;
+    void handle_organize(const code& ec, size_t height,
+        const system::hash_digest& hash,
+        const share_counter::ptr& counter) NOEXCEPT;
+
+    /// Jobs.
+    stratum_job::cptr current_job() NOEXCEPT;
+    void notify_job() NOEXCEPT;
+    void send_job(const stratum_job::cptr& job) NOEXCEPT;
+    void notify_difficulty() NOEXCEPT;
+
+private:
+    // Chase events required by job notifications.
+    static constexpr chase_hub::events job_events = chase_hub::organized;
+
+    // These are thread safe.
+    block_templates& templates_;
+    stratum_jobs& jobs_;
+    stratum_accounts& accounts_;
+    share_validator& validator_;
+    chase_hub& hub_;
+
+    // These are protected by strand.
+    chase_hub::subscriber_ptr subscriber_{};
+    bool subscribed_{};
+    uint32_t extranonce1_{};
+    vardiff vardiff_;
+    uint32_t grace_{ vardiff_.difficulty() };
+    stratum_job::cptr job_{};
+    stratum_jobs::midstate prefix_{};
+    std::unordered_map<std::string, share_counter::ptr> workers_{};
+    std::unordered_set<system::hash_digest> shares_{};
 };
 
 } // namespace server
@@ -19,8 +19,11 @@
 #ifndef LIBBITCOIN_SERVER_FULL_NODE_HPP
 #define LIBBITCOIN_SERVER_FULL_NODE_HPP
 
+#include <atomic>
+#include <thread>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/services/services.hpp>
 #include <bitcoin/server/sessions/sessions.hpp>
 
 namespace libbitcoin {
@@ -50,6 +53,10 @@ public:
     /// Run the node (inbound/outbound services).
     void run(result_handler&& handler) NOEXCEPT override;
 
+    /// Close the node, then stop and join executor pools and the tx index
+    /// seeder (blocking).
+    void close() NOEXCEPT override;
+
     /// Properties.
     /// -----------------------------------------------------------------------
 
@@ -64,6 +71,48 @@ public:
     ////const node::settings& node_settings() const NOEXCEPT override;
     virtual const server::settings& server_settings() const NOEXCEPT;
 
+    /// Services (server-wide state shared by protocols of all sessions).
+    /// -----------------------------------------------------------------------
+
+    /// Lazily-populated getblockstats summaries.
+    block_stats_cache& stats_cache() NOEXCEPT;
+
+    /// Cumulative confirmed tx counts by height.
+    chain_tx_index& tx_index() NOEXCEPT;
+
+    /// Parked long-poll block requests.
+    block_waiters& waiters() NOEXCEPT;
+
+    /// Shared notifications of recently organized blocks.
+    block_notifications& notices() NOEXCEPT;
+
+    /// Chaser events by type, to channels that subscribe to them.
+    chase_hub& hub() NOEXCEPT;
+
+    /// Current block template over the confirmed top.
+    block_templates& templates() NOEXCEPT;
+
+    /// Current stratum v1 job over the current template.
+    stratum_jobs& jobs() NOEXCEPT;
+
+    /// Stratum share counters by worker.
+    stratum_accounts& accounts() NOEXCEPT;
+
+    /// Batched stratum share hashing.
+    share_validator& validator() NOEXCEPT;
+
+    /// Dedicated threads by interface.
+    executor_pools& pools() NOEXCEPT;
+
+    /// Client token buckets by interface.
+    rate_limits& limits() NOEXCEPT;
+
+    /// Request counters and latency histograms by interface and method.
+    request_metrics& metrics() NOEXCEPT;
+
+    /// Fired event and accepted connection counters.
+    server_metrics& counters() NOEXCEPT;
+
 protected:
     /// Session attachments.
     /// -----------------------------------------------------------------------
@@ -82,16 +131,40 @@ protected:
     void do_run(const result_handler& handler) NOEXCEPT override;
 
 private:
-    void start_admin(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_native(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_bitcoind(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_btcd(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_electrum(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_stratum_v1(const code& ec, const result_handler& handler) NOEXCEPT;
-    void start_stratum_v2(const code& ec, const result_handler& handler) NOEXCEPT;
+    struct startup;
+    typedef std::shared_ptr<startup> startup_ptr;
+
+    void start_sessions(const code& ec,
+        const result_handler& handler) NOEXCEPT;
+    void handle_session(const code& ec, uint8_t event_,
+        const network::logger::time& start,
+        const startup_ptr& join) NOEXCEPT;
+    bool handle_chase(const code& ec, node::chase event_,
+        node::event_value value) NOEXCEPT;
+    void handle_subscribed(const code& ec, node::object_key key) NOEXCEPT;
+    void stop_seeder() NOEXCEPT;
 
     // This is thread safe.
     const configuration& config_;
+
+    // These are thread safe.
+    block_stats_cache stats_cache_;
+    chain_tx_index tx_index_{};
+    block_waiters waiters_{};
+    block_notifications notices_{};
+    chase_hub hub_{};
+    block_templates templates_{};
+    stratum_jobs jobs_;
+    stratum_accounts accounts_;
+    share_validator validator_;
+    executor_pools pools_;
+    rate_limits limits_;
+    request_metrics metrics_{};
+    server_metrics::ptr counters_;
+
+    // These are thread safe (seeder is started on and joined by one thread).
+    std::atomic_bool closed_{};
+    std::thread seeder_{};
 };
 
 } // namespace server
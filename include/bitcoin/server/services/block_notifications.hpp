@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_BLOCK_NOTIFICATIONS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_BLOCK_NOTIFICATIONS_HPP
+
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Immutable notifications of an organized block, identical for all
+/// subscribed channels, built once and shared by all channels.
+struct BCS_API block_notification
+{
+    using cptr = std::shared_ptr<const block_notification>;
+
+    database::header_link link{};
+    size_t height{};
+    system::chain::header::cptr header{};
+
+    /// Wire header as base16.
+    std::string header_text{};
+
+    /// blockchain.numblocks.subscribe params (electrum singleton).
+    network::rpc::value_t numblocks{};
+
+    /// blockchain.headers.subscribe notification (electrum), serialized
+    /// json-rpc 2.0 request (newline delimited).
+    std::string headers{};
+
+    /// blockconnected notification (btcd), serialized json-rpc 1.0 request.
+    std::string connected{};
+};
+
+/// Thread safe, server-wide.
+/// Notifications of recently organized blocks, built by the first channel to
+/// observe the block and then written by reference by all subscribed
+/// channels, so that the store reads and serializations are not repeated per
+/// channel.
+class BCS_API block_notifications
+{
+public:
+    DELETE_COPY_MOVE(block_notifications);
+
+    /// Number of recent blocks retained (channels observe events late).
+    static constexpr size_t history = 4;
+
+    block_notifications() NOEXCEPT = default;
+
+    /// The notifications of the block, built if not recent (null if the
+    /// header or its height is not found).
+    block_notification::cptr get(const node::query& query,
+        const database::header_link& link) NOEXCEPT;
+
+    /// Build the notifications of the header at height.
+    static block_notification::cptr build(const database::header_link& link,
+        size_t height, const system::chain::header::cptr& header) NOEXCEPT;
+
+private:
+    block_notification::cptr find(
+        const database::header_link& link) const NOEXCEPT;
+
+    // These are protected by mutex.
+    std::deque<block_notification::cptr> recent_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
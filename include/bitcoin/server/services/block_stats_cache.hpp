@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_BLOCK_STATS_CACHE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_BLOCK_STATS_CACHE_HPP
+
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/block_stats.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide.
+/// Direct-mapped table of fixed-width getblockstats records, indexed by
+/// height modulo capacity and lazily populated upon first request. Each slot
+/// retains the header link of its block, so a reorganized height misses (and
+/// is then overwritten) without the need for chase event invalidation.
+class BCS_API block_stats_cache
+{
+public:
+    DELETE_COPY_MOVE(block_stats_cache);
+
+    /// Zero capacity disables the cache (all lookups miss).
+    block_stats_cache(size_t capacity) NOEXCEPT;
+
+    /// Obtain the record of the block at link (at height), false if missed.
+    bool get(block_stats_record& out, size_t height,
+        const database::header_link& link) const NOEXCEPT;
+
+    /// Store the record of the block at link (at record.height).
+    void put(const database::header_link& link,
+        const block_stats_record& record) NOEXCEPT;
+
+    /// The number of slots in the table.
+    size_t capacity() const NOEXCEPT;
+
+private:
+    struct slot
+    {
+        database::header_link link{};
+        block_stats_record record{};
+    };
+
+    // These are protected by mutex.
+    std::vector<slot> slots_;
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
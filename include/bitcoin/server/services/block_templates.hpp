@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_BLOCK_TEMPLATES_HPP
+#define LIBBITCOIN_SERVER_SERVICES_BLOCK_TEMPLATES_HPP
+
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Immutable unconfirmed transaction, serialized (with witness) once upon
+/// arrival and shared by the pool and all templates that select it.
+struct BCS_API template_tx
+{
+    using cptr = std::shared_ptr<const template_tx>;
+
+    system::data_chunk data{};
+    system::hash_digest txid{};
+    system::hash_digest wtxid{};
+    uint64_t fee{};
+    size_t weight{};
+    size_t sigops{};
+
+    /// Unconfirmed (pooled) parent txids, all other prevouts are confirmed.
+    system::hashes parents{};
+
+    /// Spent outpoints, for conflict detection among pooled transactions.
+    system::chain::points spends{};
+};
+
+using template_txs = std::vector<template_tx::cptr>;
+
+/// Immutable block template over a parent block (the confirmed top).
+/// Transactions are in dependency order (parents precede children) and
+/// exclude the coinbase. The coinbase value includes their fees.
+struct BCS_API block_template
+{
+    using ptr = std::shared_ptr<block_template>;
+    using cptr = std::shared_ptr<const block_template>;
+
+    node::header_t parent{};
+    system::hash_digest previous{};
+    size_t height{};
+    uint32_t version{};
+    uint32_t bits{};
+    uint32_t mintime{};
+    uint64_t coinbase_value{};
+    bool segwit{};
+    system::hash_digest witness_commitment{};
+    uint64_t sequence{};
+    template_txs transactions{};
+    uint64_t fees{};
+    size_t weight{};
+    size_t sigops{};
+};
+
+/// Thread safe, server-wide.
+/// The current block template, built once per confirmed top (deduplicated by
+/// parent link). Building is eager upon organization, so that the template is
+/// ready before any (long-poll) request for it, and lazy upon request, so that
+/// a request never observes a template over a stale parent.
+/// Unconfirmed transactions are pooled as the node announces them. Upon a new
+/// top the pool is pruned of confirmed and conflicted transactions and the
+/// template is selected by ancestor fee rate. Between tops an arriving
+/// transaction is appended to the current template if it fits (its pooled
+/// parents already selected), otherwise the next request reselects.
+class BCS_API block_templates
+{
+public:
+    DELETE_COPY_MOVE(block_templates);
+
+    /// Block version of templates (bip9 top bits, no deployments signaled).
+    static constexpr uint32_t version = 0x20000000;
+
+    /// Weight and sigop cost reserved for the coinbase (as bitcoind).
+    static constexpr size_t reserved_weight = 4'000;
+    static constexpr size_t reserved_sigops = 400;
+
+    block_templates() NOEXCEPT;
+
+    /// The template over the block at link, built if not current.
+    /// Null if the store lacks the chain state of the block at link.
+    block_template::cptr update(const node::query& query,
+        const system::settings& settings, node::header_t link) NOEXCEPT;
+
+    /// Pool the unconfirmed transaction at link, appending it to the current
+    /// template if it fits. False if not poolable (e.g. missing prevouts).
+    bool add(const node::query& query, node::transaction_t link) NOEXCEPT;
+
+    /// The current template, null if none has been built.
+    block_template::cptr current() const NOEXCEPT;
+
+    /// The number of pooled transactions.
+    size_t pooled() const NOEXCEPT;
+
+    /// bip22 rejection reason of a block over the confirmed top (empty if
+    /// valid). Inputs are not populated, so connection (and fee) checks are
+    /// left to the node upon organization.
+    std::string check(const node::query& query,
+        const system::settings& settings,
+        const system::chain::block& block) NOEXCEPT;
+
+    /// bip22 rejection reason of a block check or organization code.
+    static std::string to_bip22(const code& ec) NOEXCEPT;
+
+    /// Long-poll identifier of the template (parent hash and sequence).
+    static std::string longpollid(const block_template& value) NOEXCEPT;
+
+    /// Witness commitment of a block of only the coinbase (bip141), with
+    /// the null witness reserved value.
+    static system::hash_digest empty_commitment() NOEXCEPT;
+
+    /// Witness commitment of the coinbase and transactions (bip141), with
+    /// the null witness reserved value.
+    static system::hash_digest commitment(const template_txs& txs) NOEXCEPT;
+
+    /// Greedy selection by ancestor fee rate (fee and weight of the tx and
+    /// its unselected pooled ancestors) within the weight and sigop limits.
+    /// A package that does not fit or conflicts with a selected transaction
+    /// is skipped. Candidates with a parent that is not a candidate are
+    /// excluded. The result is in dependency order.
+    static template_txs select(const template_txs& candidates,
+        size_t weight_limit, size_t sigop_limit) NOEXCEPT;
+
+private:
+    using pool = std::unordered_map<system::hash_digest, template_tx::cptr>;
+
+    static block_template::ptr build(const node::query& query,
+        const system::settings& settings, node::header_t link,
+        const template_txs& candidates) NOEXCEPT;
+    static template_txs prune(const node::query& query,
+        const template_txs& candidates) NOEXCEPT;
+
+    // These require lock.
+    bool appendable(const template_tx& tx) const NOEXCEPT;
+    void append(const template_tx::cptr& tx) NOEXCEPT;
+
+    // These are protected by mutex.
+    uint64_t sequence_{};
+    uint64_t changes_{};
+    bool reselect_{};
+    block_template::cptr current_{};
+    pool pool_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
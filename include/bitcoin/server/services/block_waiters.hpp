@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_BLOCK_WAITERS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_BLOCK_WAITERS_HPP
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide.
+/// Parked long-poll requests (waitforblock, waitforblockheight and
+/// waitfornewblock), keyed by target height, target hash or prior top hash.
+/// Waiters hold no thread, they are released upon notification of an
+/// organized block, once by the server (and deduplicated by header link, so
+/// a repeated notification releases no waiter twice). Hash waiters are also
+/// released once their block is confirmed below the notified top (i.e. it
+/// was confirmed after the caller's check and before parking). Handlers are
+/// invoked (with success) on the notifying thread, outside of the lock.
+class BCS_API block_waiters
+{
+public:
+    DELETE_COPY_MOVE(block_waiters);
+
+    using key = uint64_t;
+    using handler = network::result_handler;
+
+    block_waiters() NOEXCEPT;
+
+    /// Park until a block is organized at or above height.
+    /// False (handler not retained) if already satisfied by notification.
+    bool wait_height(key& out, size_t height, handler&& complete) NOEXCEPT;
+
+    /// Park until the block of hash is organized.
+    /// False (handler not retained) if already satisfied by notification.
+    bool wait_hash(key& out, const system::hash_digest& hash,
+        handler&& complete) NOEXCEPT;
+
+    /// Park until a block other than top is organized.
+    /// False (handler not retained) if already satisfied by notification.
+    bool wait_change(key& out, const system::hash_digest& top,
+        handler&& complete) NOEXCEPT;
+
+    /// Remove a parked handler without invocation (e.g. upon timeout).
+    /// False if not parked (already released or canceled).
+    bool cancel(key id) NOEXCEPT;
+
+    /// Release waiters satisfied by the organized block at link.
+    void notify(const node::query& query, node::header_t link) NOEXCEPT;
+
+    /// True if the block of hash is confirmed.
+    static bool is_confirmed(const node::query& query,
+        const system::hash_digest& hash) NOEXCEPT;
+
+    /// The number of parked waiters.
+    size_t size() const NOEXCEPT;
+
+private:
+    enum class kind { height, hash, change };
+
+    struct waiter
+    {
+        kind type;
+        size_t height;
+        system::hash_digest hash;
+        handler complete;
+    };
+
+    // Require lock.
+    bool is_satisfied(const waiter& value) const NOEXCEPT;
+    key park(waiter&& value) NOEXCEPT;
+    void unindex(key id, const waiter& value) NOEXCEPT;
+
+    // These are protected by mutex.
+    key next_{};
+    bool notified_{};
+    node::header_t link_{};
+    size_t top_height_{};
+    system::hash_digest top_hash_{};
+    std::unordered_map<key, waiter> waiters_{};
+    std::multimap<size_t, key> heights_{};
+    std::unordered_multimap<system::hash_digest, key> hashes_{};
+    std::unordered_map<key, system::hash_digest> changes_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_CHAIN_TX_INDEX_HPP
+#define LIBBITCOIN_SERVER_SERVICES_CHAIN_TX_INDEX_HPP
+
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide.
+/// Cumulative confirmed transaction count by height (prefix sums), so that
+/// the count through any height and the count of any window of confirmed
+/// blocks are each at most two lookups. The index is seeded once by a walk of
+/// the confirmed chain (outside of the lock, so that readers are not blocked)
+/// and is then extended on demand (or through the confirmed top by update).
+/// It retains the header link of each height. Since a confirmed block implies
+/// its ancestry, a height is valid if its link remains confirmed. Upon a
+/// mismatch the index is rewound to the fork point and then re-extended.
+/// Until seeded the index is not ready and all reads return false.
+class BCS_API chain_tx_index
+{
+public:
+    DELETE_COPY_MOVE(chain_tx_index);
+
+    chain_tx_index() NOEXCEPT;
+
+    /// Confirmed tx count from genesis through height (inclusive).
+    /// False if not ready, height is not confirmed (or a store read failed).
+    bool get(size_t& out, const node::query& query,
+        size_t height) NOEXCEPT;
+
+    /// Confirmed tx count in heights (first, last], false as get().
+    bool window(size_t& out, const node::query& query, size_t first,
+        size_t last) NOEXCEPT;
+
+    /// Walk the confirmed chain and then become ready, false if canceled.
+    bool seed(const node::query& query,
+        const std::atomic_bool& canceled) NOEXCEPT;
+
+    /// Rewind to the fork point and extend through the confirmed top.
+    /// False if not ready (the seed extends through the top when adopted).
+    bool update(const node::query& query) NOEXCEPT;
+
+    /// True once seeded.
+    bool ready() const NOEXCEPT;
+
+    /// The number of indexed heights.
+    size_t size() const NOEXCEPT;
+
+private:
+    bool is_current(const node::query& query, size_t height) const NOEXCEPT;
+    bool current(const node::query& query, size_t height) NOEXCEPT;
+    bool extend(const node::query& query, size_t height) NOEXCEPT;
+
+    // This is thread safe.
+    std::atomic_bool ready_{};
+
+    // These are protected by mutex.
+    std::vector<database::header_link> links_{};
+    std::vector<uint64_t> counts_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
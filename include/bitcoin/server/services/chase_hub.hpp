@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_CHASE_HUB_HPP
+#define LIBBITCOIN_SERVER_SERVICES_CHASE_HUB_HPP
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide.
+/// Fan-out of chaser events to the channels that subscribe to them. The node
+/// notifies the hub once per event and each event type has its own list of
+/// subscribers, so channels without a relevant subscription are never
+/// invoked. Membership changes are constant time (slot and free list), the
+/// immutable snapshot of a list is rebuilt at most once per event and only
+/// if membership has changed, and handlers are invoked outside of the lock.
+/// Membership is reference counted by event type, so that independent
+/// subscriptions of one channel (e.g. headers and addresses) compose.
+class BCS_API chase_hub
+{
+public:
+    DELETE_COPY_MOVE(chase_hub);
+
+    /// Bit mask of fanned-out event types.
+    using events = uint8_t;
+    static constexpr events none = 0;
+    static constexpr events organized = 1;
+    static constexpr events reorganized = 2;
+    static constexpr events block = 4;
+    static constexpr events transaction = 8;
+
+    /// Same as node chase handlers, false return unsubscribes from all.
+    using handler = std::function<bool(const code&, node::chase,
+        node::event_value)>;
+
+    /// Opaque subscriber (one per channel protocol).
+    struct subscriber;
+    typedef std::shared_ptr<subscriber> subscriber_ptr;
+
+    chase_hub() NOEXCEPT = default;
+
+    /// Create a subscriber of the handler, subscribed to no events.
+    static subscriber_ptr make(handler&& notify) NOEXCEPT;
+
+    /// Add the subscriber to the lists of the events (counted).
+    void subscribe(const subscriber_ptr& value, events mask) NOEXCEPT;
+
+    /// Remove one count of the subscriber from the lists of the events.
+    void unsubscribe(const subscriber_ptr& value, events mask) NOEXCEPT;
+
+    /// Remove the subscriber from all lists (e.g. upon channel stop).
+    void unsubscribe(const subscriber_ptr& value) NOEXCEPT;
+
+    /// Invoke the subscribers of the event (not fanned-out types ignored).
+    void notify(const code& ec, node::chase event_,
+        const node::event_value& value) NOEXCEPT;
+
+    /// The number of subscribers of the event.
+    size_t subscribers(node::chase event_) const NOEXCEPT;
+
+    /// The event type bit of the chase event (none if not fanned-out).
+    static events to_events(node::chase event_) NOEXCEPT;
+
+private:
+    static constexpr size_t types = 4;
+    using list = std::vector<subscriber_ptr>;
+    using list_ptr = std::shared_ptr<const list>;
+
+    // Subscribers of one event type, in slots reused upon removal.
+    struct members
+    {
+        std::vector<subscriber_ptr> slots{};
+        std::vector<size_t> free{};
+        size_t size{};
+        bool changed{};
+        list_ptr snapshot{};
+    };
+
+    // These require lock.
+    void insert(size_t type, const subscriber_ptr& value) NOEXCEPT;
+    void remove(size_t type, const subscriber_ptr& value) NOEXCEPT;
+    list_ptr snapshot(size_t type) NOEXCEPT;
+
+    // These are protected by mutex.
+    std::array<members, types> lists_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
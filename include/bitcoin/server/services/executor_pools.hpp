@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_EXECUTOR_POOLS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_EXECUTOR_POOLS_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/settings.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide (the map is not modified after construction).
+/// Dedicated threads by interface name, each pool an io_context run by its
+/// own threads, optionally pinned to cpus (or the cpus of a NUMA node). The
+/// protocols of an interface with a pool bind their secondary (notification)
+/// strands and parallel work to it, isolating its load from other sessions.
+/// Interfaces without a pool use the network threadpool. A pool thread that
+/// cannot be pinned runs unpinned, and the failure is logged.
+class BCS_API executor_pools
+  : protected network::reporter
+{
+public:
+    DELETE_COPY_MOVE(executor_pools);
+
+    using service_t = network::asio::io_context;
+
+    executor_pools(const server::settings& settings,
+        const network::logger& log) NOEXCEPT;
+
+    /// Stops and joins all pools.
+    ~executor_pools() NOEXCEPT;
+
+    /// The service of the named interface's pool, null if none.
+    service_t* find(const std::string& name) const NOEXCEPT;
+
+    /// The service of the named interface's pool, otherwise fallback.
+    service_t& service(const std::string& name,
+        service_t& fallback) const NOEXCEPT;
+
+    /// Stop all pools and join their threads (idempotent).
+    void stop() NOEXCEPT;
+
+    /// Parse a cpu list such as "0-3,8", false if invalid.
+    static bool parse_cpus(std::vector<size_t>& out,
+        const std::string& text) NOEXCEPT;
+
+    /// Cpus of a NUMA node (empty if unknown or unsupported by the platform).
+    static std::vector<size_t> numa_cpus(int32_t node) NOEXCEPT;
+
+    /// Pin the calling thread to the cpus, false if unsupported or failed.
+    static bool pin(const std::vector<size_t>& cpus) NOEXCEPT;
+
+private:
+    struct pool;
+
+    std::unique_ptr<pool> make_pool(const std::string& name,
+        const server::settings::executor& settings) NOEXCEPT;
+
+    // These are thread safe (not modified after construction).
+    std::unordered_map<std::string, std::unique_ptr<pool>> pools_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_QUERY_DEADLINE_HPP
+#define LIBBITCOIN_SERVER_SERVICES_QUERY_DEADLINE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Cancellation token of one store query, tripped upon expiry of its
+/// deadline or by stop of the requesting protocol. The token is passed to the
+/// store walk in place of the protocol's stopping flag, so that a pathological
+/// request is abandoned without waiting on the channel to stop.
+/// Start and cancel require the protocol strand, completion may be invoked
+/// from the query thread (it posts the timer cancel to the strand). Expiry
+/// and completion exchange one atomic state, so the first wins: a query that
+/// completes is not subsequently expired.
+class BCS_API query_deadline
+  : public std::enable_shared_from_this<query_deadline>
+{
+public:
+    DELETE_COPY_MOVE(query_deadline);
+
+    typedef std::shared_ptr<query_deadline> ptr;
+    using strand_t = network::asio::strand;
+    using duration = std::chrono::milliseconds;
+    using timeouts = std::map<std::string, duration, std::less<>>;
+
+    /// Parse "method:milliseconds" entries (invalid entries are ignored).
+    static timeouts parse(const std::vector<std::string>& entries) NOEXCEPT;
+
+    query_deadline(strand_t& strand) NOEXCEPT;
+
+    /// Start the deadline timer (a zero timeout does not expire).
+    void start(const duration& timeout) NOEXCEPT;
+
+    /// Trip the token without expiry (the protocol is stopping).
+    void cancel() NOEXCEPT;
+
+    /// Stop the timer, query_canceled if expired first, otherwise the code.
+    code complete(const code& ec) NOEXCEPT;
+
+    /// The flag observed by the store walk.
+    const std::atomic_bool& canceled() const NOEXCEPT;
+
+    /// The query has completed (the token may be released).
+    bool completed() const NOEXCEPT;
+
+    /// The deadline expired before completion.
+    bool expired() const NOEXCEPT;
+
+private:
+    enum class state : uint8_t
+    {
+        pending,
+        completed,
+        expired
+    };
+
+    // These are protected by strand.
+    strand_t strand_;
+    boost::asio::steady_timer timer_;
+
+    // These are thread safe.
+    std::atomic_bool canceled_{};
+    std::atomic_bool completed_{};
+    std::atomic<state> state_{ state::pending };
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
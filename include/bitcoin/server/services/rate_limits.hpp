@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_RATE_LIMITS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_RATE_LIMITS_HPP
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/settings.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, token buckets by client of one interface.
+/// Each admitted request debits its method cost from the client's bucket,
+/// which is refilled at a constant rate up to the burst allowance. Upon
+/// completion the measured query time and result rows are also debited, so
+/// that expensive queries (e.g. whale address histories) drain the bucket in
+/// proportion to the work they cause. Such feedback may leave the bucket in
+/// debt (bounded by the burst), deferring admission until it is repaid.
+class BCS_API rate_limiter
+{
+public:
+    DELETE_COPY_MOVE(rate_limiter);
+
+    using clock = std::chrono::steady_clock;
+
+    rate_limiter(const server::settings::limiter& settings) NOEXCEPT;
+
+    /// The tokens debited upon admission of the method.
+    double cost(const std::string_view& method) const NOEXCEPT;
+
+    /// Debit the method cost from the client's bucket, false if insufficient.
+    bool admit(const std::string& client, const std::string_view& method,
+        clock::time_point now=clock::now()) NOEXCEPT;
+
+    /// Debit the client's bucket by the measured cost of a completed query.
+    void charge(const std::string& client, size_t rows,
+        const clock::duration& elapsed) NOEXCEPT;
+
+    /// The number of clients currently tracked.
+    size_t clients() const NOEXCEPT;
+
+private:
+    struct bucket
+    {
+        double tokens;
+        clock::time_point time;
+    };
+
+    using costs = std::map<std::string, double, std::less<>>;
+    static costs parse_costs(
+        const server::settings::limiter& settings) NOEXCEPT;
+
+    void refill(bucket& bucket, clock::time_point now) const NOEXCEPT;
+    void sweep(clock::time_point now) NOEXCEPT;
+
+    // These are thread safe.
+    const double rate_;
+    const double burst_;
+    const double cost_;
+    const double query_msecs_;
+    const double query_rows_;
+    const costs costs_;
+
+    // These are protected by mutex.
+    std::unordered_map<std::string, bucket> buckets_{};
+    size_t next_sweep_;
+    mutable std::mutex mutex_{};
+};
+
+/// Thread safe, server-wide (the map is not modified after construction).
+/// Rate limiters by interface name, for interfaces with a nonzero rate.
+class BCS_API rate_limits
+{
+public:
+    DELETE_COPY_MOVE(rate_limits);
+
+    rate_limits(const server::settings& settings) NOEXCEPT;
+
+    /// The limiter of the named interface, null if not rate limited.
+    rate_limiter* find(const std::string& name) const NOEXCEPT;
+
+private:
+    // These are thread safe (not modified after construction).
+    std::unordered_map<std::string, std::unique_ptr<rate_limiter>>
+        limiters_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_REQUEST_METRICS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_REQUEST_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Request counters of one interface method, incremented without locks by
+/// the protocols of the interface. The latency histogram is log-linear (HDR
+/// style), with four linear sub-buckets per power of two microseconds, so
+/// that quantiles are resolved to within 25% over the full range.
+struct BCS_API request_counter
+{
+    using ptr = std::shared_ptr<request_counter>;
+
+    /// Sub-buckets per power of two and total buckets (to 2^33 usecs).
+    static constexpr size_t sub_buckets = 4;
+    static constexpr size_t buckets = 128;
+
+    /// The histogram bucket of a latency.
+    static size_t to_bucket(uint64_t usecs) NOEXCEPT;
+
+    /// The exclusive upper bound latency of a histogram bucket.
+    static uint64_t to_usecs(size_t bucket) NOEXCEPT;
+
+    std::atomic<uint64_t> requests{};
+    std::atomic<uint64_t> errors{};
+    std::atomic<uint64_t> bytes{};
+    std::atomic<uint64_t> usecs{};
+    std::array<std::atomic<uint64_t>, buckets> histogram{};
+};
+
+/// Aggregated interface method requests, with latency quantiles.
+struct BCS_API request_summary
+{
+    std::string interface{};
+    std::string method{};
+    uint64_t requests{};
+    uint64_t errors{};
+    uint64_t bytes{};
+    uint64_t usecs{};
+    uint64_t samples{};
+    uint64_t p50_usecs{};
+    uint64_t p90_usecs{};
+    uint64_t p99_usecs{};
+    uint64_t maximum_usecs{};
+};
+
+/// Thread safe, server-wide.
+/// Request counters by interface and method. The map is locked exclusively
+/// only to add a method upon its first request, so recording contends only
+/// as a shared (reader) lock and relaxed atomic increments.
+class BCS_API request_metrics
+{
+public:
+    DELETE_COPY_MOVE(request_metrics);
+
+    using duration = std::chrono::steady_clock::duration;
+    using summaries = std::vector<request_summary>;
+
+    request_metrics() NOEXCEPT;
+
+    /// Record a completed request of the interface method.
+    void record(const std::string& interface, const std::string_view& method,
+        const duration& elapsed, size_t bytes, bool error) NOEXCEPT;
+
+    /// Record a failed request of the interface method, where the failure
+    /// response is not timed (counted but excluded from the histogram).
+    void fail(const std::string& interface,
+        const std::string_view& method) NOEXCEPT;
+
+    /// Summaries of all methods (ordered by interface and method).
+    summaries aggregate() const NOEXCEPT;
+
+    /// Render summaries in Prometheus text exposition format.
+    static std::string to_prometheus(const summaries& summaries) NOEXCEPT;
+
+private:
+    using methods = std::map<std::string, request_counter::ptr, std::less<>>;
+    using interfaces = std::map<std::string, methods, std::less<>>;
+
+    request_counter& counter(const std::string& interface,
+        const std::string_view& method) NOEXCEPT;
+
+    // These are protected by mutex (counters are thread safe).
+    interfaces interfaces_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SERVER_METRICS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SERVER_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/settings.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, server-wide (the map is not modified after construction).
+/// Counters of fired node and server events and of accepted connections by
+/// interface, pre-aggregated with relaxed atomic increments so that metrics
+/// scrapes read them without locks or subscriptions. The logger outlives
+/// the node, so its event handler shares ownership of the instance.
+class BCS_API server_metrics
+{
+public:
+    DELETE_COPY_MOVE(server_metrics);
+
+    typedef std::shared_ptr<server_metrics> ptr;
+
+    /// Event identifiers are limited by the admin event filter (< 53).
+    static constexpr size_t limit = 64;
+
+    struct event_summary
+    {
+        std::string name{};
+        uint64_t count{};
+        uint64_t value{};
+        uint64_t total{};
+    };
+
+    struct connection_summary
+    {
+        std::string interface{};
+        uint64_t accepted{};
+    };
+
+    server_metrics(const server::settings& settings) NOEXCEPT;
+
+    /// Count a fired event and its value (ignored if unnamed).
+    void fire(uint8_t event_, uint64_t value) NOEXCEPT;
+
+    /// Count an accepted connection of the named interface.
+    void accept(const std::string& interface) NOEXCEPT;
+
+    /// Events that have fired (ordered by identifier).
+    std::vector<event_summary> events() const NOEXCEPT;
+
+    /// Accepted connections by interface (ordered by name).
+    std::vector<connection_summary> connections() const NOEXCEPT;
+
+    /// Render events and connections in Prometheus text exposition format.
+    std::string to_prometheus() const NOEXCEPT;
+
+    /// The name of a node or server event, empty if undefined.
+    static std::string to_name(uint8_t event_) NOEXCEPT;
+
+private:
+    struct counter
+    {
+        std::atomic<uint64_t> count{};
+        std::atomic<uint64_t> value{};
+        std::atomic<uint64_t> total{};
+    };
+
+    using accepts = std::map<std::string, std::atomic<uint64_t>, std::less<>>;
+
+    // These are thread safe (not modified after construction).
+    std::array<counter, limit> events_{};
+    accepts accepts_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SERVICES_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SERVICES_HPP
+
+#include <bitcoin/server/services/block_notifications.hpp>
+#include <bitcoin/server/services/block_stats_cache.hpp>
+#include <bitcoin/server/services/block_templates.hpp>
+#include <bitcoin/server/services/block_waiters.hpp>
+#include <bitcoin/server/services/chain_tx_index.hpp>
+#include <bitcoin/server/services/chase_hub.hpp>
+#include <bitcoin/server/services/executor_pools.hpp>
+#include <bitcoin/server/services/query_deadline.hpp>
+#include <bitcoin/server/services/rate_limits.hpp>
+#include <bitcoin/server/services/request_metrics.hpp>
+#include <bitcoin/server/services/server_metrics.hpp>
+#include <bitcoin/server/services/share_validator.hpp>
+#include <bitcoin/server/services/stratum_accounts.hpp>
+#include <bitcoin/server/services/stratum_jobs.hpp>
+#include <bitcoin/server/services/transaction_batch.hpp>
+#include <bitcoin/server/services/vardiff.hpp>
+
+#endif
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_SHARE_VALIDATOR_HPP
+#define LIBBITCOIN_SERVER_SERVICES_SHARE_VALIDATOR_HPP
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/services/stratum_jobs.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// A stratum share pending validation. The prefix is the midstate of the
+/// coinbase through extranonce1 (stratum_jobs::prefix), cached by the channel
+/// for its current job. The handler is invoked on the thread that drains the
+/// validator, with low_difficulty or success, the header hash and (if the
+/// share meets the network target) the assembled block.
+struct BCS_API stratum_share
+{
+    using handler = std::function<void(const code&, const system::hash_digest&,
+        const system::chain::block::cptr&)>;
+
+    stratum_job::cptr job{};
+    uint32_t extranonce1{};
+    stratum_jobs::midstate prefix{};
+    system::data_chunk extranonce2{};
+    uint32_t time{};
+    uint32_t nonce{};
+    uint32_t difficulty{};
+    handler complete{};
+};
+
+/// Thread safe, server-wide.
+/// Shares of all channels are queued and drained by up to concurrency
+/// threadpool jobs at once (one per pool thread), each taking a few shares
+/// per lock acquisition, so that validation is spread over the threads
+/// while a burst does not schedule a job per share. Each share hashes the
+/// coinbase tail (from its prefix midstate) and the header (folding the
+/// merkle branch). The coinbase is serialized only for a block.
+class BCS_API share_validator
+{
+public:
+    DELETE_COPY_MOVE(share_validator);
+
+    /// Maximum shares taken from the queue per lock acquisition.
+    static constexpr size_t chunk = 16;
+
+    /// Shares pending validation are bounded by maximum, and drained by up
+    /// to concurrency jobs.
+    share_validator(size_t maximum=max_size_t,
+        size_t concurrency=one) NOEXCEPT;
+
+    /// Queue a share, false if the queue is full (share is not queued).
+    /// Set drain true if the caller must schedule drain().
+    bool enqueue(bool& drain, stratum_share&& share) NOEXCEPT;
+
+    /// Validate queued shares (including those queued meanwhile) until the
+    /// queue is empty, invoking each handler outside of the lock.
+    void drain() NOEXCEPT;
+
+    /// Validate a share, invoking its handler.
+    static void validate(const stratum_share& share) NOEXCEPT;
+
+private:
+    // These are thread safe.
+    const size_t maximum_;
+    const size_t concurrency_;
+
+    // These are protected by mutex.
+    size_t draining_{};
+    std::deque<stratum_share> pending_{};
+    std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_STRATUM_ACCOUNTS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_STRATUM_ACCOUNTS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Share counters of one worker, incremented without locks by the channels
+/// (and share validators) of the worker. Work is the sum of the difficulty
+/// of accepted shares.
+struct BCS_API share_counter
+{
+    using ptr = std::shared_ptr<share_counter>;
+
+    std::atomic<uint64_t> accepted{};
+    std::atomic<uint64_t> rejected{};
+    std::atomic<uint64_t> stale{};
+    std::atomic<uint64_t> work{};
+    std::atomic<uint64_t> blocks{};
+};
+
+/// Aggregated worker shares, with the accepted share rate over the most
+/// recent aggregation window.
+struct BCS_API share_summary
+{
+    std::string worker{};
+    uint64_t accepted{};
+    uint64_t rejected{};
+    uint64_t stale{};
+    uint64_t work{};
+    uint64_t blocks{};
+    double shares_per_minute{};
+};
+
+/// Thread safe, server-wide.
+/// Share counters by worker name, shared by all channels that authorize the
+/// worker. The map is locked only to obtain a counter (upon authorization)
+/// and to aggregate, so share accounting does not contend across channels.
+/// Worker names are not authenticated, so the map is bounded. When full, the
+/// accounts of workers not authorized by any channel are evicted.
+class BCS_API stratum_accounts
+{
+public:
+    DELETE_COPY_MOVE(stratum_accounts);
+
+    using clock = std::chrono::steady_clock;
+
+    /// Minimum period over which share rates are computed.
+    static constexpr auto window = std::chrono::minutes(1);
+
+    stratum_accounts(size_t maximum=max_size_t) NOEXCEPT;
+
+    /// The counter of the worker, created if not found (null if full).
+    share_counter::ptr counter(const std::string& worker) NOEXCEPT;
+
+    /// The number of accounts.
+    size_t size() const NOEXCEPT;
+
+    /// Summaries of all workers (ordered by name). Rates are recomputed if a
+    /// window has elapsed since the last computation, otherwise retained.
+    std::vector<share_summary> aggregate(
+        clock::time_point now=clock::now()) NOEXCEPT;
+
+private:
+    struct account
+    {
+        share_counter::ptr counter{};
+        uint64_t accepted{};
+        double rate{};
+    };
+
+    // This is thread safe.
+    const size_t maximum_;
+
+    // These are protected by mutex.
+    clock::time_point aggregated_{};
+    std::unordered_map<std::string, account> accounts_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
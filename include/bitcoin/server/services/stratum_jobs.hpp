@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_STRATUM_JOBS_HPP
+#define LIBBITCOIN_SERVER_SERVICES_STRATUM_JOBS_HPP
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/services/block_templates.hpp>
+#include <bitcoin/server/settings.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Immutable stratum v1 job, converted once from a block template and shared
+/// by all channels. The coinbase is split around the extranonces (coinb1 and
+/// coinb2) and the merkle branch folds the coinbase hash to the merkle root.
+struct BCS_API stratum_job
+{
+    using cptr = std::shared_ptr<const stratum_job>;
+
+    std::string id{};
+    block_template::cptr source{};
+    system::data_chunk coinb1{};
+    system::data_chunk coinb2{};
+    system::hashes branch{};
+    uint32_t time{};
+
+    /// mining.notify request (json-rpc 1.0, null id, newline delimited),
+    /// serialized once and written from this buffer by all channels.
+    std::string notification{};
+};
+
+/// Thread safe, server-wide.
+/// The current stratum v1 job (deduplicated by template) and recent jobs (to
+/// distinguish stale from unknown submissions), with extranonce1 allocation.
+/// Share hashing is static, so that it may run on any thread.
+class BCS_API stratum_jobs
+{
+public:
+    DELETE_COPY_MOVE(stratum_jobs);
+
+    /// SHA256 state of a coinbase prefix (coinb1 and extranonce1).
+    using midstate = system::accumulator<system::sha256>;
+
+    /// Number of superseded jobs retained for submission lookup.
+    static constexpr size_t history = 4;
+
+    /// Jobs are not issued if payout_address is empty or invalid.
+    stratum_jobs(const server::settings& settings) NOEXCEPT;
+
+    /// A valid payout address is configured.
+    bool enabled() const NOEXCEPT;
+
+    /// Number of miner-rolled extranonce bytes.
+    size_t extranonce2_size() const NOEXCEPT;
+
+    /// A unique extranonce1 for a subscribing channel.
+    uint32_t extranonce1() NOEXCEPT;
+
+    /// The job of the template, built if not current (null if disabled).
+    stratum_job::cptr update(const block_template::cptr& source) NOEXCEPT;
+
+    /// The current or a recent job by id, null if not found.
+    stratum_job::cptr find(const std::string& id) const NOEXCEPT;
+
+    /// Midstate of the coinbase prefix of a channel (coinb1 and extranonce1),
+    /// computed once per job per channel.
+    static midstate prefix(const stratum_job& job,
+        uint32_t extranonce1) NOEXCEPT;
+
+    /// Coinbase hash (txid) of the prefix midstate, extranonce2 and coinb2,
+    /// hashing only the extranonce2 and coinb2 (and the second round).
+    static system::hash_digest coinbase_hash(const stratum_job& job,
+        const midstate& prefix, const system::data_chunk& extranonce2) NOEXCEPT;
+
+    /// Serialized (non-witness) coinbase for the extranonces.
+    static system::data_chunk coinbase(const stratum_job& job,
+        uint32_t extranonce1, const system::data_chunk& extranonce2) NOEXCEPT;
+
+    /// Serialized header for the coinbase hash, time and nonce.
+    static system::data_chunk header(const stratum_job& job,
+        const system::hash_digest& coinbase_hash, uint32_t time,
+        uint32_t nonce) NOEXCEPT;
+
+    /// Block of the header, (non-witness) coinbase and template transactions,
+    /// adding the witness reserved value to the coinbase if the template
+    /// commits to witnesses.
+    static system::chain::block::cptr block(const stratum_job& job,
+        const system::data_chunk& header,
+        const system::data_chunk& coinbase) NOEXCEPT;
+
+    /// Merkle branch of the coinbase, given the non-coinbase txids.
+    static system::hashes merkle_branch(
+        const system::hashes& txids) NOEXCEPT;
+
+    /// Merkle root of the coinbase hash folded with its branch.
+    static system::hash_digest merkle_root(const system::hash_digest& coinbase,
+        const system::hashes& branch) NOEXCEPT;
+
+    /// Share target of a difficulty (relative to the difficulty one target).
+    static system::uint256_t share_target(uint32_t difficulty) NOEXCEPT;
+
+    /// Stratum encoding of the previous block hash (32-bit words swapped).
+    static std::string to_prevhash(const system::hash_digest& hash) NOEXCEPT;
+
+private:
+    stratum_job::cptr build(const block_template::cptr& source,
+        uint64_t sequence) const NOEXCEPT;
+
+    // These are thread safe.
+    const system::data_chunk payout_;
+    const size_t extranonce2_size_;
+    std::atomic<uint32_t> extranonce1_{};
+
+    // These are protected by mutex.
+    uint64_t sequence_{};
+    stratum_job::cptr current_{};
+    std::deque<stratum_job::cptr> recent_{};
+    mutable std::shared_mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
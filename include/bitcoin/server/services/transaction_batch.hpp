@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_TRANSACTION_BATCH_HPP
+#define LIBBITCOIN_SERVER_SERVICES_TRANSACTION_BATCH_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Thread safe, one per channel.
+/// Coalescing of transaction events for one channel. Events are pushed by the
+/// notifying thread and taken as one batch by the channel, so that a storm of
+/// transaction events produces one post and one write (or one status
+/// recomputation) per batch. Only the first push of a batch and the push that
+/// fills it request a drain, so a batch is drained at most twice.
+class BCS_API transaction_batch
+{
+public:
+    DELETE_COPY_MOVE(transaction_batch);
+
+    using duration = std::chrono::milliseconds;
+    using links = std::vector<node::transaction_t>;
+    using handler = std::function<void()>;
+
+    /// A zero window drains as soon as the channel strand is available.
+    transaction_batch(const duration& window, size_t maximum) NOEXCEPT;
+
+    /// Add an event, the delay of the drain to schedule if any (the window
+    /// upon the first event of a batch, zero upon the batch filling).
+    std::optional<duration> push(node::transaction_t link) NOEXCEPT;
+
+    /// Take the accumulated batch (empty if already taken).
+    links pop() NOEXCEPT;
+
+    /// The number of accumulated events.
+    size_t size() const NOEXCEPT;
+
+    /// Post the drain to the strand after the delay (zero posts now).
+    static void schedule(network::asio::strand& strand,
+        const duration& delay, handler&& drain) NOEXCEPT;
+
+private:
+    // These are thread safe.
+    const duration window_;
+    const size_t maximum_;
+
+    // This is protected by mutex.
+    links pending_{};
+    mutable std::mutex mutex_{};
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_SERVICES_VARDIFF_HPP
+#define LIBBITCOIN_SERVER_SERVICES_VARDIFF_HPP
+
+#include <chrono>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/settings.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+/// Not thread safe (one per channel, protected by the channel strand).
+/// Variable share difficulty, retargeted toward the configured share rate.
+/// The rate is measured over the retarget interval, or over a shorter period
+/// if the shares of a full interval arrive early (so a fast miner is quickly
+/// raised). Each retarget is limited to a factor of the current difficulty,
+/// and a retarget within the tolerance leaves the difficulty unchanged.
+class BCS_API vardiff
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /// Maximum retarget factor, and tolerance (fraction) of the difficulty.
+    static constexpr double factor = 4.0;
+    static constexpr double tolerance = 0.3;
+
+    vardiff(const server::settings::stratum_v1_server& settings,
+        clock::time_point now=clock::now()) NOEXCEPT;
+
+    /// Difficulty is retargeted (share_rate and retarget_seconds non-zero).
+    bool enabled() const NOEXCEPT;
+
+    /// Current share difficulty.
+    uint32_t difficulty() const NOEXCEPT;
+
+    /// Count an accepted share and retarget if due, true if changed.
+    bool accept(clock::time_point now=clock::now()) NOEXCEPT;
+
+    /// Retarget if the interval has elapsed, true if changed.
+    bool retarget(clock::time_point now=clock::now()) NOEXCEPT;
+
+private:
+    bool update(clock::time_point now) NOEXCEPT;
+
+    // These are thread safe.
+    const double rate_;
+    const uint32_t maximum_;
+    const clock::duration interval_;
+
+    // These are not thread safe.
+    uint32_t difficulty_;
+    uint64_t shares_{};
+    clock::time_point start_;
+};
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -29,7 +29,7 @@ namespace server {
 
 class server_node;
 
-/// Intermediate base class for future server injection.
+/// Intermediate base class for server injection.
 class session
   : public node::session,
     protected network::tracker<session>
@@ -40,10 +40,17 @@ public:
     /// Construct an instance (network should be started).
     inline session(server_node& node, const configuration& config) NOEXCEPT
       : node::session((node::full_node&)node), config_(config),
-        network::tracker<session>((network::net&)node)
+        server_(node), network::tracker<session>((network::net&)node)
     {
     }
 
+    /// The server node, for access to its server-wide services (protocols
+    /// obtain these upon construction, where server_node is complete).
+    inline server_node& server() const NOEXCEPT
+    {
+        return server_;
+    }
+
     /// Configuration settings for all server libraries.
     inline const configuration& server_config() const NOEXCEPT
     {
@@ -57,8 +64,9 @@ public:
     }
 
 private:
-    // This is thread safe.
+    // These are thread safe.
     const configuration& config_;
+    server_node& server_;
 };
 
 } // namespace server
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SERVER_SESSIONS_SESSION_SERVER_HPP
 
 #include <memory>
+#include <tuple>
 #include <utility>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
@@ -36,9 +37,10 @@ class server_node;
 /// on tcp/ip. session_base processing performs all connection management and
 /// session tracking. This includes start/stop/disable/enable/black/whitelist.
 /// First protocol must declare options_t and channel_t. Each of the protocols
-/// are constructed and attached to a constructed instance of channel_t. The
-/// protocol construct and attachment can be overridden and/or augmented with
-/// other protocols.
+/// are constructed and attached to a constructed instance of channel_t. Each
+/// protocol that declares an interface group is routed by the last protocol,
+/// which resolves the owner of each request. The protocol construct and
+/// attachment can be overridden and/or augmented with other protocols.
 template <typename ...Protocols>
 class session_server
   : public server::session,
@@ -88,6 +90,7 @@ protected:
         const auto channel = std::make_shared<channel_t>(log, socket,
             this->create_key(), this->node_config(), this->options_);
 
+        this->server().counters().accept(this->options_.name);
         return std::static_pointer_cast<network::channel>(channel);
     }
 
@@ -98,11 +101,31 @@ protected:
     {
         if constexpr (!is_zero(sizeof...(Protocols)))
         {
-            ((channel->template attach<Protocols>(self,
-                this->options_)->start(), void()), ...);
+            // Attached in order, routed to the last, then started in order.
+            const std::tuple protocols
+            {
+                channel->template attach<Protocols>(self, this->options_)...
+            };
+
+            const auto& last = std::get<sub1(sizeof...(Protocols))>(protocols);
+            std::apply([&](const auto&... protocol) NOEXCEPT
+            {
+                (route(last, protocol), ...);
+                (protocol->start(), ...);
+            }, protocols);
         }
     }
 
+    /// Route the owner of an interface group to the last protocol.
+    template <typename Last, typename Protocol>
+    static inline void route(const Last& last,
+        const Protocol& protocol) NOEXCEPT
+    {
+        using owner = typename Protocol::element_type;
+        if constexpr (requires { owner::group; })
+            last->route(owner::group, protocol);
+    }
+
     /// Overridden to set channel protocols. This allows the implementation to
     /// pass other values to protocol construction and/or select the desired
     /// protocol based on available factors (e.g. a distinct protocol version).
@@ -98,9 +98,11 @@ server::session → node::session
 
 The bitcoind interface subgroups (blockchain, control, mining, network,
 notifications, test, transaction, utility, wallet) are independent protocols,
-each with its own interface dispatcher, attached to the same channel. A
-subgroup claims each request defined by its interface (via the channel latch);
-protocol_bitcoind is the terminal default responder, attached last, replying
-only to unclaimed requests. The first protocol supplies channel_t/options_t.
+each with its own interface dispatcher, attached to the same channel.
+protocol_bitcoind is the terminal default responder, attached last and routed
+to each subgroup by interface group. It alone receives requests not claimed
+by the first protocol (rest/btcd, via the channel latch), resolves the group
+of each once, and dispatches only to the owning subgroup, replying by default
+otherwise. The first protocol supplies channel_t/options_t.
 
 */
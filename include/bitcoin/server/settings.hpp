@@ -103,6 +103,13 @@ public:
         /// Maximum cumulative number of address subscriptions per channel.
         uint32_t maximum_subscriptions{ 1'000'000 };
 
+        /// Milliseconds before an address query is canceled (zero disables).
+        uint32_t query_deadline{ 60'000 };
+
+        /// Query deadlines by method as "method:milliseconds", such as
+        /// "blockchain.scripthash.get_history:5000".
+        std::vector<std::string> query_deadlines{};
+
         /// Minimum protocol version.
         system::config::version protocol_minimum{ 1, 0, 0, 0 };
 
@@ -177,6 +184,9 @@ public:
         /// Arbitrary version identity returned by getnetworkinfo.
         system::config::version version{};
         std::string subversion{ "/libbitcoin:server/" };
+
+        /// Number of getblockstats summaries retained (zero disables).
+        uint32_t block_stats_cache{ 4'096 };
     };
 
     struct btcd_server
@@ -195,6 +205,120 @@ public:
         uint32_t maximum_history{ 1'000'000 };
     };
 
+    struct stratum_v1_server
+      : public network::settings::tls_server
+    {
+        using base = network::settings::tls_server;
+        using base::base;
+
+        /// Address paid by job coinbases (jobs are not issued if empty).
+        std::string payout_address{};
+
+        /// Number of miner-rolled coinbase extranonce bytes (extranonce2).
+        uint32_t extranonce2_size{ 4 };
+
+        /// Share difficulty assigned to authorized workers.
+        uint32_t share_difficulty{ 1 };
+
+        /// Target accepted shares per minute per channel (zero fixes the
+        /// share difficulty).
+        uint32_t share_rate{ 20 };
+
+        /// Seconds over which the share rate is measured for retarget.
+        uint32_t retarget_seconds{ 120 };
+
+        /// Upper bound of the retargeted share difficulty.
+        uint32_t maximum_difficulty{ 1'000'000'000 };
+
+        /// Maximum workers authorized per channel.
+        uint32_t maximum_workers{ 16 };
+
+        /// Maximum share accounts retained by the server (idle accounts are
+        /// evicted to admit new workers).
+        uint32_t maximum_accounts{ 10'000 };
+
+        /// Maximum shares pending validation by the server (excess shares
+        /// are rejected as busy).
+        uint32_t maximum_shares{ 4'096 };
+    };
+
+    /// Threads of one interface, dedicated to its sessions (optional).
+    struct executor
+    {
+        /// Number of dedicated threads (zero uses the network threadpool).
+        uint32_t threads{ 0 };
+
+        /// CPUs to which dedicated threads are pinned, such as "0-3,8".
+        std::string cpus{};
+
+        /// NUMA node to whose CPUs threads are pinned (if cpus is empty).
+        int32_t numa_node{ -1 };
+    };
+
+    /// Dedicated threads by interface.
+    struct executors
+    {
+        executor admin{};
+        executor native{};
+        executor bitcoind{};
+        executor btcd{};
+        executor electrum{};
+        executor stratum_v1{};
+        executor stratum_v2{};
+    };
+
+    /// Token bucket admission of one interface's clients (optional).
+    struct limiter
+    {
+        /// Tokens restored to each client per second (zero disables).
+        uint32_t rate{ 0 };
+
+        /// Maximum tokens held by each client (the burst allowance).
+        uint32_t burst{ 100 };
+
+        /// Tokens debited upon admission of a method not listed in costs.
+        uint32_t cost{ 1 };
+
+        /// Method costs as "method:tokens", such as
+        /// "blockchain.scripthash.get_history:10" (tokens may be fractional,
+        /// such as "server.ping:0.25").
+        std::vector<std::string> costs{};
+
+        /// Milliseconds of query time per token debited upon completion
+        /// (zero disables query time feedback).
+        uint32_t query_msecs{ 10 };
+
+        /// Result rows per token debited upon completion (zero disables
+        /// result size feedback).
+        uint32_t query_rows{ 100 };
+    };
+
+    /// Rate limited interfaces (per client address, or per credential).
+    struct limiters
+    {
+        limiter bitcoind{};
+        limiter btcd{};
+        limiter electrum{};
+    };
+
+    /// Coalescing of one interface's transaction notifications.
+    struct coalescer
+    {
+        /// Milliseconds over which transaction events are accumulated into
+        /// one batch per channel (zero drains as soon as possible).
+        uint32_t window_msecs{ 0 };
+
+        /// Maximum transaction events of one batch (drained upon filling).
+        uint32_t maximum_batch{ 1'000 };
+    };
+
+    /// Coalesced interfaces (per channel).
+    struct coalescers
+    {
+        coalescer native{};
+        coalescer electrum{};
+    };
+
     // html_server precludes copy.
     DELETE_COPY(settings);
 
@@ -220,11 +344,20 @@ public:
     electrum_server electrum{ "electrum" };
 
     /// stratum v1 compat interface (tcp/s, json-rpc-v1, auth handshake)
-    network::settings::tls_server stratum_v1{ "stratum_v1" };
+    stratum_v1_server stratum_v1{ "stratum_v1" };
 
     /// stratum vs is not TLS, but normalized for session_server usage.
     /// stratum v2 compat interface (tcp[/s], binary, auth/privacy handshake)
     network::settings::tls_server stratum_v2{ "stratum_v2" };
+
+    /// dedicated interface threads (pinned to cpus or numa node)
+    executors pools{};
+
+    /// rate limits by interface
+    limiters limits{};
+
+    /// transaction notification batches by interface
+    coalescers batches{};
 };
 
 } // namespace server
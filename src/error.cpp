@@ -59,7 +59,15 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { maximum_depth, "maximum_depth" },
     { wrong_version, "wrong_version" },
     { server_error, "server_error" },
-    { method_unauthorized, "method_unauthorized" }
+    { method_unauthorized, "method_unauthorized" },
+    { rate_limited, "rate_limited" },
+    { query_canceled, "query_canceled" },
+
+    // server (stratum share codes)
+    { stale_job, "stale_job" },
+    { duplicate_share, "duplicate_share" },
+    { low_difficulty, "low_difficulty" },
+    { validator_busy, "validator_busy" }
 };
 
 DEFINE_ERROR_T_CATEGORY(error, "server", "server code")
@@ -19,8 +19,12 @@
 #include <bitcoin/server/parser.hpp>
 
 #include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
 #include <bitcoin/server/configuration.hpp>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/services/executor_pools.hpp>
 #include <bitcoin/server/settings.hpp>
 
 ////std::filesystem::path config_default_path() NOEXCEPT
@@ -276,7 +280,19 @@ options_metadata parser::load_options() THROWS
         alias(collisions_variable, 'l').c_str(),
         value<bool>(&configured.collisions)->
             default_value(false)->zero_tokens(),
-        "Scan and display hashmap collision stats (may exceed RAM and result in SIGKILL)."
+        "Scan and display hashmap collision stats (see scan_memory)."
+    )
+    (
+        alias(scan_threads_variable, 't').c_str(),
+        value<size_t>(&configured.scan_threads)->
+            default_value(0),
+        "Threads for slab, bucket and collision scans, defaults to '0' (one per core)."
+    )
+    (
+        alias(scan_memory_variable, 'm').c_str(),
+        value<size_t>(&configured.scan_memory)->
+            default_value(4096),
+        "Collision scan memory budget in MiB (each pass reads all records, zero is unbounded), defaults to '4096'."
     )
     (
         alias(information_variable, 'i').c_str(),
@@ -284,6 +300,30 @@ options_metadata parser::load_options() THROWS
             default_value(false)->zero_tokens(),
         "Scan and display store information."
     )
+    // Benchmarks.
+    (
+        alias(bench_variable, 'e').c_str(),
+        value<std::string>(&configured.bench),
+        "Run the named query benchmark, 'all' for each, 'list' for names."
+    )
+    (
+        alias(bench_threads_variable, 'j').c_str(),
+        value<size_t>(&configured.bench_threads)->
+            default_value(0),
+        "Threads for benchmark samples, defaults to '0' (one per core)."
+    )
+    (
+        alias(bench_samples_variable, 'q').c_str(),
+        value<size_t>(&configured.bench_samples)->
+            default_value(1000),
+        "Samples timed per benchmark, defaults to '1000'."
+    )
+    (
+        alias(bench_format_variable, 'o').c_str(),
+        value<std::string>(&configured.bench_format)->
+            default_value("text"),
+        "Benchmark output format ('text', 'json' or 'csv'), defaults to 'text'."
+    )
     // Ad-hoc Testing.
     (
         alias(get_variable, 'g').c_str(),
@@ -992,6 +1032,21 @@ options_metadata parser::load_settings() THROWS
         value<std::string>(&configured.server.admin.default_),
         "The path of the default source page, defaults to 'index.html'."
     )
+    (
+        "admin.threads",
+        value<uint32_t>(&configured.server.pools.admin.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "admin.cpus",
+        value<std::string>(&configured.server.pools.admin.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "admin.numa_node",
+        value<int32_t>(&configured.server.pools.admin.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
 
     /* [native] */
     (
@@ -1089,6 +1144,31 @@ options_metadata parser::load_settings() THROWS
         value<bool>(&configured.server.native.websocket),
         "Enable websocket interface, defaults to true."
     )
+    (
+        "native.threads",
+        value<uint32_t>(&configured.server.pools.native.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "native.cpus",
+        value<std::string>(&configured.server.pools.native.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "native.numa_node",
+        value<int32_t>(&configured.server.pools.native.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
+    (
+        "native.transaction_window",
+        value<uint32_t>(&configured.server.batches.native.window_msecs),
+        "The milliseconds over which tx_subscribe notifications are batched per channel, defaults to '0' (as soon as possible)."
+    )
+    (
+        "native.transaction_batch",
+        value<uint32_t>(&configured.server.batches.native.maximum_batch),
+        "The maximum transactions of one tx_subscribe notification, defaults to '1000'."
+    )
 
     /* [bitcoind] */
     (
@@ -1171,6 +1251,11 @@ options_metadata parser::load_settings() THROWS
         value<std::string>(&configured.server.bitcoind.subversion),
         "The subversion identity (getnetworkinfo), defaults to '/libbitcoin:server/'."
     )
+    (
+        "bitcoind.block_stats_cache",
+        value<uint32_t>(&configured.server.bitcoind.block_stats_cache),
+        "The number of getblockstats summaries retained, defaults to '4096' (zero disables)."
+    )
     (
         "bitcoind.host",
         value<network::config::endpoints>(&configured.server.bitcoind.hosts),
@@ -1186,6 +1271,51 @@ options_metadata parser::load_settings() THROWS
         value<bool>(&configured.server.bitcoind.allow_opaque_origin),
         "Allow requests from opaque origin (see CORS), multiple allowed, defaults to false."
     )
+    (
+        "bitcoind.threads",
+        value<uint32_t>(&configured.server.pools.bitcoind.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "bitcoind.cpus",
+        value<std::string>(&configured.server.pools.bitcoind.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "bitcoind.numa_node",
+        value<int32_t>(&configured.server.pools.bitcoind.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
+    (
+        "bitcoind.limit_rate",
+        value<uint32_t>(&configured.server.limits.bitcoind.rate),
+        "The tokens restored to each client per second (zero disables limits), defaults to '0'."
+    )
+    (
+        "bitcoind.limit_burst",
+        value<uint32_t>(&configured.server.limits.bitcoind.burst),
+        "The maximum tokens held by each client, defaults to '100'."
+    )
+    (
+        "bitcoind.limit_cost",
+        value<uint32_t>(&configured.server.limits.bitcoind.cost),
+        "The tokens debited by a method without a configured cost, defaults to '1'."
+    )
+    (
+        "bitcoind.limit_method",
+        value<std::vector<std::string>>(&configured.server.limits.bitcoind.costs),
+        "The tokens debited by a method, as 'method:tokens' (fractional allowed, multiple allowed), defaults to empty."
+    )
+    (
+        "bitcoind.limit_query_msecs",
+        value<uint32_t>(&configured.server.limits.bitcoind.query_msecs),
+        "The milliseconds of query time per token debited (zero disables), defaults to '10'."
+    )
+    (
+        "bitcoind.limit_query_rows",
+        value<uint32_t>(&configured.server.limits.bitcoind.query_rows),
+        "The result rows per token debited (zero disables), defaults to '100'."
+    )
 
     /* [btcd] */
     (
@@ -1283,6 +1413,51 @@ options_metadata parser::load_settings() THROWS
         value<bool>(&configured.server.btcd.allow_opaque_origin),
         "Allow requests from opaque origin (see CORS), multiple allowed, defaults to false."
     )
+    (
+        "btcd.threads",
+        value<uint32_t>(&configured.server.pools.btcd.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "btcd.cpus",
+        value<std::string>(&configured.server.pools.btcd.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "btcd.numa_node",
+        value<int32_t>(&configured.server.pools.btcd.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
+    (
+        "btcd.limit_rate",
+        value<uint32_t>(&configured.server.limits.btcd.rate),
+        "The tokens restored to each client per second (zero disables limits), defaults to '0'."
+    )
+    (
+        "btcd.limit_burst",
+        value<uint32_t>(&configured.server.limits.btcd.burst),
+        "The maximum tokens held by each client, defaults to '100'."
+    )
+    (
+        "btcd.limit_cost",
+        value<uint32_t>(&configured.server.limits.btcd.cost),
+        "The tokens debited by a method without a configured cost, defaults to '1'."
+    )
+    (
+        "btcd.limit_method",
+        value<std::vector<std::string>>(&configured.server.limits.btcd.costs),
+        "The tokens debited by a method, as 'method:tokens' (fractional allowed, multiple allowed), defaults to empty."
+    )
+    (
+        "btcd.limit_query_msecs",
+        value<uint32_t>(&configured.server.limits.btcd.query_msecs),
+        "The milliseconds of query time per token debited (zero disables), defaults to '10'."
+    )
+    (
+        "btcd.limit_query_rows",
+        value<uint32_t>(&configured.server.limits.btcd.query_rows),
+        "The result rows per token debited (zero disables), defaults to '100'."
+    )
 
     /* [electrum] */
     (
@@ -1350,6 +1525,26 @@ options_metadata parser::load_settings() THROWS
         value<uint32_t>(&configured.server.electrum.maximum_subscriptions),
         "The maximum allowed address subscriptions per channel, defaults to '1000000'."
     )
+    (
+        "electrum.query_deadline",
+        value<uint32_t>(&configured.server.electrum.query_deadline),
+        "The milliseconds before an address query is canceled (zero disables), defaults to '60000'."
+    )
+    (
+        "electrum.query_method",
+        value<std::vector<std::string>>(&configured.server.electrum.query_deadlines),
+        "The milliseconds before a method query is canceled, as 'method:milliseconds' (multiple allowed), defaults to empty."
+    )
+    (
+        "electrum.transaction_window",
+        value<uint32_t>(&configured.server.batches.electrum.window_msecs),
+        "The milliseconds over which transactions are batched per channel before subscription status is recomputed, defaults to '0' (as soon as possible)."
+    )
+    (
+        "electrum.transaction_batch",
+        value<uint32_t>(&configured.server.batches.electrum.maximum_batch),
+        "The maximum transactions batched before subscription status is recomputed, defaults to '1000'."
+    )
     (
         "electrum.protocol_minimum",
         value<version>(&configured.server.electrum.protocol_minimum),
@@ -1395,6 +1590,51 @@ options_metadata parser::load_settings() THROWS
         value<network::config::endpoints>(&configured.server.electrum.more_safes),
         "Advertised secure host:port at which another server can be reached (defaults to empty)."
     )
+    (
+        "electrum.threads",
+        value<uint32_t>(&configured.server.pools.electrum.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "electrum.cpus",
+        value<std::string>(&configured.server.pools.electrum.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "electrum.numa_node",
+        value<int32_t>(&configured.server.pools.electrum.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
+    (
+        "electrum.limit_rate",
+        value<uint32_t>(&configured.server.limits.electrum.rate),
+        "The tokens restored to each client per second (zero disables limits), defaults to '0'."
+    )
+    (
+        "electrum.limit_burst",
+        value<uint32_t>(&configured.server.limits.electrum.burst),
+        "The maximum tokens held by each client, defaults to '100'."
+    )
+    (
+        "electrum.limit_cost",
+        value<uint32_t>(&configured.server.limits.electrum.cost),
+        "The tokens debited by a method without a configured cost, defaults to '1'."
+    )
+    (
+        "electrum.limit_method",
+        value<std::vector<std::string>>(&configured.server.limits.electrum.costs),
+        "The tokens debited by a method, as 'method:tokens' (fractional allowed, multiple allowed), defaults to empty."
+    )
+    (
+        "electrum.limit_query_msecs",
+        value<uint32_t>(&configured.server.limits.electrum.query_msecs),
+        "The milliseconds of query time per token debited (zero disables), defaults to '10'."
+    )
+    (
+        "electrum.limit_query_rows",
+        value<uint32_t>(&configured.server.limits.electrum.query_rows),
+        "The result rows per token debited (zero disables), defaults to '100'."
+    )
 
     /* [stratum_v1] */
     (
@@ -1447,6 +1687,66 @@ options_metadata parser::load_settings() THROWS
         value<uint32_t>(&configured.server.stratum_v1.rate_limit),
         "The send rate limit in bytes per second, defaults to '0' (unlimited)."
     )
+    (
+        "stratum_v1.payout_address",
+        value<std::string>(&configured.server.stratum_v1.payout_address),
+        "The address paid by job coinbases, defaults to empty (jobs not issued)."
+    )
+    (
+        "stratum_v1.extranonce2_size",
+        value<uint32_t>(&configured.server.stratum_v1.extranonce2_size),
+        "The number of miner-rolled coinbase extranonce bytes, defaults to '4'."
+    )
+    (
+        "stratum_v1.share_difficulty",
+        value<uint32_t>(&configured.server.stratum_v1.share_difficulty),
+        "The share difficulty assigned to authorized workers, defaults to '1'."
+    )
+    (
+        "stratum_v1.share_rate",
+        value<uint32_t>(&configured.server.stratum_v1.share_rate),
+        "The target shares per minute per channel (zero fixes difficulty), defaults to '20'."
+    )
+    (
+        "stratum_v1.retarget_seconds",
+        value<uint32_t>(&configured.server.stratum_v1.retarget_seconds),
+        "The seconds over which the share rate is measured, defaults to '120'."
+    )
+    (
+        "stratum_v1.maximum_difficulty",
+        value<uint32_t>(&configured.server.stratum_v1.maximum_difficulty),
+        "The upper bound of the retargeted share difficulty, defaults to '1000000000'."
+    )
+    (
+        "stratum_v1.maximum_workers",
+        value<uint32_t>(&configured.server.stratum_v1.maximum_workers),
+        "The maximum workers authorized per channel, defaults to '16'."
+    )
+    (
+        "stratum_v1.maximum_accounts",
+        value<uint32_t>(&configured.server.stratum_v1.maximum_accounts),
+        "The maximum share accounts retained (idle accounts are evicted), defaults to '10000'."
+    )
+    (
+        "stratum_v1.maximum_shares",
+        value<uint32_t>(&configured.server.stratum_v1.maximum_shares),
+        "The maximum shares pending validation (excess are rejected), defaults to '4096'."
+    )
+    (
+        "stratum_v1.threads",
+        value<uint32_t>(&configured.server.pools.stratum_v1.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "stratum_v1.cpus",
+        value<std::string>(&configured.server.pools.stratum_v1.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "stratum_v1.numa_node",
+        value<int32_t>(&configured.server.pools.stratum_v1.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
 
     /* [stratum_v2] */
     (
@@ -1484,6 +1784,21 @@ options_metadata parser::load_settings() THROWS
         value<uint32_t>(&configured.server.stratum_v2.rate_limit),
         "The send rate limit in bytes per second, defaults to '0' (unlimited)."
     )
+    (
+        "stratum_v2.threads",
+        value<uint32_t>(&configured.server.pools.stratum_v2.threads),
+        "The number of threads dedicated to the interface (zero shares network threads), defaults to '0'."
+    )
+    (
+        "stratum_v2.cpus",
+        value<std::string>(&configured.server.pools.stratum_v2.cpus),
+        "The cpus to which dedicated threads are pinned, such as '0-3,8', defaults to empty (not pinned)."
+    )
+    (
+        "stratum_v2.numa_node",
+        value<int32_t>(&configured.server.pools.stratum_v2.numa_node),
+        "The numa node to whose cpus dedicated threads are pinned (if no cpus), defaults to '-1' (none)."
+    )
 
     /* [node] */
     (
@@ -2043,6 +2358,27 @@ options_metadata parser::load_settings() THROWS
     return description;
 }
 
+// Rejects a dedicated thread cpu list that does not parse (empty is unpinned).
+static void validate_cpus(const server::settings::executors& pools) THROWS
+{
+    const std::pair<std::string, const std::string&> all[]
+    {
+        { "admin.cpus", pools.admin.cpus },
+        { "native.cpus", pools.native.cpus },
+        { "bitcoind.cpus", pools.bitcoind.cpus },
+        { "btcd.cpus", pools.btcd.cpus },
+        { "electrum.cpus", pools.electrum.cpus },
+        { "stratum_v1.cpus", pools.stratum_v1.cpus },
+        { "stratum_v2.cpus", pools.stratum_v2.cpus }
+    };
+
+    std::vector<size_t> cpus{};
+    for (const auto& [name, text]: all)
+        if (!text.empty() && !executor_pools::parse_cpus(cpus, text))
+            throw validation_error(validation_error::invalid_option_value,
+                name, text);
+}
+
 BC_PUSH_WARNING(NO_ARRAY_TO_POINTER_DECAY)
 bool parser::parse(int argc, const char* argv[], std::ostream& error) THROWS
 BC_POP_WARNING()
@@ -2064,6 +2400,7 @@ BC_POP_WARNING()
 
         // Update bound variables in metadata.settings.
         notify(variables_);
+        validate_cpus(configured.server.pools);
 
         // Clear the config file path if it wasn't used.
         if (!file)
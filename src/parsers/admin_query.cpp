@@ -60,6 +60,7 @@ bool admin_query(rpc::request_t& out, const std::string& target,
 
     constexpr auto html = media_type::text_html;
     constexpr auto json = media_type::application_json;
+    constexpr auto text = media_type::text_plain;
 
     // Caller must have provided a request.params object.
     if (!out.params.has_value() ||
@@ -88,14 +89,18 @@ bool admin_query(rpc::request_t& out, const std::string& target,
         set_media(params, json);
     else if (format == token::formats::html)
         set_media(params, html);
+    else if (format == token::formats::text)
+        set_media(params, text);
     else if (!format.empty())
         return false;
 
-    // Priotize: json, html (ignores accept priorities).
+    // Priotize: json, html, text (ignores accept priorities).
     else if (contains(accepts, json))
         set_media(params, json);
     else if (contains(accepts, html))
         set_media(params, html);
+    else if (contains(accepts, text))
+        set_media(params, text);
     //else no media type is set, which results in not acceptable.
 
     // Parse successful, media type not acceptable if not set.
@@ -115,6 +120,7 @@ media_type strip_media(rpc::request_t& model) NOEXCEPT
                 std::get<uint8_t>(media->second.value())))
             {
                 case media_type::text_html:
+                case media_type::text_plain:
                 case media_type::application_json:
                 {
                     params.erase("media");
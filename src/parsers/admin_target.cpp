@@ -92,6 +92,25 @@ code admin_target(request_t& out, const std::string_view& path) NOEXCEPT
         else
             return error::invalid_subcomponent;
     }
+    else if (target == "stratum")
+    {
+        if (segment == segments.size())
+            return error::invalid_subcomponent;
+
+        if (segments[segment++] == "workers")
+            method = "stratum_workers";
+        else
+            return error::invalid_subcomponent;
+    }
+    else if (target == "metrics")
+    {
+        if (segment == segments.size())
+            method = "metrics";
+        else if (segments[segment++] == "requests")
+            method = "request_metrics";
+        else
+            return error::invalid_subcomponent;
+    }
     else
     {
         return error::invalid_target;
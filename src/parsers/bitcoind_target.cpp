@@ -22,6 +22,7 @@
 #include <iterator>
 #include <variant>
 #include <bitcoin/server/define.hpp>
+#include "segment_reader.hpp"
 
 namespace libbitcoin {
 namespace server {
@@ -33,6 +34,7 @@ using namespace network::http;
 BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
+// Decoded onto the stack, shared only once valid.
 static hash_cptr to_hash(const std::string_view& token) NOEXCEPT
 {
     hash_digest out{};
@@ -73,16 +75,28 @@ static bool to_number(Number& out, const std::string_view& token) NOEXCEPT
     return result.ec == std::errc{} && result.ptr == end;
 }
 
-// Split a "<name>.<extension>" leaf into its name and a media value.
-static bool split_leaf(std::string& name, uint8_t& media,
+// Split a "<name>.<extension>" leaf into its name and a media value (in
+// place). Empty tokens are ignored, so exactly two non-empty tokens remain.
+static bool split_leaf(std::string_view& name, uint8_t& media,
     const std::string_view& leaf) NOEXCEPT
 {
-    const auto parts = split(leaf, ".", false, true);
-    if (parts.size() != two)
+    const auto first = leaf.find_first_not_of('.');
+    if (first == std::string_view::npos)
         return false;
 
-    name = parts.front();
-    return to_media(media, parts.back());
+    const auto last = leaf.find_last_not_of('.');
+    const auto trimmed = leaf.substr(first, add1(last - first));
+    const auto stop = trimmed.find('.');
+    if (stop == std::string_view::npos)
+        return false;
+
+    const auto start = trimmed.find_first_not_of('.', stop);
+    const auto extension = trimmed.substr(start);
+    if (extension.find('.') != std::string_view::npos)
+        return false;
+
+    name = trimmed.substr(zero, stop);
+    return to_media(media, extension);
 }
 
 // Parse a bitcoind REST path into a json-rpc request model.
@@ -91,7 +105,7 @@ static bool split_leaf(std::string& name, uint8_t& media,
 // chaininfo (remaining endpoints return invalid_target until implemented).
 code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
 {
-    const auto clean = split(path, "?", false, false).front();
+    const auto clean = path.substr(zero, path.find('?'));
     if (clean.empty())
         return error::empty_path;
 
@@ -109,19 +123,18 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
 
     auto& method = out.method;
     auto& params = std::get<object_t>(out.params.value());
-    const auto segments = split(clean, "/", false, true);
-    BC_ASSERT(!segments.empty());
-
-    size_t segment{};
+    segment_reader segment{ clean };
+    if (segment.empty())
+        return error::invalid_target;
 
     // Accept an optional "rest" prefix (bitcoind mounts endpoints under /rest/).
-    if (segments[segment] == "rest")
-        ++segment;
+    if (segment.peek() == "rest")
+        segment.next();
 
-    if (segment == segments.size())
+    if (segment.empty())
         return error::missing_target;
 
-    const auto target = segments[segment++];
+    const auto target = segment.next();
 
     // /rest/chaininfo.json
     if (target == "chaininfo" || target == "chaininfo.json")
@@ -134,21 +147,25 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
     // /rest/block/spent/<hash>.<ext> (the latter is a libbitcoin extension).
     if (target == "block")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        std::string rest_method = "block";
-        if (segments[segment] == "notxdetails")
+        std::string_view rest_method{ "block" };
+        if (segment.peek() == "notxdetails")
             rest_method = "block_txs";
-        else if (segments[segment] == "spent")
+        else if (segment.peek() == "spent")
             rest_method = "block_spent_tx_outputs";
 
-        if (rest_method != "block" && ++segment == segments.size())
-            return error::missing_hash;
+        if (rest_method != "block")
+        {
+            segment.next();
+            if (segment.empty())
+                return error::missing_hash;
+        }
 
-        std::string name{};
+        std::string_view name{};
         uint8_t media{};
-        if (!split_leaf(name, media, segments[segment++]))
+        if (!split_leaf(name, media, segment.next()))
             return error::invalid_target;
 
         const auto hash = to_hash(name);
@@ -164,12 +181,12 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
     // /rest/blockhashbyheight/<height>.<ext>
     if (target == "blockhashbyheight")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_target;
 
-        std::string name{};
+        std::string_view name{};
         uint8_t media{};
-        if (!split_leaf(name, media, segments[segment++]))
+        if (!split_leaf(name, media, segment.next()))
             return error::invalid_target;
 
         uint32_t height{};
@@ -185,19 +202,19 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
     // /rest/headers/<count>/<hash>.<ext>
     if (target == "headers")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_target;
 
         uint32_t count{};
-        if (!to_number(count, segments[segment++]))
+        if (!to_number(count, segment.next()))
             return error::invalid_number;
 
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        std::string name{};
+        std::string_view name{};
         uint8_t media{};
-        if (!split_leaf(name, media, segments[segment++]))
+        if (!split_leaf(name, media, segment.next()))
             return error::invalid_target;
 
         const auto hash = to_hash(name);
@@ -214,19 +231,19 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
     // /rest/blockfilter/<type>/<hash>.<ext> and blockfilterheaders likewise.
     if (target == "blockfilter" || target == "blockfilterheaders")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_target;
 
         // libbitcoin supports only the "basic" (neutrino) filter type.
-        if (segments[segment++] != "basic")
+        if (segment.next() != "basic")
             return error::invalid_target;
 
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        std::string name{};
+        std::string_view name{};
         uint8_t media{};
-        if (!split_leaf(name, media, segments[segment++]))
+        if (!split_leaf(name, media, segment.next()))
             return error::invalid_target;
 
         const auto hash = to_hash(name);
@@ -244,26 +261,26 @@ code bitcoind_target(request_t& out, const std::string_view& path) NOEXCEPT
     // /rest/blockpart/<hash>/<offset>/<size>.<ext> (libbitcoin extension)
     if (target == "blockpart")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        const auto hash = to_hash(segments[segment++]);
+        const auto hash = to_hash(segment.next());
         if (!hash)
             return error::invalid_hash;
 
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_target;
 
         uint32_t offset{};
-        if (!to_number(offset, segments[segment++]))
+        if (!to_number(offset, segment.next()))
             return error::invalid_number;
 
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_target;
 
-        std::string name{};
+        std::string_view name{};
         uint8_t media{};
-        if (!split_leaf(name, media, segments[segment++]))
+        if (!split_leaf(name, media, segment.next()))
             return error::invalid_target;
 
         uint32_t size{};
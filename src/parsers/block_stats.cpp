@@ -74,57 +74,60 @@ static std::array<uint64_t, 5> fee_rate_percentiles(
     return out;
 }
 
-object_t block_stats(const chain::block& block, size_t height,
-    uint32_t median_time_past, uint64_t subsidy, bool repeat) NOEXCEPT
+block_stats_record block_summary(const chain::block& block, size_t height,
+    uint32_t median_time_past, bool repeat) NOEXCEPT
 {
     const auto& txs = *block.transactions_ptr();
 
-    uint64_t total_output{}, total_fee{}, max_fee{}, max_fee_rate{};
-    uint64_t min_fee = max_uint64, min_fee_rate = max_uint64;
-    uint64_t inputs{}, outputs{}, utxos{};
-    uint64_t max_tx_size{}, min_tx_size = max_uint64;
-    uint64_t total_size{}, total_weight{};
-    uint64_t witness_txs{}, witness_size{}, witness_weight{};
+    block_stats_record out{};
+    out.height = height;
+    out.time = block.header().timestamp();
+    out.median_time_past = median_time_past;
+    out.txs = txs.size();
+    out.min_fee = max_uint64;
+    out.min_fee_rate = max_uint64;
+    out.min_tx_size = max_uint64;
+
     std::vector<uint64_t> fees{}, sizes{};
     std::vector<std::pair<uint64_t, uint64_t>> rates{};
 
     for (const auto& tx: txs)
     {
         uint64_t tx_total_output{};
-        for (const auto& out: *tx->outputs_ptr())
+        for (const auto& output: *tx->outputs_ptr())
         {
-            tx_total_output += out->value();
+            tx_total_output += output->value();
 
             // Genesis and repeated coinbases do not add to the utxo set,
             // and unspendable outputs are not included in it.
             if (is_zero(height) || (repeat && tx->is_coinbase()) ||
-                out->script().is_unspendable())
+                output->script().is_unspendable())
                 continue;
 
-            ++utxos;
+            ++out.utxos;
         }
 
-        outputs += tx->outputs_ptr()->size();
+        out.outputs += tx->outputs_ptr()->size();
         if (tx->is_coinbase())
             continue;
 
-        inputs += tx->inputs_ptr()->size();
-        total_output += tx_total_output;
+        out.inputs += tx->inputs_ptr()->size();
+        out.total_output += tx_total_output;
 
         const uint64_t tx_size = tx->serialized_size(true);
-        max_tx_size = std::max(max_tx_size, tx_size);
-        min_tx_size = std::min(min_tx_size, tx_size);
+        out.max_tx_size = std::max(out.max_tx_size, tx_size);
+        out.min_tx_size = std::min(out.min_tx_size, tx_size);
         sizes.push_back(tx_size);
-        total_size += tx_size;
+        out.total_size += tx_size;
 
         const auto weight = tx->weight();
-        total_weight += weight;
+        out.total_weight += weight;
 
         if (tx->is_segregated())
         {
-            ++witness_txs;
-            witness_size += tx_size;
-            witness_weight += weight;
+            ++out.witness_txs;
+            out.witness_size += tx_size;
+            out.witness_weight += weight;
         }
 
         uint64_t tx_total_input{};
@@ -133,59 +136,79 @@ object_t block_stats(const chain::block& block, size_t height,
 
         const auto fee = floored_subtract(tx_total_input, tx_total_output);
         fees.push_back(fee);
-        max_fee = std::max(max_fee, fee);
-        min_fee = std::min(min_fee, fee);
-        total_fee += fee;
+        out.max_fee = std::max(out.max_fee, fee);
+        out.min_fee = std::min(out.min_fee, fee);
+        out.total_fee += fee;
 
         // The fee rate is satoshis per virtual byte.
         const auto rate = is_zero(weight) ? zero :
             (chain::light_weight_factor * fee) / weight;
         rates.emplace_back(rate, weight);
-        max_fee_rate = std::max(max_fee_rate, rate);
-        min_fee_rate = std::min(min_fee_rate, rate);
+        out.max_fee_rate = std::max(out.max_fee_rate, rate);
+        out.min_fee_rate = std::min(out.min_fee_rate, rate);
     }
 
-    const auto percentiles = fee_rate_percentiles(rates, total_weight);
-    array_t rates_result(percentiles.size());
-    std::ranges::copy(percentiles, rates_result.begin());
+    if (out.min_fee == max_uint64) out.min_fee = zero;
+    if (out.min_fee_rate == max_uint64) out.min_fee_rate = zero;
+    if (out.min_tx_size == max_uint64) out.min_tx_size = zero;
+
+    out.median_fee = truncated_median(fees);
+    out.median_tx_size = truncated_median(sizes);
+    out.fee_rate_percentiles = fee_rate_percentiles(rates, out.total_weight);
+    return out;
+}
+
+object_t block_stats(const block_stats_record& record,
+    const hash_digest& hash, uint64_t subsidy) NOEXCEPT
+{
+    array_t rates(record.fee_rate_percentiles.size());
+    std::ranges::copy(record.fee_rate_percentiles, rates.begin());
 
     // The count of non-coinbase txs (zero for a coinbase-only block).
-    const auto paying = sub1(txs.size());
+    const auto paying = floored_subtract(record.txs, one);
 
     return object_t
     {
-        { "avgfee", is_zero(paying) ? zero : total_fee / paying },
-        { "avgfeerate", is_zero(total_weight) ? zero :
-            (chain::light_weight_factor * total_fee) / total_weight },
-        { "avgtxsize", is_zero(paying) ? zero : total_size / paying },
-        { "blockhash", encode_hash(block.hash()) },
-        { "feerate_percentiles", rates_result },
-        { "height", height },
-        { "ins", inputs },
-        { "maxfee", max_fee },
-        { "maxfeerate", max_fee_rate },
-        { "maxtxsize", max_tx_size },
-        { "medianfee", truncated_median(fees) },
-        { "mediantime", median_time_past },
-        { "mediantxsize", truncated_median(sizes) },
-        { "minfee", min_fee == max_uint64 ? zero : min_fee },
-        { "minfeerate", min_fee_rate == max_uint64 ? zero : min_fee_rate },
-        { "mintxsize", min_tx_size == max_uint64 ? zero : min_tx_size },
-        { "outs", outputs },
+        { "avgfee", is_zero(paying) ? zero : record.total_fee / paying },
+        { "avgfeerate", is_zero(record.total_weight) ? zero :
+            (chain::light_weight_factor * record.total_fee) /
+                record.total_weight },
+        { "avgtxsize", is_zero(paying) ? zero : record.total_size / paying },
+        { "blockhash", encode_hash(hash) },
+        { "feerate_percentiles", rates },
+        { "height", record.height },
+        { "ins", record.inputs },
+        { "maxfee", record.max_fee },
+        { "maxfeerate", record.max_fee_rate },
+        { "maxtxsize", record.max_tx_size },
+        { "medianfee", record.median_fee },
+        { "mediantime", record.median_time_past },
+        { "mediantxsize", record.median_tx_size },
+        { "minfee", record.min_fee },
+        { "minfeerate", record.min_fee_rate },
+        { "mintxsize", record.min_tx_size },
+        { "outs", record.outputs },
         { "subsidy", subsidy },
-        { "swtotal_size", witness_size },
-        { "swtotal_weight", witness_weight },
-        { "swtxs", witness_txs },
-        { "time", block.header().timestamp() },
-        { "total_out", total_output },
-        { "total_size", total_size },
-        { "total_weight", total_weight },
-        { "totalfee", total_fee },
-        { "txs", txs.size() },
-        { "utxo_increase", delta(outputs, inputs) },
-        { "utxo_increase_actual", delta(utxos, inputs) }
+        { "swtotal_size", record.witness_size },
+        { "swtotal_weight", record.witness_weight },
+        { "swtxs", record.witness_txs },
+        { "time", record.time },
+        { "total_out", record.total_output },
+        { "total_size", record.total_size },
+        { "total_weight", record.total_weight },
+        { "totalfee", record.total_fee },
+        { "txs", record.txs },
+        { "utxo_increase", delta(record.outputs, record.inputs) },
+        { "utxo_increase_actual", delta(record.utxos, record.inputs) }
     };
 }
 
+object_t block_stats(const chain::block& block, size_t height,
+    uint32_t median_time_past, uint64_t subsidy, bool repeat) NOEXCEPT
+{
+    return block_stats(block_summary(block, height, median_time_past, repeat),
+        block.hash(), subsidy);
+}
+
 } // namespace server
 } // namespace libbitcoin
@@ -18,6 +18,8 @@
  */
 #include <bitcoin/server/parsers/native_query.hpp>
 
+#include <optional>
+#include <string_view>
 #include <bitcoin/server/define.hpp>
 
 namespace libbitcoin {
@@ -30,32 +32,103 @@ using namespace network::http;
 BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
-inline bool is_true(const std::string& value) NOEXCEPT
+// Decode a percent-encoded octet (the two characters following '%').
+static bool to_octet(char& out, const std::string_view& encoded) NOEXCEPT
 {
-    return value == native::token::true_;
+    data_array<one> octet{};
+    if (encoded.size() < two ||
+        !decode_base16(octet, encoded.substr(zero, two)))
+        return false;
+
+    out = static_cast<char>(octet.front());
+    return true;
+}
+
+// Unreserved, reserved and well-formed percent-encoded characters only.
+static bool is_uri(const std::string_view& target) NOEXCEPT
+{
+    if (target.empty())
+        return false;
+
+    constexpr std::string_view symbols{ "-._~:/?#[]@!$&'()*+,;=" };
+    for (size_t position{}; position < target.size(); ++position)
+    {
+        const auto character = target[position];
+        if (character == '%')
+        {
+            char octet{};
+            if (!to_octet(octet, target.substr(add1(position))))
+                return false;
+
+            position += two;
+        }
+        else if (!is_ascii_number(character) &&
+            !(character >= 'a' && character <= 'z') &&
+            !(character >= 'A' && character <= 'Z') &&
+            symbols.find(character) == std::string_view::npos)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Compare a (valid) percent-encoded token to a literal, decoding in place.
+static bool is_token(const std::string_view& encoded,
+    const std::string_view& literal) NOEXCEPT
+{
+    size_t position{};
+    for (const auto character: literal)
+    {
+        if (position == encoded.size())
+            return false;
+
+        auto next = encoded[position++];
+        if (next == '%')
+        {
+            to_octet(next, encoded.substr(position));
+            position += two;
+        }
+
+        if (next != character)
+            return false;
+    }
+
+    return position == encoded.size();
 }
 
-inline bool is_false(const std::string& value) NOEXCEPT
+inline bool is_true(const std::string_view& value) NOEXCEPT
 {
-    return value == native::token::false_;
+    return is_token(value, native::token::true_);
 }
 
-inline void set_media(rpc::object_t& params, media_type media) NOEXCEPT
+inline bool is_false(const std::string_view& value) NOEXCEPT
 {
-    params["media"] = to_value(media);
+    return is_token(value, native::token::false_);
 }
 
-bool native_query(rpc::request_t& out, const request& request) NOEXCEPT
+// Optional booleans, absent (nullopt) retains the default.
+static bool to_flag(bool& out, const std::optional<std::string_view>& value)
+    NOEXCEPT
 {
-    const auto accepts = to_media_types((request)[field::accept]);
-    return native_query(out, request.target(), accepts);
+    if (!value.has_value())
+        return true;
+
+    if (is_true(value.value()))
+        out = true;
+    else if (is_false(value.value()))
+        out = false;
+    else
+        return false;
+
+    return true;
 }
 
-bool native_query(rpc::request_t& out, const std::string& target,
+bool native_query(native_request& out, const std::string_view& target,
     const media_types& accepts) NOEXCEPT
 {
-    wallet::uri uri{};
-    if (!uri.decode(target))
+    if (!is_uri(target))
         return false;
 
     constexpr auto html = media_type::text_html;
@@ -63,71 +136,110 @@ bool native_query(rpc::request_t& out, const std::string& target,
     constexpr auto json = media_type::application_json;
     constexpr auto data = media_type::application_octet_stream;
 
-    // Caller must have provided a request.params object.
-    if (!out.params.has_value() ||
-        !std::holds_alternative<rpc::object_t>(out.params.value()))
-        return false;
-
     using namespace server::native;
-    auto query = uri.decode_query();
-    auto& params = std::get<rpc::object_t>(out.params.value());
+    std::optional<std::string_view> witness{};
+    std::optional<std::string_view> turbo{};
+    std::optional<std::string_view> stop{};
+    std::string_view format{};
 
-    // Witness is optional<true> (where applicable), so only set if false.
-    if (const auto witness = query.find(token::witness); witness != query.end())
-    {
-        if (is_false(witness->second))
-            params[token::witness] = false;
-        else if (!is_true(witness->second))
-            return false;
-    }
+    // Tokenize the query (excluding fragment) in place, last value wins.
+    auto query = target.substr(zero, target.find('#'));
+    const auto start = query.find('?');
+    query = start == std::string_view::npos ? std::string_view{} :
+        query.substr(add1(start));
 
-    // Turbo is optional<true> (where applicable), so only set if false.
-    if (const auto turbo = query.find(token::turbo); turbo != query.end())
+    while (!query.empty())
     {
-        if (is_false(turbo->second))
-            params[token::turbo] = false;
-        else if (!is_true(turbo->second))
-            return false;
-    }
+        const auto end = query.find('&');
+        const auto pair = query.substr(zero, end);
+        query = end == std::string_view::npos ? std::string_view{} :
+            query.substr(add1(end));
 
-    // Stop is optional<false> (where applicable), so only set if true.
-    if (const auto stop = query.find(token::stop); stop != query.end())
-    {
-        if (is_true(stop->second))
-            params[token::stop] = true;
-        else if (!is_false(stop->second))
-            return false;
+        const auto split = pair.find('=');
+        const auto key = pair.substr(zero, split);
+        const auto value = split == std::string_view::npos ?
+            std::string_view{} : pair.substr(add1(split));
+
+        if (is_token(key, token::witness))
+            witness = value;
+        else if (is_token(key, token::turbo))
+            turbo = value;
+        else if (is_token(key, token::stop))
+            stop = value;
+        else if (is_token(key, token::format))
+            format = value;
     }
 
-    const auto format = query[token::format];
+    // Witness and turbo are optional<true>, stop is optional<false>.
+    if (!to_flag(out.witness, witness) ||
+        !to_flag(out.turbo, turbo) ||
+        !to_flag(out.stop, stop))
+        return false;
 
     // Prioritize query string format over http headers.
-    if (format == token::formats::json)
-        set_media(params, json);
-    else if (format == token::formats::text)
-        set_media(params, text);
-    else if (format == token::formats::data)
-        set_media(params, data);
-    else if (format == token::formats::html)
-        set_media(params, html);
+    if (is_token(format, token::formats::json))
+        out.media = json;
+    else if (is_token(format, token::formats::text))
+        out.media = text;
+    else if (is_token(format, token::formats::data))
+        out.media = data;
+    else if (is_token(format, token::formats::html))
+        out.media = html;
     else if (!format.empty())
         return false;
 
     // Prioritize: json, html, text, data (ignores accept priorities).
     else if (contains(accepts, json))
-        set_media(params, json);
+        out.media = json;
     else if (contains(accepts, html))
-        set_media(params, html);
+        out.media = html;
     else if (contains(accepts, text))
-        set_media(params, text);
+        out.media = text;
     else if (contains(accepts, data))
-        set_media(params, data);
+        out.media = data;
     //else no media type is set, which results in not acceptable.
 
     // Parse successful, media type not acceptable if not set.
     return true;
 }
 
+bool native_query(rpc::request_t& out, const request& request) NOEXCEPT
+{
+    const auto accepts = to_media_types((request)[field::accept]);
+    return native_query(out, request.target(), accepts);
+}
+
+bool native_query(rpc::request_t& out, const std::string& target,
+    const media_types& accepts) NOEXCEPT
+{
+    // Caller must have provided a request.params object.
+    if (!out.params.has_value() ||
+        !std::holds_alternative<rpc::object_t>(out.params.value()))
+        return false;
+
+    native_request parsed{};
+    if (!native_query(parsed, target, accepts))
+        return false;
+
+    using namespace server::native;
+    auto& params = std::get<rpc::object_t>(out.params.value());
+
+    // Set only where not the default.
+    if (!parsed.witness)
+        params[token::witness] = false;
+
+    if (!parsed.turbo)
+        params[token::turbo] = false;
+
+    if (parsed.stop)
+        params[token::stop] = true;
+
+    if (parsed.media != media_type::unknown)
+        params["media"] = to_value(parsed.media);
+
+    return true;
+}
+
 media_type get_media(const rpc::request_t& model) NOEXCEPT
 {
     if (model.params.has_value())
@@ -18,10 +18,11 @@
  */
 #include <bitcoin/server/parsers/native_target.hpp>
 
-#include <ranges>
+#include <array>
 #include <optional>
 #include <variant>
 #include <bitcoin/server/define.hpp>
+#include "segment_reader.hpp"
 
 namespace libbitcoin {
 namespace server {
@@ -39,128 +40,142 @@ static bool to_number(Number& out, const std::string_view& token) NOEXCEPT
         token.front() != '0') && deserialize(out, token);
 }
 
-static hash_cptr to_hash(const std::string_view& token) NOEXCEPT
+static constexpr std::array<std::string_view, 32> method_names
 {
-    hash_digest out{};
-    return decode_hash(out, token) ?
-        emplace_shared<const hash_digest>(std::move(out)) : hash_cptr{};
+    "configuration",
+    "top",
+    "top_subscribe",
+    "block",
+    "block_header",
+    "block_header_context",
+    "block_details",
+    "block_txs",
+    "block_filter",
+    "block_filter_hash",
+    "block_filter_header",
+    "block_tx",
+    "block_subscribe",
+    "tx",
+    "tx_header",
+    "tx_details",
+    "tx_subscribe",
+    "inputs",
+    "input",
+    "input_script",
+    "input_witness",
+    "outputs",
+    "output",
+    "output_script",
+    "output_spender",
+    "output_spenders",
+    "output_subscribe",
+    "address",
+    "address_confirmed",
+    "address_unconfirmed",
+    "address_balance",
+    "address_subscribe"
+};
+
+std::string_view to_method(native_method method) NOEXCEPT
+{
+    const auto index = static_cast<size_t>(method);
+    return index < method_names.size() ? method_names[index] :
+        std::string_view{};
 }
 
-code native_target(request_t& out, const std::string_view& path) NOEXCEPT
+code native_target(native_request& out, const std::string_view& path) NOEXCEPT
 {
-    const auto clean = split(path, "?", false, false).front();
+    using method = native_method;
+    const auto clean = path.substr(zero, path.find('?'));
     if (clean.empty())
         return error::empty_path;
 
-    // Avoid conflict with node type.
-    using object_t = network::rpc::object_t;
-
-    // Initialize json-rpc.v2 named params message.
-    out = request_t
-    {
-        .jsonrpc = version::v2,
-        .id = null_t{},
-        .method = {},
-        .params = object_t{}
-    };
-
-    auto& method = out.method;
-    auto& params = std::get<object_t>(out.params.value());
-    const auto segments = split(clean, "/", false, true);
-    BC_ASSERT(!segments.empty());
-
-    size_t segment{};
-    if (!segments[segment].starts_with('v'))
+    out = {};
+    segment_reader segment{ clean };
+    if (segment.empty() || !segment.peek().starts_with('v'))
         return error::missing_version;
 
-    uint8_t version{};
-    if (!to_number(version, segments[segment++].substr(one)))
+    if (!to_number(out.version, segment.next().substr(one)))
         return error::invalid_number;
 
-    params["version"] = version;
-    if (segment == segments.size())
+    if (segment.empty())
         return error::missing_target;
 
-    const auto target = segments[segment++];
+    const auto target = segment.next();
     if (target == "configuration")
     {
-        method = "configuration";
+        out.method = method::configuration;
     }
     else if (target == "top")
     {
-        if (segment == segments.size())
+        if (segment.empty())
         {
-            method = "top";
+            out.method = method::top;
         }
         else
         {
-            const auto subcomponent = segments[segment++];
+            const auto subcomponent = segment.next();
             if (subcomponent == "subscribe")
-                method = "top_subscribe";
+                out.method = method::top_subscribe;
             else
                 return error::invalid_subcomponent;
         }
     }
     else if (target == "address")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        const auto base16 = to_hash(segments[segment++]);
-        if (!base16) return error::invalid_hash;
+        if (!decode_hash(out.hash.emplace(), segment.next()))
+            return error::invalid_hash;
 
-        params["hash"] = base16;
-        if (segment == segments.size())
+        if (segment.empty())
         {
-            method = "address";
+            out.method = method::address;
         }
         else
         {
-            const auto subcomponent = segments[segment++];
+            const auto subcomponent = segment.next();
             if (subcomponent == "confirmed")
-                method = "address_confirmed";
+                out.method = method::address_confirmed;
             else if (subcomponent == "unconfirmed")
-                method = "address_unconfirmed";
+                out.method = method::address_unconfirmed;
             else if (subcomponent == "balance")
-                method = "address_balance";
+                out.method = method::address_balance;
             else if (subcomponent == "subscribe")
-                method = "address_subscribe";
+                out.method = method::address_subscribe;
             else
                 return error::invalid_subcomponent;
         }
     }
     else if (target == "input")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        const auto hash = to_hash(segments[segment++]);
-        if (!hash) return error::invalid_hash;
+        if (!decode_hash(out.hash.emplace(), segment.next()))
+            return error::invalid_hash;
 
-        params["hash"] = hash;
-        if (segment == segments.size())
+        if (segment.empty())
         {
-            method = "inputs";
+            out.method = method::inputs;
         }
         else
         {
-            const auto component = segments[segment++];
-            uint32_t index{};
-            if (!to_number(index, component))
+            if (!to_number(out.index, segment.next()))
                 return error::invalid_number;
 
-            params["index"] = index;
-            if (segment == segments.size())
+            if (segment.empty())
             {
-                method = "input";
+                out.method = method::input;
             }
             else
             {
-                const auto subcomponent = segments[segment++];
+                const auto subcomponent = segment.next();
                 if (subcomponent == "script")
-                    method = "input_script";
+                    out.method = method::input_script;
                 else if (subcomponent == "witness")
-                    method = "input_witness";
+                    out.method = method::input_witness;
                 else
                     return error::invalid_subcomponent;
             }
@@ -168,40 +183,36 @@ code native_target(request_t& out, const std::string_view& path) NOEXCEPT
     }
     else if (target == "output")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        const auto hash = to_hash(segments[segment++]);
-        if (!hash) return error::invalid_hash;
+        if (!decode_hash(out.hash.emplace(), segment.next()))
+            return error::invalid_hash;
 
-        params["hash"] = hash;
-        if (segment == segments.size())
+        if (segment.empty())
         {
-            method = "outputs";
+            out.method = method::outputs;
         }
         else
         {
-            const auto component = segments[segment++];
-            uint32_t index{};
-            if (!to_number(index, component))
+            if (!to_number(out.index, segment.next()))
                 return error::invalid_number;
 
-            params["index"] = index;
-            if (segment == segments.size())
+            if (segment.empty())
             {
-                method = "output";
+                out.method = method::output;
             }
             else
             {
-                const auto subcomponent = segments[segment++];
+                const auto subcomponent = segment.next();
                 if (subcomponent == "script")
-                    method = "output_script";
+                    out.method = method::output_script;
                 else if (subcomponent == "spender")
-                    method = "output_spender";
+                    out.method = method::output_spender;
                 else if (subcomponent == "spenders")
-                    method = "output_spenders";
+                    out.method = method::output_spenders;
                 else if (subcomponent == "subscribe")
-                    method = "output_subscribe";
+                    out.method = method::output_subscribe;
                 else
                     return error::invalid_subcomponent;
             }
@@ -209,32 +220,30 @@ code native_target(request_t& out, const std::string_view& path) NOEXCEPT
     }
     else if (target == "tx")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_hash;
 
-        const auto next = segments[segment];
-        if (next == "subscribe")
+        if (segment.peek() == "subscribe")
         {
-            segment++;
-            method = "tx_subscribe";
+            segment.next();
+            out.method = method::tx_subscribe;
         }
         else
         {
-            const auto hash = to_hash(segments[segment++]);
-            if (!hash) return error::invalid_hash;
+            if (!decode_hash(out.hash.emplace(), segment.next()))
+                return error::invalid_hash;
 
-            params["hash"] = hash;
-            if (segment == segments.size())
+            if (segment.empty())
             {
-                method = "tx";
+                out.method = method::tx;
             }
             else
             {
-                const auto component = segments[segment++];
+                const auto component = segment.next();
                 if (component == "header")
-                    method = "tx_header";
+                    out.method = method::tx_header;
                 else if (component == "details")
-                    method = "tx_details";
+                    out.method = method::tx_details;
                 else
                     return error::invalid_component;
             }
@@ -242,103 +251,93 @@ code native_target(request_t& out, const std::string_view& path) NOEXCEPT
     }
     else if (target == "block")
     {
-        if (segment == segments.size())
+        if (segment.empty())
             return error::missing_id_type;
 
-        const auto by = segments[segment];
+        // Consume the identifier type.
+        const auto by = segment.next();
         if (by == "subscribe")
         {
-            segment++;
-            method = "block_subscribe";
+            out.method = method::block_subscribe;
         }
         else
         {
-            segment++; // consume the identifier type
             if (by == "hash")
             {
-                if (segment == segments.size())
+                if (segment.empty())
                     return error::missing_hash;
 
-                const auto hash = to_hash(segments[segment++]);
-                if (!hash) return error::invalid_hash;
-
-                params["hash"] = hash;
+                if (!decode_hash(out.hash.emplace(), segment.next()))
+                    return error::invalid_hash;
             }
             else if (by == "height")
             {
-                if (segment == segments.size())
+                if (segment.empty())
                     return error::missing_height;
 
-                uint32_t height{};
-                if (!to_number(height, segments[segment++]))
+                if (!to_number(out.height.emplace(), segment.next()))
                     return error::invalid_number;
-
-                params["height"] = height;
             }
             else
             {
                 return error::invalid_id_type;
             }
 
-            if (segment == segments.size())
+            if (segment.empty())
             {
-                method = "block";
+                out.method = method::block;
             }
             else
             {
-                const auto component = segments[segment++];
+                const auto component = segment.next();
                 if (component == "tx")
                 {
-                    if (segment == segments.size())
+                    if (segment.empty())
                         return error::missing_position;
 
-                    uint32_t position{};
-                    if (!to_number(position, segments[segment++]))
+                    if (!to_number(out.position, segment.next()))
                         return error::invalid_number;
 
-                    params["position"] = position;
-                    method = "block_tx";
+                    out.method = method::block_tx;
                 }
                 else if (component == "header")
                 {
-                    if (segment == segments.size())
+                    if (segment.empty())
                     {
-                        method = "block_header";
+                        out.method = method::block_header;
                     }
                     else
                     {
-                        const auto subcomponent = segments[segment++];
+                        const auto subcomponent = segment.next();
                         if (subcomponent == "context")
-                            method = "block_header_context";
+                            out.method = method::block_header_context;
                         else
                             return error::invalid_subcomponent;
                     }
                 }
                 else if (component == "txs")
-                    method = "block_txs";
+                    out.method = method::block_txs;
                 else if (component == "details")
-                    method = "block_details";
+                    out.method = method::block_details;
                 else if (component == "filter")
                 {
-                    if (segment == segments.size())
+                    if (segment.empty())
                         return error::missing_type_id;
 
-                    uint8_t type{};
-                    if (!to_number(type, segments[segment++]))
+                    if (!to_number(out.type, segment.next()))
                         return error::invalid_number;
 
-                    params["type"] = type;
-                    if (segment == segments.size())
+                    if (segment.empty())
                     {
-                        method = "block_filter";
+                        out.method = method::block_filter;
                     }
                     else
                     {
-                        const auto subcomponent = segments[segment++];
+                        const auto subcomponent = segment.next();
                         if (subcomponent == "hash")
-                            method = "block_filter_hash";
+                            out.method = method::block_filter_hash;
                         else if (subcomponent == "header")
-                            method = "block_filter_header";
+                            out.method = method::block_filter_header;
                         else
                             return error::invalid_subcomponent;
                     }
@@ -353,7 +352,72 @@ code native_target(request_t& out, const std::string_view& path) NOEXCEPT
         return error::invalid_target;
     }
 
-    return segment == segments.size() ? error::success : error::extra_segment;
+    return segment.empty() ? error::success : error::extra_segment;
+}
+
+static bool has_index(native_method method) NOEXCEPT
+{
+    switch (method)
+    {
+        case native_method::input:
+        case native_method::input_script:
+        case native_method::input_witness:
+        case native_method::output:
+        case native_method::output_script:
+        case native_method::output_spender:
+        case native_method::output_spenders:
+        case native_method::output_subscribe:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool has_type(native_method method) NOEXCEPT
+{
+    return method == native_method::block_filter
+        || method == native_method::block_filter_hash
+        || method == native_method::block_filter_header;
+}
+
+code native_target(request_t& out, const std::string_view& path) NOEXCEPT
+{
+    native_request request{};
+    if (const auto ec = native_target(request, path))
+        return ec;
+
+    // Avoid conflict with node type.
+    using object_t = network::rpc::object_t;
+
+    // Initialize json-rpc.v2 named params message.
+    out = request_t
+    {
+        .jsonrpc = version::v2,
+        .id = null_t{},
+        .method = std::string{ to_method(request.method) },
+        .params = object_t{}
+    };
+
+    auto& params = std::get<object_t>(out.params.value());
+    params["version"] = request.version;
+
+    if (request.hash.has_value())
+        params["hash"] = emplace_shared<const hash_digest>(
+            std::move(request.hash.value()));
+
+    if (request.height.has_value())
+        params["height"] = request.height.value();
+
+    if (has_index(request.method))
+        params["index"] = request.index;
+
+    if (request.method == native_method::block_tx)
+        params["position"] = request.position;
+
+    if (has_type(request.method))
+        params["type"] = request.type;
+
+    return error::success;
 }
 
 BC_POP_WARNING()
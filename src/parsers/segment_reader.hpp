@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SERVER_PARSERS_SEGMENT_READER_HPP
+#define LIBBITCOIN_SERVER_PARSERS_SEGMENT_READER_HPP
+
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+/// Walks the non-empty '/' delimited segments of a path in place (the path
+/// must outlive the reader). Shared by the url target parsers.
+class segment_reader
+{
+public:
+    segment_reader(const std::string_view& path) NOEXCEPT
+      : path_(path), position_(skip(zero))
+    {
+    }
+
+    bool empty() const NOEXCEPT
+    {
+        return position_ == path_.size();
+    }
+
+    std::string_view peek() const NOEXCEPT
+    {
+        const auto end = path_.find('/', position_);
+        return path_.substr(position_, end == std::string_view::npos ?
+            std::string_view::npos : end - position_);
+    }
+
+    std::string_view next() NOEXCEPT
+    {
+        const auto segment = peek();
+        position_ = skip(position_ + segment.size());
+        return segment;
+    }
+
+private:
+    size_t skip(size_t position) const NOEXCEPT
+    {
+        while (position < path_.size() && path_[position] == '/')
+            ++position;
+
+        return position;
+    }
+
+    const std::string_view path_;
+    size_t position_;
+};
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
+
+#endif
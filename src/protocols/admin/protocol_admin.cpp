@@ -54,6 +54,9 @@ void protocol_admin::start() NOEXCEPT
     // Subscription methods.
     SUBSCRIBE_ADMIN(handle_get_log_subscribe, _1, _2, _3, _4);
     SUBSCRIBE_ADMIN(handle_get_event_subscribe, _1, _2, _3, _4);
+    SUBSCRIBE_ADMIN(handle_get_stratum_workers, _1, _2, _3);
+    SUBSCRIBE_ADMIN(handle_get_request_metrics, _1, _2, _3);
+    SUBSCRIBE_ADMIN(handle_get_metrics, _1, _2, _3);
     protocol_html::start();
 }
 
@@ -100,6 +103,15 @@ bool protocol_admin::try_dispatch_object(const http::request& request) NOEXCEPT
     if (media == media_type::text_html)
         return false;
 
+    // Text is the metrics exposition format, otherwise undefined.
+    if (!is_acceptable(model.method, media))
+    {
+        send_not_acceptable(request);
+        return true;
+    }
+
+    media_ = media;
+    start_request(model.method);
     if (const auto ec = dispatcher_.notify(model))
         send_internal_server_error(ec, request);
 
@@ -145,6 +157,7 @@ void protocol_admin::dispatch_websocket(const http::request& request) NOEXCEPT
         return;
     }
 
+    media_ = media_type::application_json;
     if (const auto ec = dispatcher_.notify(model))
     {
         stop(network::error::internal_server_error);
@@ -189,6 +202,97 @@ bool protocol_admin::handle_get_event_subscribe(const code& ec,
     return true;
 }
 
+bool protocol_admin::handle_get_stratum_workers(const code& ec,
+    interface::stratum_workers, uint8_t /*version*/) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped(ec))
+        return false;
+
+    const auto summaries = accounts_.aggregate();
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    boost::json::array workers{};
+    workers.reserve(summaries.size());
+    for (const auto& summary: summaries)
+    {
+        workers.push_back(boost::json::object
+        {
+            { "worker", summary.worker },
+            { "accepted", summary.accepted },
+            { "rejected", summary.rejected },
+            { "stale", summary.stale },
+            { "work", summary.work },
+            { "blocks", summary.blocks },
+            { "rate", summary.shares_per_minute }
+        });
+    }
+
+    send_json({ { "workers", std::move(workers) } },
+        64u + summaries.size() * 160u);
+    BC_POP_WARNING()
+    return true;
+}
+
+bool protocol_admin::handle_get_request_metrics(const code& ec,
+    interface::request_metrics, uint8_t /*version*/) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped(ec))
+        return false;
+
+    const auto summaries = requests_.aggregate();
+    if (media_ == media_type::text_plain)
+    {
+        send_text(request_metrics::to_prometheus(summaries));
+        return true;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    boost::json::array requests{};
+    requests.reserve(summaries.size());
+    for (const auto& summary: summaries)
+    {
+        requests.push_back(boost::json::object
+        {
+            { "interface", summary.interface },
+            { "method", summary.method },
+            { "requests", summary.requests },
+            { "errors", summary.errors },
+            { "bytes", summary.bytes },
+            { "usecs", summary.usecs },
+            { "p50_usecs", summary.p50_usecs },
+            { "p90_usecs", summary.p90_usecs },
+            { "p99_usecs", summary.p99_usecs },
+            { "maximum_usecs", summary.maximum_usecs }
+        });
+    }
+
+    send_json({ { "requests", std::move(requests) } },
+        64u + summaries.size() * 256u);
+    BC_POP_WARNING()
+    return true;
+}
+
+bool protocol_admin::handle_get_metrics(const code& ec, interface::metrics,
+    uint8_t /*version*/) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped(ec))
+        return false;
+
+    // All sources are pre-aggregated, so rendering takes no locks beyond the
+    // request metrics method map (shared).
+    auto text = counters_.to_prometheus();
+    text += store_metrics();
+    text += request_metrics::to_prometheus(requests_.aggregate());
+    send_text(std::move(text));
+    return true;
+}
+
 // Event handlers.
 // ----------------------------------------------------------------------------
 
@@ -285,6 +389,60 @@ bool protocol_admin::get_filter(bool& filtered, size_t bit,
     return true;
 }
 
+// Text (Prometheus exposition) is rendered only by metrics methods, and the
+// scrape endpoint renders only text.
+bool protocol_admin::is_acceptable(const std::string& method,
+    media_type media) NOEXCEPT
+{
+    if (method == "metrics")
+        return media == media_type::text_plain;
+
+    return media != media_type::text_plain || method == "request_metrics";
+}
+
+// Open channels, chain heights and store table body sizes (gauges).
+std::string protocol_admin::store_metrics() const NOEXCEPT
+{
+    const auto& query = archive();
+    const std::pair<std::string, size_t> tables[]
+    {
+        { "header", query.header_body_size() },
+        { "txs", query.txs_body_size() },
+        { "tx", query.tx_body_size() },
+        { "input", query.input_body_size() },
+        { "output", query.output_body_size() },
+        { "ins", query.ins_body_size() },
+        { "outs", query.outs_body_size() },
+        { "candidate", query.candidate_body_size() },
+        { "confirmed", query.confirmed_body_size() },
+        { "prevout", query.prevout_body_size() },
+        { "strong_tx", query.strong_tx_body_size() },
+        { "filter_bk", query.filter_bk_body_size() },
+        { "filter_tx", query.filter_tx_body_size() }
+    };
+
+    std::string out{};
+    out += "# HELP libbitcoin_server_channels Open channels.\n";
+    out += "# TYPE libbitcoin_server_channels gauge\n";
+    out += "libbitcoin_server_channels " + std::to_string(channel_count()) +
+        "\n";
+
+    out += "# HELP libbitcoin_server_chain_height Top block height.\n";
+    out += "# TYPE libbitcoin_server_chain_height gauge\n";
+    out += "libbitcoin_server_chain_height{chain=\"confirmed\"} " +
+        std::to_string(query.get_top_confirmed()) + "\n";
+    out += "libbitcoin_server_chain_height{chain=\"candidate\"} " +
+        std::to_string(query.get_top_candidate()) + "\n";
+
+    out += "# HELP libbitcoin_server_store_body_bytes Store table body size.\n";
+    out += "# TYPE libbitcoin_server_store_body_bytes gauge\n";
+    for (const auto& [table, size]: tables)
+        out += "libbitcoin_server_store_body_bytes{table=\"" + table +
+            "\"} " + std::to_string(size) + "\n";
+
+    return out;
+}
+
 // Subscribe if true.
 bool protocol_admin::update_filter(uint64_t& prior, uint64_t value,
     filter_t& filter) NOEXCEPT
@@ -19,6 +19,8 @@
 #include <bitcoin/server/protocols/protocol_bitcoind.hpp>
 
 #include <algorithm>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -40,11 +42,41 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 BC_PUSH_WARNING(SMART_PTR_NOT_NEEDED)
 BC_PUSH_WARNING(NO_VALUE_OR_CONST_REF_SHARED_PTR)
 
+// Routes.
+// ----------------------------------------------------------------------------
+// This class is attached to the channel after the subgroup protocols and is
+// routed to each by its interface group (by the session, before start).
+
+void protocol_bitcoind::route(uint8_t group, const ptr& owner) NOEXCEPT
+{
+    routes_.at(group) = owner;
+}
+
+// Owners are attached to this channel, so routes must not outlive stop.
+void protocol_bitcoind::stopping(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    routes_.fill({});
+    network::protocol_http::stopping(ec);
+}
+
+// One table probe resolves the interface group of the method.
+protocol_bitcoind& protocol_bitcoind::owner(const std::string& method) NOEXCEPT
+{
+    const auto entry = interface::bitcoind_map::find(method);
+    if (is_null(entry))
+        return *this;
+
+    const auto& owner = routes_.at(entry->group);
+    return owner ? *owner : *this;
+}
+
 // Terminal dispatch.
 // ----------------------------------------------------------------------------
-// This class is attached to the channel after the subgroup protocols, which
-// claim requests defined by their interfaces. Defaults are sent here exactly
-// once and only when no subgroup has claimed the request.
+// Requests not claimed by a protocol attached ahead of the subgroups (rest or
+// btcd) are validated here once, then dispatched only to the owning subgroup.
+// Defaults are sent here exactly once and only when no subgroup owns the
+// method.
 
 // Claimed by rest (when attached), otherwise disallowed.
 void protocol_bitcoind::handle_receive_get(const code& ec,
@@ -87,7 +119,7 @@ void protocol_bitcoind::handle_receive_options(const code& ec,
     send_ok(*options);
 }
 
-// The subgroup protocols handle claimed posts.
+// The owning subgroup protocol handles valid posts.
 void protocol_bitcoind::handle_receive_post(const code& ec,
     const post::cptr& post) NOEXCEPT
 {
@@ -96,7 +128,7 @@ void protocol_bitcoind::handle_receive_post(const code& ec,
     if (stopped(ec))
         return;
 
-    // A subgroup protocol has claimed (and responds to) the request.
+    // A protocol attached earlier has claimed (and responds to) the request.
     if (claimed())
         return;
 
@@ -125,29 +157,17 @@ void protocol_bitcoind::handle_receive_post(const code& ec,
     // v1 or v2 both supported, batch not yet supported.
     // v1 null id and v2 missing id implies notification and no response.
     const auto& message = post->body().get<request>().message;
-
-    // Cache request context for response building (version + id).
-    set_rpc_request(message.jsonrpc, message.id, post);
-
-    // The credential may be restricted to a subset of interface methods.
-    if (!permitted(message.method))
-    {
-        send_error(error::method_unauthorized);
-        return;
-    }
-
-    // No subgroup interface defines the method.
-    send_error(network::error::unexpected_method);
+    owner(message.method).dispatch_post(post, message);
 }
 
-// The websocket transport of the interface: subgroup protocols handle claimed
-// frames, invalid frames stop the channel here.
+// The websocket transport of the interface: the owning subgroup protocol
+// handles valid frames, invalid frames stop the channel here.
 void protocol_bitcoind::dispatch_websocket(
     const network::http::request& request) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    // A subgroup protocol has claimed (and responds to) the request.
+    // A protocol attached earlier has claimed (and responds to) the request.
     if (claimed())
         return;
 
@@ -167,6 +187,33 @@ void protocol_bitcoind::dispatch_websocket(
     }
 
     const auto& message = request.body().get<rpc::request>().message;
+    owner(message.method).dispatch_frame(request, message);
+}
+
+// No routed subgroup interface defines the method.
+void protocol_bitcoind::dispatch_post(const post::cptr& post,
+    const request_t& message) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Cache request context for response building (version + id).
+    set_rpc_request(message.jsonrpc, message.id, post);
+
+    // The credential may be restricted to a subset of interface methods.
+    if (!permitted(message.method))
+    {
+        send_error(error::method_unauthorized);
+        return;
+    }
+
+    send_error(network::error::unexpected_method);
+}
+
+// No routed subgroup interface defines the method.
+void protocol_bitcoind::dispatch_frame(const network::http::request&,
+    const request_t& message) NOEXCEPT
+{
+    BC_ASSERT(stranded());
 
     // Cache request context for response building (version + id).
     set_rpc_request(message);
@@ -178,7 +225,6 @@ void protocol_bitcoind::dispatch_websocket(
         return;
     }
 
-    // No subgroup interface defines the method.
     send_error(network::error::unexpected_method);
 }
 
@@ -270,6 +316,20 @@ void protocol_bitcoind::send_rpc(response_t&& model, size_t size_hint,
     using namespace http;
     static const auto json = from_media_type(media_type::application_json);
 
+    // Record the request and feed its query time back to the client bucket.
+    if (!method_.empty())
+    {
+        const auto elapsed = rate_limiter::clock::now() - started_;
+        metrics_.record(interface_, method_, elapsed, size_hint,
+            model.error.has_value());
+
+        if (!client_.empty())
+            limiter_->charge(client_, zero, elapsed);
+
+        method_.clear();
+        client_.clear();
+    }
+
     if (websocket())
     {
         id_.reset();
@@ -316,6 +376,43 @@ void protocol_bitcoind::set_rpc_request(const request_t& message) NOEXCEPT
     version_ = message.jsonrpc;
 }
 
+// protected
+bool protocol_bitcoind::admitted(const std::string& method,
+    const http::request& request) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    method_ = method;
+    started_ = rate_limiter::clock::now();
+    if (is_null(limiter_))
+        return true;
+
+    // An authenticated user is limited across all of its connections. The
+    // header is authenticated by the channel only where credentials are
+    // enforced, so otherwise (and for headerless websocket frames) the client
+    // is limited by peer address. Names are prefixed to exclude addresses.
+    const auto user = enforced_ ? to_user(request) : std::string{};
+    client_ = user.empty() ? authority().ip().to_string() : "user:" + user;
+
+    return limiter_->admit(client_, method, started_);
+}
+
+// private
+std::string protocol_bitcoind::to_user(const http::request& request) NOEXCEPT
+{
+    constexpr std::string_view scheme{ "Basic " };
+    const std::string_view value{ request[http::field::authorization] };
+    if (!value.starts_with(scheme))
+        return {};
+
+    data_chunk decoded{};
+    if (!decode_base64(decoded, std::string{ value.substr(scheme.size()) }))
+        return {};
+
+    const std::string text{ decoded.begin(), decoded.end() };
+    const auto colon = text.find(':');
+    return colon == std::string::npos ? std::string{} : text.substr(0, colon);
+}
+
 // private
 http::request_cptr protocol_bitcoind::reset_rpc_request() NOEXCEPT
 {
@@ -19,6 +19,7 @@
 #include <bitcoin/server/protocols/protocol_bitcoind_blockchain.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <ranges>
 #include <unordered_set>
 #include <utility>
@@ -99,9 +100,9 @@ void protocol_bitcoind_blockchain::start() NOEXCEPT
     SUBSCRIBE_BITCOIND(handle_get_difficulty, _1, _2);
     SUBSCRIBE_BITCOIND(handle_precious_block, _1, _2);
     SUBSCRIBE_BITCOIND(handle_scan_blocks, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_wait_for_block, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_wait_for_block_height, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_wait_for_new_block, _1, _2);
+    SUBSCRIBE_BITCOIND(handle_wait_for_block, _1, _2, _3, _4);
+    SUBSCRIBE_BITCOIND(handle_wait_for_block_height, _1, _2, _3, _4);
+    SUBSCRIBE_BITCOIND(handle_wait_for_new_block, _1, _2, _3);
     SUBSCRIBE_BITCOIND(handle_get_mempool_ancestors, _1, _2);
     SUBSCRIBE_BITCOIND(handle_get_mempool_cluster, _1, _2);
     SUBSCRIBE_BITCOIND(handle_get_mempool_descendants, _1, _2);
@@ -113,6 +114,21 @@ void protocol_bitcoind_blockchain::start() NOEXCEPT
     protocol_bitcoind_dispatch<rpc_interface>::start();
 }
 
+void protocol_bitcoind_blockchain::stopping(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // A parked wait is dropped (its request is not answered).
+    if (waiting_)
+    {
+        waiters_.cancel(wait_id_);
+        waiting_ = false;
+    }
+
+    wait_timer_.cancel();
+    protocol_bitcoind_dispatch<rpc_interface>::stopping(ec);
+}
+
 // Blockchain methods.
 // ----------------------------------------------------------------------------
 
@@ -352,12 +368,26 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
         return true;
     }
 
-    // Fees require prevout values, populated from the store.
-    const auto block = query.get_block(link, true);
-    if (!block || !query.populate_without_metadata(*block))
+    // The summary is computed once per confirmed block and then cached, as
+    // fees require a full block read with all prevouts populated.
+    block_stats_record record{};
+    if (!stats_cache_.get(record, height, link))
     {
-        send_error(database::error::integrity);
-        return true;
+        const auto block = query.get_block(link, true);
+        if (!block || !query.populate_without_metadata(*block))
+        {
+            send_error(database::error::integrity);
+            return true;
+        }
+
+        // The duplicated-coinbase blocks (bip30 exceptions) do not add to the
+        // utxo set.
+        const auto repeat = chain::chain_state::is_bip30_exception(
+            block->hash(), height);
+
+        record = block_summary(*block, height, median_time_past(query, link),
+            repeat);
+        stats_cache_.put(link, record);
     }
 
     const auto& settings = system_settings();
@@ -365,13 +395,7 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
         settings.subsidy_interval_blocks, settings.initial_subsidy(),
         settings.forks.bip42);
 
-    // The duplicated-coinbase blocks (bip30 exceptions) do not add to the
-    // utxo set.
-    const auto repeat = chain::chain_state::is_bip30_exception(block->hash(),
-        height);
-
-    auto result = block_stats(*block, height, median_time_past(query, link),
-        subsidy, repeat);
+    auto result = block_stats(record, query.get_header_key(link), subsidy);
 
     // An empty selection returns all statistics, otherwise the named subset.
     if (stats.empty())
@@ -404,8 +428,9 @@ bool protocol_bitcoind_blockchain::handle_get_block_stats(const code& ec,
     return true;
 }
 
-// The window tx count is summed over the window (cost is linear in the window
-// requested by the caller); txcount is cumulative from genesis (chain walk).
+// The window tx count and txcount (cumulative from genesis) are each obtained
+// from the server-wide prefix sums, so cost is independent of the window.
+// Until the prefix sums are seeded these are read from the store directly.
 bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
     rpc_interface::get_chain_tx_stats, double nblocks,
     const std::string& blockhash) NOEXCEPT
@@ -461,10 +486,22 @@ bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
         return true;
     }
 
+    const auto indexed = tx_index_.ready();
+    size_t txcount{};
+    if (!indexed)
+    {
+        txcount = query.get_branch_tx_count(link);
+    }
+    else if (!tx_index_.get(txcount, query, height))
+    {
+        send_error(database::error::integrity);
+        return true;
+    }
+
     object_t result
     {
         { "time", header->timestamp() },
-        { "txcount", query.get_branch_tx_count(link) },
+        { "txcount", txcount },
         { "window_final_block_hash", encode_hash(query.get_header_key(link)) },
         { "window_final_block_height", height },
         { "window_block_count", window }
@@ -478,8 +515,16 @@ bool protocol_bitcoind_blockchain::handle_get_chain_tx_stats(const code& ec,
             median_time_past(query, past));
 
         size_t txs{};
-        for (auto index = add1(first); index <= height; ++index)
-            txs += query.get_tx_count(query.to_confirmed(index));
+        if (!indexed)
+        {
+            for (auto index = add1(first); index <= height; ++index)
+                txs += query.get_tx_count(query.to_confirmed(index));
+        }
+        else if (!tx_index_.window(txs, query, first, height))
+        {
+            send_error(database::error::integrity);
+            return true;
+        }
 
         result.emplace("window_interval", interval);
         result.emplace("window_tx_count", txs);
@@ -997,27 +1042,129 @@ bool protocol_bitcoind_blockchain::handle_scan_blocks(const code& ec,
     return true;
 }
 
+// Long-poll methods.
+// ----------------------------------------------------------------------------
+// A wait that is not immediately satisfied is parked on the server-wide
+// waiters (holding no thread) until released by an organized block or until
+// its timeout (milliseconds, zero is unbounded). Each replies with the
+// confirmed top upon completion (as bitcoind), one wait per channel.
+
 bool protocol_bitcoind_blockchain::handle_wait_for_block(const code& ec,
-    rpc_interface::wait_for_block) NOEXCEPT
+    rpc_interface::wait_for_block, const std::string& blockhash,
+    double timeout) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    hash_digest hash{};
+    uint32_t milliseconds{};
+    if (!decode_hash(hash, blockhash) || !to_integer(milliseconds, timeout))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    if (waiting_)
+    {
+        send_error(error::subscription_limit);
+        return true;
+    }
+
+    if (block_waiters::is_confirmed(archive(), hash))
+    {
+        send_top();
+        return true;
+    }
+
+    block_waiters::key id{};
+    if (!waiters_.wait_hash(id, hash,
+        BIND(handle_wait_released, _1, add1(wait_sequence_))))
+    {
+        send_top();
+        return true;
+    }
+
+    // Confirmed (and notified) after the check, so not released by notify.
+    if (block_waiters::is_confirmed(archive(), hash) && waiters_.cancel(id))
+    {
+        send_top();
+        return true;
+    }
+
+    park_wait(id, milliseconds);
     return true;
 }
 
 bool protocol_bitcoind_blockchain::handle_wait_for_block_height(const code& ec,
-    rpc_interface::wait_for_block_height) NOEXCEPT
+    rpc_interface::wait_for_block_height, double height,
+    double timeout) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    size_t target{};
+    uint32_t milliseconds{};
+    if (!to_integer(target, height) || !to_integer(milliseconds, timeout))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    if (waiting_)
+    {
+        send_error(error::subscription_limit);
+        return true;
+    }
+
+    if (target <= archive().get_top_confirmed())
+    {
+        send_top();
+        return true;
+    }
+
+    block_waiters::key id{};
+    if (!waiters_.wait_height(id, target,
+        BIND(handle_wait_released, _1, add1(wait_sequence_))))
+    {
+        send_top();
+        return true;
+    }
+
+    park_wait(id, milliseconds);
     return true;
 }
 
 bool protocol_bitcoind_blockchain::handle_wait_for_new_block(const code& ec,
-    rpc_interface::wait_for_new_block) NOEXCEPT
+    rpc_interface::wait_for_new_block, double timeout) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    uint32_t milliseconds{};
+    if (!to_integer(milliseconds, timeout))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    if (waiting_)
+    {
+        send_error(error::subscription_limit);
+        return true;
+    }
+
+    const auto& query = archive();
+    const auto top = query.to_confirmed(query.get_top_confirmed());
+
+    block_waiters::key id{};
+    if (!waiters_.wait_change(id, query.get_header_key(top),
+        BIND(handle_wait_released, _1, add1(wait_sequence_))))
+    {
+        send_top();
+        return true;
+    }
+
+    park_wait(id, milliseconds);
     return true;
 }
 
@@ -1085,6 +1232,84 @@ bool protocol_bitcoind_blockchain::handle_import_mempool(const code& ec,
     return true;
 }
 
+// Long-poll completion.
+// ----------------------------------------------------------------------------
+
+void protocol_bitcoind_blockchain::park_wait(block_waiters::key id,
+    uint32_t milliseconds) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    waiting_ = true;
+    wait_id_ = id;
+    ++wait_sequence_;
+
+    if (is_zero(milliseconds))
+        return;
+
+    wait_timer_.expires_after(std::chrono::milliseconds{ milliseconds });
+    wait_timer_.async_wait(BIND(handle_wait_timer, _1, wait_sequence_));
+}
+
+// Invoked on the notifying thread.
+void protocol_bitcoind_blockchain::handle_wait_released(const code&,
+    size_t sequence) NOEXCEPT
+{
+    POST(do_wait_released, sequence);
+}
+
+// Invoked on the network threadpool.
+void protocol_bitcoind_blockchain::handle_wait_timer(
+    const network::boost_code& ec, size_t sequence) NOEXCEPT
+{
+    // Canceled by release or stop.
+    if (ec)
+        return;
+
+    POST(do_wait_expired, sequence);
+}
+
+void protocol_bitcoind_blockchain::do_wait_released(size_t sequence) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped() || !waiting_ || sequence != wait_sequence_)
+        return;
+
+    waiting_ = false;
+    wait_timer_.cancel();
+    send_top();
+}
+
+void protocol_bitcoind_blockchain::do_wait_expired(size_t sequence) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped() || !waiting_ || sequence != wait_sequence_)
+        return;
+
+    // Not parked implies released, with do_wait_released pending.
+    if (!waiters_.cancel(wait_id_))
+        return;
+
+    waiting_ = false;
+    send_top();
+}
+
+void protocol_bitcoind_blockchain::send_top() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto& query = archive();
+    const auto height = query.get_top_confirmed();
+    const auto hash = query.get_header_key(query.to_confirmed(height));
+    send_result(object_t
+    {
+        { "hash", encode_hash(hash) },
+        { "height", height }
+    }, 128);
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -30,7 +30,7 @@ namespace server {
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
-// Subscribe to the post and websocket transports of the interface.
+// Requests are routed here by the terminal responder (no subscription).
 TEMPLATE
 void CLASS::start() NOEXCEPT
 {
@@ -41,12 +41,6 @@ void CLASS::start() NOEXCEPT
 
     // Publish served method names (e.g. for control subgroup help).
     register_methods(Interface::names);
-
-    using unknown = network::http::method::unknown;
-    subscribe_channel<CLASS, post>(&CLASS::handle_receive_post,
-        std::placeholders::_1, std::placeholders::_2);
-    subscribe_channel<CLASS, unknown>(&CLASS::handle_receive_unknown,
-        std::placeholders::_1, std::placeholders::_2);
     network::protocol::start();
 }
 
@@ -55,40 +49,17 @@ void CLASS::stopping(const code& ec) NOEXCEPT
 {
     BC_ASSERT(stranded());
     rpc_dispatcher_.stop(ec);
-    network::protocol_http::stopping(ec);
+    protocol_bitcoind::stopping(ec);
 }
 
-// The post transport of the interface subgroup.
+// The post transport of the interface subgroup, validated by the terminal
+// responder and defined by the interface.
 TEMPLATE
-void CLASS::handle_receive_post(const code& ec,
-    const post::cptr& post) NOEXCEPT
+void CLASS::dispatch_post(const post::cptr& post,
+    const network::rpc::request_t& message) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    if (stopped(ec))
-        return;
-
-    // A protocol attached earlier owns the method (overrides this one).
-    if (claimed())
-        return;
-
-    // Silently defer invalidated requests to the terminal responder.
-    if (!is_allowed_host(*post, post->version()) ||
-        !is_allowed_origin(*post, post->version()) ||
-        !post->body().template contains<network::rpc::request>())
-        return;
-
-    // Get the parsed json-rpc request object.
-    const auto& message =
-        post->body().template get<network::rpc::request>().message;
-
-    // Silently defer methods not defined by the interface subgroup.
-    if (!rpc_dispatcher::contains(message.method))
-        return;
-
-    // Claim the request (informs the terminal responder).
-    set_claimed();
-
     // The post is saved off during asynchonous handling and used in
     // send_json to formulate response headers, isolating handlers from
     // http semantics.
@@ -101,39 +72,26 @@ void CLASS::handle_receive_post(const code& ec,
         return;
     }
 
+    // The client may be rate limited (by credential or address).
+    if (!admitted(message.method, *post))
+    {
+        send_error(error::rate_limited);
+        return;
+    }
+
     // Dispatch the request to the interface dispatcher.
     if (const auto code = rpc_dispatcher_.notify(message))
         stop(code);
 }
 
-// The websocket transport of the interface subgroup.
+// The websocket transport of the interface subgroup, authorized by the
+// terminal responder and defined by the interface.
 TEMPLATE
-void CLASS::dispatch_websocket(
-    const network::http::request& request) NOEXCEPT
+void CLASS::dispatch_frame(const network::http::request& request,
+    const network::rpc::request_t& message) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    // A protocol attached earlier owns the method (overrides this one).
-    if (claimed())
-        return;
-
-    // ws frames carry no headers, so ws authorization is enforced here,
-    // not by the channel. Unauthorized and non-rpc frames are silently
-    // deferred to the terminal responder (which stops the channel).
-    if (!authorized() ||
-        !request.body().template contains<network::rpc::request>())
-        return;
-
-    const auto& message =
-        request.body().template get<network::rpc::request>().message;
-
-    // Silently defer methods not defined by the interface subgroup.
-    if (!rpc_dispatcher::contains(message.method))
-        return;
-
-    // Claim the request (informs the terminal responder).
-    set_claimed();
-
     // Cache request context for response building (version + id).
     set_rpc_request(message);
 
@@ -144,6 +102,13 @@ void CLASS::dispatch_websocket(
         return;
     }
 
+    // The client may be rate limited (by address).
+    if (!admitted(message.method, request))
+    {
+        send_error(error::rate_limited);
+        return;
+    }
+
     // Dispatch the request to the interface dispatcher.
     if (const auto code = rpc_dispatcher_.notify(message))
         stop(code);
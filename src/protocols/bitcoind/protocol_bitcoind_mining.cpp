@@ -19,6 +19,8 @@
 #include <bitcoin/server/protocols/protocol_bitcoind_mining.hpp>
 
 #include <algorithm>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -39,6 +41,14 @@ using namespace network::messages;
 using namespace std::placeholders;
 using namespace boost::json;
 
+// bip141 block limits (legacy limits apply prior to activation).
+constexpr auto legacy_sigop_limit = 20'000_size;
+constexpr auto legacy_size_limit = 1'000'000_size;
+constexpr auto witness_sigop_limit = 80'000_size;
+constexpr auto witness_weight_limit = 4'000'000_size;
+constexpr auto legacy_sigop_scale = 4_size;
+constexpr auto commitment_prefix = "6a24aa21a9ed";
+
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 BC_PUSH_WARNING(SMART_PTR_NOT_NEEDED)
 BC_PUSH_WARNING(NO_VALUE_OR_CONST_REF_SHARED_PTR)
@@ -55,14 +65,28 @@ void protocol_bitcoind_mining::start() NOEXCEPT
 
     SUBSCRIBE_BITCOIND(handle_get_network_hash_ps, _1, _2, _3, _4);
     SUBSCRIBE_BITCOIND(handle_get_mining_info, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_submit_block, _1, _2);
+    SUBSCRIBE_BITCOIND(handle_submit_block, _1, _2, _3, _4);
     SUBSCRIBE_BITCOIND(handle_submit_header, _1, _2);
-    SUBSCRIBE_BITCOIND(handle_get_block_template, _1, _2);
+    SUBSCRIBE_BITCOIND(handle_get_block_template, _1, _2, _3);
     SUBSCRIBE_BITCOIND(handle_get_prioritised_transactions, _1, _2);
     SUBSCRIBE_BITCOIND(handle_prioritise_transaction, _1, _2);
     protocol_bitcoind_dispatch<rpc_interface>::start();
 }
 
+void protocol_bitcoind_mining::stopping(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // A parked long-poll is dropped (its request is not answered).
+    if (waiting_)
+    {
+        waiters_.cancel(wait_id_);
+        waiting_ = false;
+    }
+
+    protocol_bitcoind_dispatch<rpc_interface>::stopping(ec);
+}
+
 // Mining methods.
 // ----------------------------------------------------------------------------
 
@@ -105,8 +129,8 @@ bool protocol_bitcoind_mining::handle_get_network_hash_ps(const code& ec,
 }
 
 // currentblockweight/currentblocktx are omitted (bitcoind omits them until a
-// block is assembled, and there is no assembler). The tx pool is empty and no
-// packages are selected, so pooledtx and blockmintxfee are zero.
+// block is assembled). pooledtx is the number of transactions pooled for
+// templates (announced by the node since startup and not yet confirmed).
 bool protocol_bitcoind_mining::handle_get_mining_info(const code& ec,
     rpc_interface::get_mining_info) NOEXCEPT
 {
@@ -158,7 +182,7 @@ bool protocol_bitcoind_mining::handle_get_mining_info(const code& ec,
         { "difficulty", top->difficulty() },
         { "target", encode_hash(from_uintx(compact::expand(top->bits()))) },
         { "networkhashps", top->difficulty() * span / period },
-        { "pooledtx", zero },
+        { "pooledtx", templates_.pooled() },
         { "blockmintxfee", max_money / satoshi_per_bitcoin },
         { "chain", chain_name(query) },
         { "next", std::move(next_block) },
@@ -167,14 +191,66 @@ bool protocol_bitcoind_mining::handle_get_mining_info(const code& ec,
     return true;
 }
 
+// bip22: null if accepted, otherwise the reason for rejection. A block that
+// passes context-free and contextual checks over the confirmed top is
+// submitted to the node organizer, which determines the result.
 bool protocol_bitcoind_mining::handle_submit_block(const code& ec,
-    rpc_interface::submit_block) NOEXCEPT
+    rpc_interface::submit_block, const std::string& hexdata,
+    const std::string&) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    data_chunk data{};
+    if (!decode_base16(data, hexdata))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    const auto block = to_shared<chain::block>(data, true);
+    if (!block->is_valid())
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    const auto reason = templates_.check(archive(), system_settings(),
+        *block);
+    if (!reason.empty())
+    {
+        send_result(reason, reason.size() + two);
+        return true;
+    }
+
+    organize(block, BIND(handle_organize, _1, _2));
     return true;
 }
 
+// Invoked on the organizer thread.
+void protocol_bitcoind_mining::handle_organize(const code& ec,
+    size_t) NOEXCEPT
+{
+    POST(complete_submit_block, ec);
+}
+
+void protocol_bitcoind_mining::complete_submit_block(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped())
+        return;
+
+    if (ec)
+    {
+        const auto reason = block_templates::to_bip22(ec);
+        send_result(reason, reason.size() + two);
+        return;
+    }
+
+    send_result({}, 4);
+}
+
 bool protocol_bitcoind_mining::handle_submit_header(const code& ec,
     rpc_interface::submit_header) NOEXCEPT
 {
@@ -183,11 +259,132 @@ bool protocol_bitcoind_mining::handle_submit_header(const code& ec,
     return true;
 }
 
+// bip22/bip23 template and proposal modes. The template over the confirmed
+// top is shared by all channels and built upon organization (by the server),
+// and transactions are appended as announced between blocks, so a request
+// (or long-poll release) for a new top does not wait on assembly. A matching
+// longpollid parks the request until a new top is organized.
 bool protocol_bitcoind_mining::handle_get_block_template(const code& ec,
-    rpc_interface::get_block_template) NOEXCEPT
+    rpc_interface::get_block_template,
+    const object_t& template_request) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_error(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    // Null if absent or not a string.
+    const auto end = template_request.end();
+    const auto field = [&](const std::string& name) NOEXCEPT
+        -> const std::string*
+    {
+        const auto it = template_request.find(name);
+        if (it == end ||
+            !std::holds_alternative<string_t>(it->second.value()))
+            return nullptr;
+
+        return &std::get<string_t>(it->second.value());
+    };
+
+    const auto mode = field("mode");
+    if (template_request.find("mode") != end && is_null(mode))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    if (!is_null(mode) && *mode == "proposal")
+    {
+        data_chunk data{};
+        const auto hexdata = field("data");
+        if (is_null(hexdata) || !decode_base16(data, *hexdata))
+        {
+            send_error(error::invalid_argument);
+            return true;
+        }
+
+        const chain::block block{ data, true };
+        if (!block.is_valid())
+        {
+            send_error(error::invalid_argument);
+            return true;
+        }
+
+        const auto reason = templates_.check(archive(), system_settings(),
+            block);
+        if (reason.empty())
+            send_result({}, 4);
+        else
+            send_result(reason, reason.size() + two);
+
+        return true;
+    }
+
+    if (!is_null(mode) && *mode != "template")
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    auto value = current_template();
+    if (!value)
+    {
+        send_error(database::error::integrity);
+        return true;
+    }
+
+    // As bitcoind, the client must support segwit once it is active.
+    if (value->segwit)
+    {
+        const auto rules = template_request.find("rules");
+        if (rules == end ||
+            !std::holds_alternative<array_t>(rules->second.value()) ||
+            std::ranges::none_of(std::get<array_t>(rules->second.value()),
+                [](const auto& rule) NOEXCEPT
+                {
+                    return std::holds_alternative<string_t>(rule.value()) &&
+                        std::get<string_t>(rule.value()) == "segwit";
+                }))
+        {
+            send_error(error::invalid_argument);
+            return true;
+        }
+    }
+
+    const auto longpollid = field("longpollid");
+    if (template_request.find("longpollid") != end && is_null(longpollid))
+    {
+        send_error(error::invalid_argument);
+        return true;
+    }
+
+    if (!is_null(longpollid) &&
+        *longpollid == block_templates::longpollid(*value))
+    {
+        if (waiting_)
+        {
+            send_error(error::subscription_limit);
+            return true;
+        }
+
+        block_waiters::key id{};
+        if (waiters_.wait_change(id, value->previous,
+            BIND(handle_poll_released, _1, add1(wait_sequence_))))
+        {
+            waiting_ = true;
+            wait_id_ = id;
+            ++wait_sequence_;
+            return true;
+        }
+
+        // The top changed since the template was obtained.
+        value = current_template();
+        if (!value)
+        {
+            send_error(database::error::integrity);
+            return true;
+        }
+    }
+
+    send_template(*value);
     return true;
 }
 
@@ -207,6 +404,126 @@ bool protocol_bitcoind_mining::handle_prioritise_transaction(const code& ec,
     return true;
 }
 
+// Long-poll completion.
+// ----------------------------------------------------------------------------
+
+// Invoked on the notifying thread.
+void protocol_bitcoind_mining::handle_poll_released(const code&,
+    size_t sequence) NOEXCEPT
+{
+    POST(do_poll_released, sequence);
+}
+
+void protocol_bitcoind_mining::do_poll_released(size_t sequence) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped() || !waiting_ || sequence != wait_sequence_)
+        return;
+
+    waiting_ = false;
+    const auto value = current_template();
+    if (!value)
+    {
+        send_error(database::error::integrity);
+        return;
+    }
+
+    send_template(*value);
+}
+
+// Templates.
+// ----------------------------------------------------------------------------
+
+// The template over the confirmed top (the organized block is not used, as a
+// late event must not displace the template of a subsequent top).
+block_template::cptr protocol_bitcoind_mining::current_template() NOEXCEPT
+{
+    const auto& query = archive();
+    const auto link = query.to_confirmed(query.get_top_confirmed());
+    return templates_.update(query, system_settings(), link);
+}
+
+void protocol_bitcoind_mining::send_template(
+    const block_template& value) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto now = to_unsigned(zulu_time());
+    const auto curtime = std::max<uint64_t>(now, value.mintime);
+
+    array_t rules{};
+    if (value.segwit)
+        rules.emplace_back(std::string{ "!segwit" });
+
+    // Dependencies are one-based positions of parents in the template, which
+    // always precede their children.
+    auto size = 1024_size;
+    array_t transactions{};
+    std::unordered_map<hash_digest, size_t> positions{};
+    for (const auto& tx: value.transactions)
+    {
+        array_t depends{};
+        for (const auto& parent: tx->parents)
+            if (const auto it = positions.find(parent); it != positions.end())
+                depends.emplace_back(it->second);
+
+        positions.emplace(tx->txid, add1(positions.size()));
+        size += two * tx->data.size() + 256u;
+        transactions.emplace_back(object_t
+        {
+            { "data", encode_base16(tx->data) },
+            { "txid", encode_hash(tx->txid) },
+            { "hash", encode_hash(tx->wtxid) },
+            { "depends", std::move(depends) },
+            { "fee", tx->fee },
+            { "sigops", value.segwit ? tx->sigops :
+                tx->sigops / legacy_sigop_scale },
+            { "weight", tx->weight }
+        });
+    }
+
+    object_t result
+    {
+        { "capabilities", array_t{ std::string{ "proposal" } } },
+        { "version", value.version },
+        { "rules", std::move(rules) },
+        { "vbavailable", object_t{} },
+        { "vbrequired", zero },
+        { "previousblockhash", encode_hash(value.previous) },
+        { "transactions", std::move(transactions) },
+        { "coinbaseaux", object_t{} },
+        { "coinbasevalue", value.coinbase_value },
+        { "longpollid", block_templates::longpollid(value) },
+        { "target", encode_hash(from_uintx(compact::expand(value.bits))) },
+        { "mintime", value.mintime },
+        { "mutable", array_t
+            {
+                std::string{ "time" },
+                std::string{ "transactions" },
+                std::string{ "prevblock" }
+            }
+        },
+        { "noncerange", std::string{ "00000000ffffffff" } },
+        { "sigoplimit", value.segwit ? witness_sigop_limit :
+            legacy_sigop_limit },
+        { "sizelimit", value.segwit ? witness_weight_limit :
+            legacy_size_limit },
+        { "curtime", curtime },
+        { "bits", encode_base16(to_big_endian(value.bits)) },
+        { "height", value.height }
+    };
+
+    if (value.segwit)
+    {
+        result.emplace("weightlimit", witness_weight_limit);
+        result.emplace("default_witness_commitment", commitment_prefix +
+            encode_base16(value.witness_commitment));
+    }
+
+    send_result(std::move(result), size);
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
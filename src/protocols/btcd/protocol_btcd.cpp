@@ -49,7 +49,8 @@ void protocol_btcd::start() NOEXCEPT
     if (started())
         return;
 
-    subscribe_chase(BIND(handle_chase, _1, _2, _3));
+    // Channels join chase event lists only as they subscribe to events.
+    subscriber_ = chase_hub::make(BIND(handle_chase, _1, _2, _3));
 
     // Administrative methods.
     SUBSCRIBE_BTCD(handle_authenticate, _1, _2, _3, _4);
@@ -84,7 +85,7 @@ void protocol_btcd::start() NOEXCEPT
     // Publish served method names (e.g. for control subgroup help).
     register_methods(btcd_interface::names);
 
-    // The bitcoind interface subgroups are independently attached.
+    // The bitcoind interface subgroups are routed by the terminal responder.
     SUBSCRIBE_CHANNEL(post, handle_receive_post, _1, _2);
     SUBSCRIBE_CHANNEL(network::http::method::unknown, handle_receive_unknown,
         _1, _2);
@@ -97,8 +98,11 @@ void protocol_btcd::stopping(const code& ec) NOEXCEPT
     BC_ASSERT(stranded());
     stopping_.store(true);
     btcd_dispatcher_.stop(ec);
-    unsubscribe_chase();
-    network::protocol_http::stopping(ec);
+    hub_.unsubscribe(subscriber_);
+
+    // The subscriber handler binds this protocol.
+    subscriber_.reset();
+    protocol_bitcoind::stopping(ec);
 }
 
 // Dispatch.
@@ -126,7 +130,7 @@ void protocol_btcd::handle_receive_post(const code& ec,
         return;
 
     // Silently defer methods not defined by the btcd interface.
-    if (!btcd_dispatcher::contains(message.method))
+    if (!interface::btcd_map::contains<btcd_interface>(message.method))
         return;
 
     // Claim the request (informs the terminal responder).
@@ -140,6 +144,13 @@ void protocol_btcd::handle_receive_post(const code& ec,
         return;
     }
 
+    // The client may be rate limited (by credential or address).
+    if (!admitted(message.method, *post))
+    {
+        send_error(error::rate_limited);
+        return;
+    }
+
     // Dispatch the request to the interface dispatcher.
     if (const auto code = btcd_dispatcher_.notify(message))
         stop(code);
@@ -170,7 +181,7 @@ void protocol_btcd::dispatch_websocket(
     }
 
     // Silently defer methods not defined by the btcd interface.
-    if (!btcd_dispatcher::contains(message.method))
+    if (!interface::btcd_map::contains<btcd_interface>(message.method))
         return;
 
     // Claim the request (informs the terminal responder).
@@ -184,6 +195,13 @@ void protocol_btcd::dispatch_websocket(
         return;
     }
 
+    // The client may be rate limited (by address).
+    if (!admitted(message.method, request))
+    {
+        send_error(error::rate_limited);
+        return;
+    }
+
     // Dispatch the request to the interface dispatcher.
     if (const auto code = btcd_dispatcher_.notify(message))
         stop(code);
@@ -247,7 +265,9 @@ bool protocol_btcd::handle_notify_blocks(const code& ec,
     if (stopped(ec))
         return false;
 
-    subscribed_blocks_.store(true, relaxed);
+    if (!subscribed_blocks_.exchange(true, relaxed))
+        hub_.subscribe(subscriber_, block_events);
+
     send_result({}, 4);
     return true;
 }
@@ -258,7 +278,9 @@ bool protocol_btcd::handle_stop_notify_blocks(const code& ec,
     if (stopped(ec))
         return false;
 
-    subscribed_blocks_.store(false, relaxed);
+    if (subscribed_blocks_.exchange(false, relaxed))
+        hub_.unsubscribe(subscriber_, block_events);
+
     send_result({}, 4);
     return true;
 }
@@ -431,6 +453,14 @@ void protocol_btcd::send_notification(const std::string& method,
         &CLASS::handle_complete, _1, error::success);
 }
 
+void protocol_btcd::send_shared(
+    const channel_t::shared_text& notification) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    writer_->write_shared(notification,
+        BIND(handle_complete, _1, error::success));
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -316,20 +316,16 @@ void protocol_btcd::do_connected(node::header_t link_value) NOEXCEPT
 {
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
-    const auto& query = archive();
+    // Built once per block for all subscribed channels.
     const database::header_link link{ link_value };
-
-    size_t height{};
-    if (!query.get_height(height, link))
-        return;
-
-    const auto header = query.get_header(link);
-    if (!header)
+    const auto notice = notices_.get(archive(), link);
+    if (!notice)
         return;
 
     // Match the watch-list against the connected block (cursored delta).
     // Cursors advance here, so this stays on the notification strand.
     matches matched{};
+    const auto height = notice->height;
     const sizes heights{ height };
     for (auto& [key, sub]: address_watches_)
     {
@@ -354,7 +350,7 @@ void protocol_btcd::do_connected(node::header_t link_value) NOEXCEPT
     if (at != matched.end())
         txs = serialize_matches(at->second);
 
-    POST_BTCD(notify_connected, header, height,
+    POST_BTCD(notify_connected, notice,
         emplace_shared<array_t>(std::move(txs)));
 }
 
@@ -380,24 +376,22 @@ void protocol_btcd::do_disconnected(node::header_t link_value) NOEXCEPT
     POST_BTCD(notify_disconnected, header, height);
 }
 
-void protocol_btcd::notify_connected(const header_cptr& header,
-    size_t height, const array_ptr& txs) NOEXCEPT
+void protocol_btcd::notify_connected(const block_notification::cptr& notice,
+    const array_ptr& txs) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
     if (stopped() || !subscribed_blocks_.load(relaxed))
         return;
 
-    // Elements are moved, as a braced initializer list always copies.
-    array_t connected{};
-    connected.emplace_back(encode_hash(header->get_hash()));
-    connected.emplace_back(height);
-    connected.emplace_back(header->timestamp());
-    send_notification("blockconnected", std::move(connected), 256);
+    // Identical for all subscribers, so serialized once and written by
+    // reference (retains notice).
+    send_shared({ notice, &notice->connected });
 
+    // Elements are moved, as a braced initializer list always copies.
     array_t filtered{};
-    filtered.emplace_back(height);
-    filtered.emplace_back(to_text(*header, chain::header::serialized_size()));
+    filtered.emplace_back(notice->height);
+    filtered.emplace_back(notice->header_text);
     filtered.emplace_back(std::move(*txs));
     send_notification("filteredblockconnected", std::move(filtered), 256);
 }
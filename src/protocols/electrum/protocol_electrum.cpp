@@ -18,7 +18,9 @@
  */
 #include <bitcoin/server/protocols/protocol_electrum.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <memory>
 #include <variant>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
@@ -51,8 +53,8 @@ void protocol_electrum::start() NOEXCEPT
     if (started())
         return;
 
-    // Chaser subscription is asynchronous, events may be missed.
-    subscribe_chase(BIND(handle_chase, _1, _2, _3));
+    // Channels join chase event lists only as they subscribe to events.
+    subscriber_ = chase_hub::make(BIND(handle_chase, _1, _2, _3));
 
     // Header methods.
     SUBSCRIBE_RPC(handle_blockchain_number_of_blocks_subscribe, _1, _2);
@@ -122,10 +124,53 @@ void protocol_electrum::stopping(const code& ec) NOEXCEPT
 {
     BC_ASSERT(stranded());
     stopping_.store(true);
-    unsubscribe_chase();
+
+    for (const auto& query: queries_)
+        query->cancel();
+
+    queries_.clear();
+    hub_.unsubscribe(subscriber_);
+    notify<CLASS>(&CLASS::do_release);
     protocol_rpc<channel_electrum>::stopping(ec);
 }
 
+// The subscriber handler binds this protocol, so the subscriber is released
+// (and any subscription made by the notification strand is removed).
+void protocol_electrum::do_release() NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+    hub_.unsubscribe(subscriber_);
+    subscriber_.reset();
+}
+
+// Queries.
+// ----------------------------------------------------------------------------
+
+query_deadline::ptr protocol_electrum::start_query() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // Completed queries are released as subsequent queries are started.
+    std::erase_if(queries_, [](const auto& query) NOEXCEPT
+    {
+        return query->completed();
+    });
+
+    const auto it = deadlines_.find(channel_->method());
+    const auto timeout = (it == deadlines_.end()) ?
+        query_deadline::duration{ options().query_deadline } : it->second;
+
+    const auto deadline = std::make_shared<query_deadline>(
+        channel_->strand());
+
+    if (stopping_)
+        deadline->cancel();
+
+    deadline->start(timeout);
+    queries_.push_back(deadline);
+    return deadline;
+}
+
 // Handlers (event subscription).
 // ----------------------------------------------------------------------------
 
@@ -139,6 +184,18 @@ bool protocol_electrum::handle_chase(const code&, node::chase event_,
     switch (event_)
     {
         case node::chase::transaction:
+        {
+            // Coalesced, as mempool churn would otherwise recompute every
+            // subscription status once per accepted transaction.
+            if (subscribed_outpoint_.load(relaxed) ||
+                subscribed_address_.load(relaxed))
+            {
+                BC_ASSERT(std::holds_alternative<node::transaction_t>(value));
+                batch_transaction(std::get<node::transaction_t>(value));
+            }
+
+            break;
+        }
         case node::chase::organized:
         {
             if (subscribed_height_.load(relaxed))
@@ -170,7 +227,7 @@ bool protocol_electrum::handle_chase(const code&, node::chase event_,
         }
         case node::chase::reorganized:
         {
-            // Value is regression branch_point.
+            // Value is regression branch_point (address subscribers only).
             BC_ASSERT(std::holds_alternative<node::header_t>(value));
             POST_NOTIFY(do_reorganized, std::get<node::header_t>(value));
             break;
@@ -184,6 +241,32 @@ bool protocol_electrum::handle_chase(const code&, node::chase event_,
     return true;
 }
 
+// transactions
+// ----------------------------------------------------------------------------
+
+void protocol_electrum::batch_transaction(node::transaction_t link) NOEXCEPT
+{
+    if (const auto delay = transactions_.push(link))
+        transaction_batch::schedule(notification_strand_, delay.value(),
+            BIND(do_transactions));
+}
+
+// Subscriptions walk from their cursors, so events are not individually
+// processed, the batch (if not already taken) triggers one recomputation.
+void protocol_electrum::do_transactions() NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    if (stopped() || transactions_.pop().empty())
+        return;
+
+    if (subscribed_outpoint_.load(relaxed))
+        do_outpoint({});
+
+    if (subscribed_address_.load(relaxed))
+        do_scripthash({});
+}
+
 // reorganization
 // ----------------------------------------------------------------------------
 // outpoint subscriptions do not require modification.
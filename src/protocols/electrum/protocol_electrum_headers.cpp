@@ -47,7 +47,9 @@ void protocol_electrum::handle_blockchain_number_of_blocks_subscribe(
         return;
     }
 
-    subscribed_height_.store(true, relaxed);
+    if (!subscribed_height_.exchange(true, relaxed))
+        hub_.subscribe(subscriber_, header_events);
+
     const auto top_height = archive().get_top_confirmed();
     send_result(top_height, 42);
 }
@@ -419,7 +421,9 @@ void protocol_electrum::handle_blockchain_headers_subscribe(const code& ec,
         object["block_height"] = top;
     }
 
-    subscribed_header_.store(true, relaxed);
+    if (!subscribed_header_.exchange(true, relaxed))
+        hub_.subscribe(subscriber_, header_events);
+
     send_result(std::move(value), size);
 }
 
@@ -432,10 +436,10 @@ void protocol_electrum::do_height(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    const auto& query = archive();
-    const auto height = query.get_height(link);
-
-    if (height.is_terminal())
+    // Built once per block for all subscribed channels.
+    const auto notice = notices_.get(archive(),
+        database::header_link{ link });
+    if (!notice)
     {
         LOGF("Electrum::do_height, height not found (" << link << ").");
         return;
@@ -446,7 +450,7 @@ void protocol_electrum::do_height(node::header_t link) NOEXCEPT
     // electrum.readthedocs.io/en/latest/protocol.html#blockchain-numblocks-subscribe
     send_notification("blockchain.numblocks.subscribe", value_t
     {
-        height.value
+        notice->numblocks
     }, 48);
 }
 
@@ -455,24 +459,17 @@ void protocol_electrum::do_header(node::header_t link) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    const auto& query = archive();
-    const auto height = query.get_height(link);
-    const auto header = query.get_wire_header(link);
-
-    if (height.is_terminal())
+    // Built once per block for all subscribed channels.
+    const auto notice = notices_.get(archive(),
+        database::header_link{ link });
+    if (!notice)
     {
         LOGF("Electrum::do_header, header not found (" << link << ").");
         return;
     }
 
-    send_notification("blockchain.headers.subscribe", array_t
-    {
-        object_t
-        {
-            { "height", height.value },
-            { "hex", encode_base16(header) }
-        }
-    }, 64);
+    // Serialized once per block and written by reference (retains notice).
+    send_shared({ notice, &notice->headers });
 }
 
 BC_POP_WARNING()
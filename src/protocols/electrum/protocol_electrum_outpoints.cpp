@@ -161,7 +161,8 @@ void protocol_electrum::do_outpoint_subscribe(const point& prevout) NOEXCEPT
         ec = error::success;
         get_outpoint_history(sub, prevout);
         outpoint_subscriptions_.emplace(prevout, sub);
-        subscribed_outpoint_.store(true, relaxed);
+        if (!subscribed_outpoint_.exchange(true, relaxed))
+            hub_.subscribe(subscriber_, outpoint_events);
     }
 
     // All current subscribers are cached and forwarded.
@@ -233,8 +234,9 @@ void protocol_electrum::do_outpoint_unsubscribe(const point& prevout) NOEXCEPT
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
     const auto found = to_bool(outpoint_subscriptions_.erase(prevout));
-    if (is_zero(outpoint_subscriptions_.size()))
-        subscribed_outpoint_.store(false, relaxed);
+    if (is_zero(outpoint_subscriptions_.size()) &&
+        subscribed_outpoint_.exchange(false, relaxed))
+        hub_.unsubscribe(subscriber_, outpoint_events);
 
     POST(complete_outpoint_unsubscribe, found);
 }
@@ -70,16 +70,29 @@ void protocol_electrum::get_balance(const hash_digest& hash) NOEXCEPT
         return;
     }
 
+    // Address and scriptpubkey variants are costed by their own names.
+    if (!admitted())
+    {
+        send_code(error::rate_limited);
+        return;
+    }
+
     monitor(true);
-    PARALLEL(do_get_balance, hash);
+    const auto deadline = start_query();
+    if (!pooled(BIND(do_get_balance, hash, deadline)))
+        PARALLEL(do_get_balance, hash, deadline);
 }
 
-void protocol_electrum::do_get_balance(const hash_digest& hash) NOEXCEPT
+void protocol_electrum::do_get_balance(const hash_digest& hash,
+    const query_deadline::ptr& deadline) NOEXCEPT
 {
     BC_ASSERT(!stranded());
+    const auto start = rate_limiter::clock::now();
     const auto& query = archive();
     uint64_t confirmed{}, unconfirmed{};
-    auto ec = query.get_balance(stopping_, confirmed, unconfirmed, hash);
+    const auto ec = deadline->complete(query.get_balance(
+        deadline->canceled(), confirmed, unconfirmed, hash));
+    charge(zero, rate_limiter::clock::now() - start);
     POST(complete_get_balance, ec, confirmed, unconfirmed);
 }
 
@@ -143,19 +156,31 @@ void protocol_electrum::get_history(const system::hash_digest& hash) NOEXCEPT
         return;
     }
 
+    if (!admitted())
+    {
+        send_code(error::rate_limited);
+        return;
+    }
+
     monitor(true);
-    PARALLEL(do_get_history, hash);
+    const auto deadline = start_query();
+    if (!pooled(BIND(do_get_history, hash, deadline)))
+        PARALLEL(do_get_history, hash, deadline);
 }
 
-void protocol_electrum::do_get_history(const hash_digest& hash) NOEXCEPT
+void protocol_electrum::do_get_history(const hash_digest& hash,
+    const query_deadline::ptr& deadline) NOEXCEPT
 {
     BC_ASSERT(!stranded());
     histories histories{};
     database::height_link cursor{};
+    const auto start = rate_limiter::clock::now();
     const auto& query = archive();
-    const auto ec = query.get_history(stopping_, cursor, histories, hash,
-        options().maximum_history, turbo_);
+    const auto ec = deadline->complete(query.get_history(
+        deadline->canceled(), cursor, histories, hash,
+        options().maximum_history, turbo_));
 
+    charge(histories.size(), rate_limiter::clock::now() - start);
     POST(complete_get_history, ec, std::move(histories));
 }
 
@@ -216,18 +241,30 @@ void protocol_electrum::get_mempool(const system::hash_digest& hash) NOEXCEPT
         return;
     }
 
+    if (!admitted())
+    {
+        send_code(error::rate_limited);
+        return;
+    }
+
     monitor(true);
-    PARALLEL(do_get_mempool, hash);
+    const auto deadline = start_query();
+    if (!pooled(BIND(do_get_mempool, hash, deadline)))
+        PARALLEL(do_get_mempool, hash, deadline);
 }
 
-void protocol_electrum::do_get_mempool(const hash_digest& hash) NOEXCEPT
+void protocol_electrum::do_get_mempool(const hash_digest& hash,
+    const query_deadline::ptr& deadline) NOEXCEPT
 {
     BC_ASSERT(!stranded());
     histories histories{};
+    const auto start = rate_limiter::clock::now();
     const auto& query = archive();
-    auto ec = query.get_unconfirmed_history(stopping_, histories, hash,
-        options().maximum_history, turbo_);
+    const auto ec = deadline->complete(query.get_unconfirmed_history(
+        deadline->canceled(), histories, hash, options().maximum_history,
+        turbo_));
 
+    charge(histories.size(), rate_limiter::clock::now() - start);
     POST(complete_get_mempool, ec, std::move(histories));
 }
 
@@ -287,16 +324,28 @@ void protocol_electrum::list_unspent(const system::hash_digest& hash) NOEXCEPT
         return;
     }
 
+    if (!admitted())
+    {
+        send_code(error::rate_limited);
+        return;
+    }
+
     monitor(true);
-    PARALLEL(do_list_unspent, hash);
+    const auto deadline = start_query();
+    if (!pooled(BIND(do_list_unspent, hash, deadline)))
+        PARALLEL(do_list_unspent, hash, deadline);
 }
 
-void protocol_electrum::do_list_unspent(const hash_digest& hash) NOEXCEPT
+void protocol_electrum::do_list_unspent(const hash_digest& hash,
+    const query_deadline::ptr& deadline) NOEXCEPT
 {
     BC_ASSERT(!stranded());
     unspents unspents{};
+    const auto start = rate_limiter::clock::now();
     const auto& query = archive();
-    const auto ec = query.get_unspent(stopping_, unspents, hash, turbo_);
+    const auto ec = deadline->complete(query.get_unspent(
+        deadline->canceled(), unspents, hash, turbo_));
+    charge(unspents.size(), rate_limiter::clock::now() - start);
     POST(complete_list_unspent, ec, std::move(unspents));
 }
 
@@ -77,6 +77,12 @@ void protocol_electrum::scripthash_subscribe(const hash_digest& hash,
         return;
     }
 
+    if (!admitted())
+    {
+        send_code(error::rate_limited);
+        return;
+    }
+
     monitor(true);
     POST_NOTIFY(do_scripthash_subscribe, hash, type);
 }
@@ -87,6 +93,7 @@ void protocol_electrum::do_scripthash_subscribe(const hash_digest& hash,
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
     hash_digest status{};
+    const auto start = rate_limiter::clock::now();
     code ec{ error::subscription_limit };
     if (address_subscriptions_.size() < options().maximum_subscriptions)
     {
@@ -102,10 +109,12 @@ void protocol_electrum::do_scripthash_subscribe(const hash_digest& hash,
         else
         {
             status = at.first->second.status;
-            subscribed_address_.store(true, relaxed);
+            if (!subscribed_address_.exchange(true, relaxed))
+                hub_.subscribe(subscriber_, address_events);
         }
     }
 
+    charge(zero, rate_limiter::clock::now() - start);
     POST(complete_scripthash_subscribe, ec, std::move(status));
 }
 
@@ -177,8 +186,9 @@ void protocol_electrum::do_scripthash_unsubscribe(
     BC_ASSERT(notification_strand_.running_in_this_thread());
 
     const auto found = to_bool(address_subscriptions_.erase(hash));
-    if (is_zero(address_subscriptions_.size()))
-        subscribed_address_.store(false, relaxed);
+    if (is_zero(address_subscriptions_.size()) &&
+        subscribed_address_.exchange(false, relaxed))
+        hub_.unsubscribe(subscriber_, address_events);
 
     POST(complete_scripthash_unsubscribe, found);
 }
@@ -32,8 +32,6 @@ using namespace std::placeholders;
 constexpr auto relaxed = std::memory_order_relaxed;
 
 #define CLASS protocol_native
-#define SUBSCRIBE_NATIVE(method, ...) \
-    subscribe<CLASS>(&CLASS::method, __VA_ARGS__)
 
 // Start.
 // ----------------------------------------------------------------------------
@@ -45,54 +43,8 @@ void protocol_native::start() NOEXCEPT
     if (started())
         return;
 
-    // Chaser subscription is asynchronous, events may be missed.
-    subscribe_chase(BIND(handle_chase, _1, _2, _3));
-
-    // Configuration methods.
-    SUBSCRIBE_NATIVE(handle_get_configuration, _1, _2, _3, _4);
-
-    // Top methods.
-    SUBSCRIBE_NATIVE(handle_get_top, _1, _2, _3, _4);
-    SUBSCRIBE_NATIVE(handle_get_top_subscribe, _1, _2, _3, _4, _5);
-
-    // Block methods.
-    SUBSCRIBE_NATIVE(handle_get_block, _1, _2, _3, _4, _5, _6, _7);
-    SUBSCRIBE_NATIVE(handle_get_block_header, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_block_header_context, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_block_details, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_block_txs, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_block_filter, _1, _2, _3, _4, _5, _6, _7);
-    SUBSCRIBE_NATIVE(handle_get_block_filter_hash, _1, _2, _3, _4, _5, _6, _7);
-    SUBSCRIBE_NATIVE(handle_get_block_filter_header, _1, _2, _3, _4, _5, _6, _7);
-    SUBSCRIBE_NATIVE(handle_get_block_tx, _1, _2, _3, _4, _5, _6, _7, _8);
-    SUBSCRIBE_NATIVE(handle_get_block_subscribe, _1, _2, _3, _4, _5);
-
-    // Transaction methods.
-    SUBSCRIBE_NATIVE(handle_get_tx, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_tx_header, _1, _2, _3, _4, _5);
-    SUBSCRIBE_NATIVE(handle_get_tx_details, _1, _2, _3, _4, _5);
-    SUBSCRIBE_NATIVE(handle_get_tx_subscribe, _1, _2, _3, _4, _5);
-
-    // Input methods.
-    SUBSCRIBE_NATIVE(handle_get_inputs, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_input, _1, _2, _3, _4, _5, _6, _7);
-    SUBSCRIBE_NATIVE(handle_get_input_script, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_input_witness, _1, _2, _3, _4, _5, _6);
-
-    // Output methods.
-    SUBSCRIBE_NATIVE(handle_get_outputs, _1, _2, _3, _4, _5);
-    SUBSCRIBE_NATIVE(handle_get_output, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_output_script, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_output_spender, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_output_spenders, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_output_subscribe, _1, _2, _3, _4, _5, _6, _7);
-
-    // Address methods.
-    SUBSCRIBE_NATIVE(handle_get_address, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_address_confirmed, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_address_unconfirmed, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_address_balance, _1, _2, _3, _4, _5, _6);
-    SUBSCRIBE_NATIVE(handle_get_address_subscribe, _1, _2, _3, _4, _5, _6, _7);
+    // Channels join chase event lists only as they subscribe to events.
+    subscriber_ = chase_hub::make(BIND(handle_chase, _1, _2, _3));
     protocol_html::start();
 }
 
@@ -100,8 +52,10 @@ void protocol_native::stopping(const code& ec) NOEXCEPT
 {
     BC_ASSERT(stranded());
     stopping_.store(true);
-    dispatcher_.stop(ec);
-    unsubscribe_chase();
+    hub_.unsubscribe(subscriber_);
+
+    // The subscriber handler binds this protocol.
+    subscriber_.reset();
     protocol_html::stopping(ec);
 }
 
@@ -116,7 +70,7 @@ bool protocol_native::try_dispatch_object(const http::request& request) NOEXCEPT
     const auto target = request.target();
     BC_POP_WARNING()
 
-    rpc::request_t model{};
+    native_request model{};
     if (const auto ec = native_target(model, target))
     {
         // Allow invalid interface target to be retried as a page request.
@@ -124,26 +78,24 @@ bool protocol_native::try_dispatch_object(const http::request& request) NOEXCEPT
     }
 
     // No media defaults injected for an http request.
-    if (!native_query(model, request))
+    const auto accepts = http::to_media_types(request[http::field::accept]);
+    if (!native_query(model, target, accepts))
     {
         send_bad_request(request);
         return true;
     }
 
-    const auto media = get_media(model);
-    if (media == media_type::unknown)
+    if (model.media == media_type::unknown)
     {
         send_not_acceptable(request);
         return true;
     }
 
     // Falls through to html page dispatch.
-    if (media == media_type::text_html)
+    if (model.media == media_type::text_html)
         return false;
 
-    if (const auto ec = dispatcher_.notify(model))
-        send_internal_server_error(ec, request);
-
+    dispatch(model);
     return true;
 }
 
@@ -169,7 +121,7 @@ void protocol_native::dispatch_websocket(const http::request& request) NOEXCEPT
     // Target with query string is passed via websocket string body.
     const auto target = request.body().get<http::string_value>();
 
-    rpc::request_t model{};
+    native_request model{};
     if (const auto ec = native_target(model, target))
         return;
 
@@ -180,16 +132,178 @@ void protocol_native::dispatch_websocket(const http::request& request) NOEXCEPT
         return;
     }
 
-    if (get_media(model) == media_type::text_html)
+    if (model.media == media_type::text_html)
     {
         stop(network::error::not_acceptable);
         return;
     }
 
-    if (const auto ec = dispatcher_.notify(model))
+    dispatch(model);
+}
+
+// The interface method tag passed to each handler (native_method ordered).
+template <native_method Method>
+static constexpr const auto& tag() NOEXCEPT
+{
+    return std::get<static_cast<size_t>(Method)>(
+        interface::native_methods::methods);
+}
+
+// Hashes are shared only at the handler boundary (parsed onto the stack).
+// Requests of both transports (http and websocket) are timed from here.
+void protocol_native::dispatch(const native_request& model) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    start_request(to_method(model.method));
+    using method = native_method;
+    constexpr auto ok = error::success;
+    const auto version = model.version;
+    const auto media = to_value(model.media);
+    const auto height = model.height;
+    const auto shared = [&]() NOEXCEPT
     {
-        stop(network::error::internal_server_error);
-        return;
+        return model.hash.has_value() ?
+            emplace_shared<const hash_digest>(model.hash.value()) :
+            hash_cptr{};
+    };
+    const auto hash = [&]() NOEXCEPT -> std::optional<hash_cptr>
+    {
+        return model.hash.has_value() ? std::optional{ shared() } :
+            std::nullopt;
+    };
+
+    switch (model.method)
+    {
+        case method::configuration:
+            handle_get_configuration(ok, tag<method::configuration>(), version,
+                media);
+            break;
+        case method::top:
+            handle_get_top(ok, tag<method::top>(), version, media);
+            break;
+        case method::top_subscribe:
+            handle_get_top_subscribe(ok, tag<method::top_subscribe>(), version,
+                media, model.stop);
+            break;
+        case method::block:
+            handle_get_block(ok, tag<method::block>(), version, media, hash(),
+                height, model.witness);
+            break;
+        case method::block_header:
+            handle_get_block_header(ok, tag<method::block_header>(), version,
+                media, hash(), height);
+            break;
+        case method::block_header_context:
+            handle_get_block_header_context(ok,
+                tag<method::block_header_context>(), version, media, hash(),
+                height);
+            break;
+        case method::block_details:
+            handle_get_block_details(ok, tag<method::block_details>(), version,
+                media, hash(), height);
+            break;
+        case method::block_txs:
+            handle_get_block_txs(ok, tag<method::block_txs>(), version, media,
+                hash(), height);
+            break;
+        case method::block_filter:
+            handle_get_block_filter(ok, tag<method::block_filter>(), version,
+                media, model.type, hash(), height);
+            break;
+        case method::block_filter_hash:
+            handle_get_block_filter_hash(ok, tag<method::block_filter_hash>(),
+                version, media, model.type, hash(), height);
+            break;
+        case method::block_filter_header:
+            handle_get_block_filter_header(ok,
+                tag<method::block_filter_header>(), version, media, model.type,
+                hash(), height);
+            break;
+        case method::block_tx:
+            handle_get_block_tx(ok, tag<method::block_tx>(), version, media,
+                model.position, hash(), height, model.witness);
+            break;
+        case method::block_subscribe:
+            handle_get_block_subscribe(ok, tag<method::block_subscribe>(),
+                version, media, model.stop);
+            break;
+        case method::tx:
+            handle_get_tx(ok, tag<method::tx>(), version, media, shared(),
+                model.witness);
+            break;
+        case method::tx_header:
+            handle_get_tx_header(ok, tag<method::tx_header>(), version, media,
+                shared());
+            break;
+        case method::tx_details:
+            handle_get_tx_details(ok, tag<method::tx_details>(), version, media,
+                shared());
+            break;
+        case method::tx_subscribe:
+            handle_get_tx_subscribe(ok, tag<method::tx_subscribe>(), version,
+                media, model.stop);
+            break;
+        case method::inputs:
+            handle_get_inputs(ok, tag<method::inputs>(), version, media,
+                shared(), model.witness);
+            break;
+        case method::input:
+            handle_get_input(ok, tag<method::input>(), version, media, shared(),
+                model.index, model.witness);
+            break;
+        case method::input_script:
+            handle_get_input_script(ok, tag<method::input_script>(), version,
+                media, shared(), model.index);
+            break;
+        case method::input_witness:
+            handle_get_input_witness(ok, tag<method::input_witness>(), version,
+                media, shared(), model.index);
+            break;
+        case method::outputs:
+            handle_get_outputs(ok, tag<method::outputs>(), version, media,
+                shared());
+            break;
+        case method::output:
+            handle_get_output(ok, tag<method::output>(), version, media,
+                shared(), model.index);
+            break;
+        case method::output_script:
+            handle_get_output_script(ok, tag<method::output_script>(), version,
+                media, shared(), model.index);
+            break;
+        case method::output_spender:
+            handle_get_output_spender(ok, tag<method::output_spender>(),
+                version, media, shared(), model.index);
+            break;
+        case method::output_spenders:
+            handle_get_output_spenders(ok, tag<method::output_spenders>(),
+                version, media, shared(), model.index);
+            break;
+        case method::output_subscribe:
+            handle_get_output_subscribe(ok, tag<method::output_subscribe>(),
+                version, media, shared(), model.index, model.stop);
+            break;
+        case method::address:
+            handle_get_address(ok, tag<method::address>(), version, media,
+                shared(), model.turbo);
+            break;
+        case method::address_confirmed:
+            handle_get_address_confirmed(ok, tag<method::address_confirmed>(),
+                version, media, shared(), model.turbo);
+            break;
+        case method::address_unconfirmed:
+            handle_get_address_unconfirmed(ok,
+                tag<method::address_unconfirmed>(), version, media, shared(),
+                model.turbo);
+            break;
+        case method::address_balance:
+            handle_get_address_balance(ok, tag<method::address_balance>(),
+                version, media, shared(), model.turbo);
+            break;
+        case method::address_subscribe:
+            handle_get_address_subscribe(ok, tag<method::address_subscribe>(),
+                version, media, shared(), model.turbo, model.stop);
+            break;
     }
 }
 
@@ -242,11 +356,12 @@ bool protocol_native::handle_chase(const code&, node::chase event_,
         }
         case node::chase::transaction:
         {
-            const auto media = tx_subscribe_.load(relaxed);
-            if (media != media_type::unknown)
+            // Coalesced, as mempool churn would otherwise post and write
+            // once per accepted transaction.
+            if (tx_subscribe_.load(relaxed) != media_type::unknown)
             {
                 BC_ASSERT(std::holds_alternative<node::transaction_t>(value));
-                POST(do_transaction, std::get<node::transaction_t>(value), media);
+                batch_transaction(std::get<node::transaction_t>(value));
             }
 
             break;
@@ -292,6 +407,21 @@ database::header_link protocol_native::to_header(
     return {};
 }
 
+// Events are not joined without websocket, as there is no notification.
+void protocol_native::update_events(media_type prior, media_type value,
+    chase_hub::events events) NOEXCEPT
+{
+    const auto was = prior != media_type::unknown;
+    const auto is = value != media_type::unknown;
+    if (!websocket() || was == is)
+        return;
+
+    if (is)
+        hub_.subscribe(subscriber_, events);
+    else
+        hub_.unsubscribe(subscriber_, events);
+}
+
 // Use if deserialization is required.
 #if defined(UNDEFINED)
 using inpoints = database::inpoints;
@@ -66,7 +66,9 @@ bool protocol_native::handle_get_top_subscribe(const code& ec,
         return false;
 
     const auto value = stop ? media_type::unknown : (media_type)media;
-    top_subscribe_.store(value, std::memory_order_relaxed);
+    const auto prior = top_subscribe_.exchange(value,
+        std::memory_order_relaxed);
+    update_events(prior, value, top_events);
     if (stop)
     {
         send_empty();
@@ -533,7 +535,9 @@ bool protocol_native::handle_get_block_subscribe(const code& ec,
         return false;
 
     const auto value = stop ? media_type::unknown : (media_type)media;
-    block_subscribe_.store(value, std::memory_order_relaxed);
+    const auto prior = block_subscribe_.exchange(value,
+        std::memory_order_relaxed);
+    update_events(prior, value, block_events);
     if (stop)
     {
         send_empty();
@@ -18,7 +18,9 @@
  */
 #include <bitcoin/server/protocols/protocol_native.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <utility>
 #include <bitcoin/server/define.hpp>
 
@@ -181,29 +183,66 @@ bool protocol_native::handle_get_tx_subscribe(const code& ec,
         return false;
 
     const auto value = stop ? media_type::unknown : (media_type)media;
-    tx_subscribe_.store(value, std::memory_order_relaxed);
+    const auto prior = tx_subscribe_.exchange(value,
+        std::memory_order_relaxed);
+    update_events(prior, value, tx_events);
     notify_empty();
     return true;
 }
 
 // notify
-void protocol_native::do_transaction(node::transaction_t link,
+void protocol_native::batch_transaction(node::transaction_t link) NOEXCEPT
+{
+    if (const auto delay = transactions_.push(link))
+        transaction_batch::schedule(notification_strand_, delay.value(),
+            BIND(drain_transactions));
+}
+
+void protocol_native::drain_transactions() NOEXCEPT
+{
+    BC_ASSERT(notification_strand_.running_in_this_thread());
+
+    // Empty if taken by a prior drain (the batch filled within its window).
+    auto links = transactions_.pop();
+    if (stopped() || links.empty())
+        return;
+
+    // Subscription may have changed since accumulation.
+    const auto media = tx_subscribe_.load(std::memory_order_relaxed);
+    if (media != media_type::unknown)
+        POST(do_transactions, std::move(links), media);
+}
+
+// One frame per batch, an array of tx hashes in order of acceptance.
+void protocol_native::do_transactions(const transaction_batch::links& links,
     media_type media) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    const auto hash = archive().get_tx_key(link);
+    const auto& query = archive();
+    hashes out{};
+    out.reserve(links.size());
+    for (const auto link: links)
+        out.push_back(query.get_tx_key(link));
+
+    const auto size = out.size() * hash_size;
+    const auto bytes = pointer_cast<const uint8_t>(out.data());
     switch (to_value(media))
     {
         case data:
-            notify_chunk(to_chunk(hash));
+            notify_chunk(to_chunk({ bytes, std::next(bytes, size) }));
             return;
         case text:
-            notify_text(encode_base16(hash));
+            notify_text(encode_base16({ bytes, std::next(bytes, size) }));
             return;
         case json:
-            notify_json(value_from(encode_base16(hash)), two * hash_size);
+        {
+            boost::json::array array(out.size());
+            std::ranges::transform(out, array.begin(),
+                [](const auto& hash) NOEXCEPT { return encode_base16(hash); });
+            notify_json(std::move(array), two * size);
             return;
+        }
     }
 }
 
@@ -169,6 +169,33 @@ void protocol_html::dispatch_file(const request& request) NOEXCEPT
     send_file(std::move(file), file_media_type(path, octet_stream), request);
 }
 
+// Request metrics.
+// ----------------------------------------------------------------------------
+
+void protocol_html::start_request(const std::string_view& method) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    // The prior request was answered by a failure (non-html) sender.
+    if (!method_.empty())
+        metrics_.fail(options_.name, method_);
+
+    method_.assign(method);
+    started_ = clock::now();
+}
+
+// private
+void protocol_html::complete_request(size_t bytes) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    if (method_.empty())
+        return;
+
+    metrics_.record(options_.name, method_, clock::now() - started_, bytes,
+        false);
+    method_.clear();
+}
+
 // Senders.
 // ----------------------------------------------------------------------------
 
@@ -190,6 +217,7 @@ void protocol_html::send_json(boost::json::value&& model, size_t size_hint,
         .size_hint = size_hint
     };
     response.prepare_payload();
+    complete_request(size_hint);
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -203,6 +231,7 @@ void protocol_html::send_text(std::string&& hexidecimal,
     response.set(field::content_type, from_media_type(text));
     response.body() = std::move(hexidecimal);
     response.prepare_payload();
+    complete_request(response.payload_size().value_or(zero));
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -216,6 +245,7 @@ void protocol_html::send_chunk(system::data_chunk&& bytes,
     response.set(field::content_type, from_media_type(data));
     response.body() = std::move(bytes);
     response.prepare_payload();
+    complete_request(response.payload_size().value_or(zero));
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -230,6 +260,7 @@ void protocol_html::send_file(file&& file, media_type type,
     response.set(field::content_type, from_media_type(type));
     response.body() = std::move(file);
     response.prepare_payload();
+    complete_request(response.payload_size().value_or(zero));
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -243,6 +274,7 @@ void protocol_html::send_span(span_body::value_type&& span,
     response.set(field::content_type, from_media_type(type));
     response.body() = std::move(span);
     response.prepare_payload();
+    complete_request(response.payload_size().value_or(zero));
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -256,6 +288,7 @@ void protocol_html::send_buffer(buffer_body::value_type&& buffer,
     response.set(field::content_type, from_media_type(type));
     response.body() = std::move(buffer);
     response.prepare_payload();
+    complete_request(response.payload_size().value_or(zero));
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
@@ -268,6 +301,7 @@ void protocol_html::send_empty(const request& request) NOEXCEPT
     ////response.set(field::content_type, media_type::text_plain);
     response.body() = empty_value{};
     response.prepare_payload();
+    complete_request(zero);
     SEND(std::move(response), handle_complete, _1, error::success);
 }
 
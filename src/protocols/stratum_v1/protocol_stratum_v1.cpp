@@ -18,6 +18,9 @@
  */
 #include <bitcoin/server/protocols/protocol_stratum_v1.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <string>
 #include <bitcoin/server/define.hpp>
 #include <bitcoin/server/interfaces/interfaces.hpp>
 #include <bitcoin/server/protocols/protocol_rpc.hpp>
@@ -27,8 +30,22 @@ namespace server {
 
 #define CLASS protocol_stratum_v1
 
+using namespace system;
 using namespace interface;
+using namespace network::messages;
 using namespace std::placeholders;
+constexpr auto relaxed = std::memory_order_relaxed;
+
+// Parse a four byte (big-endian) hex number (ntime and nonce).
+static bool to_number(uint32_t& out, const std::string& text) NOEXCEPT
+{
+    data_array<sizeof(uint32_t)> bytes{};
+    if (!decode_base16(bytes, text))
+        return false;
+
+    out = from_big_endian(bytes);
+    return true;
+}
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 BC_PUSH_WARNING(SMART_PTR_NOT_NEEDED)
@@ -44,6 +61,9 @@ void protocol_stratum_v1::start() NOEXCEPT
     if (started())
         return;
 
+    // Channels join chase event lists only as they subscribe to events.
+    subscriber_ = chase_hub::make(BIND(handle_chase, _1, _2, _3));
+
     // Client requests.
     SUBSCRIBE_RPC(handle_mining_subscribe, _1, _2, _3, _4);
     SUBSCRIBE_RPC(handle_mining_authorize, _1, _2, _3, _4);
@@ -62,42 +82,165 @@ void protocol_stratum_v1::start() NOEXCEPT
     protocol_rpc<channel_stratum_v1>::start();
 }
 
+// Events unsubscription is asynchronous, race is ok.
+void protocol_stratum_v1::stopping(const code& ec) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    hub_.unsubscribe(subscriber_);
+
+    // The subscriber handler binds this protocol.
+    subscriber_.reset();
+    protocol_rpc<channel_stratum_v1>::stopping(ec);
+}
+
 // Handlers (client requests).
 // ----------------------------------------------------------------------------
 
+// The subscription identifier (both methods) is the extranonce1.
 bool protocol_stratum_v1::handle_mining_subscribe(const code& ec,
-    rpc_interface::mining_subscribe, const std::string& ,
-    double ) NOEXCEPT
+    rpc_interface::mining_subscribe, const std::string&, double) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_code(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    if (!subscribed_)
+    {
+        subscribed_ = true;
+        extranonce1_ = jobs_.extranonce1();
+        hub_.subscribe(subscriber_, job_events);
+    }
+
+    const auto extranonce1 = encode_base16(to_big_endian(extranonce1_));
+    send_result(array_t
+    {
+        array_t
+        {
+            array_t{ std::string{ "mining.set_difficulty" }, extranonce1 },
+            array_t{ std::string{ "mining.notify" }, extranonce1 }
+        },
+        extranonce1,
+        jobs_.extranonce2_size()
+    }, 128);
     return true;
 }
 
+// Workers are not authenticated, so their number is bounded per channel (and
+// by accounts). Jobs are not issued (so workers are not authorized) without a
+// payout.
 bool protocol_stratum_v1::handle_mining_authorize(const code& ec,
-    rpc_interface::mining_authorize, const std::string& ,
-    const std::string& ) NOEXCEPT
+    rpc_interface::mining_authorize, const std::string& username,
+    const std::string&) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_code(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    if (!jobs_.enabled())
+    {
+        send_code(error::method_unauthorized);
+        return true;
+    }
+
+    const auto first = workers_.empty();
+    if (!workers_.contains(username))
+    {
+        const auto maximum = server_settings().stratum_v1.maximum_workers;
+        const auto counter = workers_.size() < maximum ?
+            accounts_.counter(username) : share_counter::ptr{};
+
+        if (!counter)
+        {
+            send_code(error::subscription_limit);
+            return true;
+        }
+
+        workers_.emplace(username, counter);
+    }
+
+    send_result(true, 8);
+
+    if (first)
+        notify_difficulty();
+
+    notify_job();
     return true;
 }
 
 bool protocol_stratum_v1::handle_mining_submit(const code& ec,
-    rpc_interface::mining_submit, const std::string& ,
-    const std::string& , const std::string& ,
-    double , const std::string& ) NOEXCEPT
+    rpc_interface::mining_submit, const std::string& worker_name,
+    const std::string& job_id, const std::string& extranonce2,
+    const std::string& ntime, const std::string& nonce) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_code(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    const auto worker = workers_.find(worker_name);
+    if (!subscribed_ || worker == workers_.end())
+    {
+        send_code(error::method_unauthorized);
+        return true;
+    }
+
+    const auto& counter = worker->second;
+
+    const auto job = jobs_.find(job_id);
+    if (!job)
+    {
+        send_code(error::not_found);
+        return true;
+    }
+
+    // Jobs over a prior template are stale (all jobs clean prior jobs).
+    if (job != job_)
+    {
+        counter->stale.fetch_add(one, relaxed);
+        send_code(error::stale_job);
+        return true;
+    }
+
+    data_chunk roll{};
+    uint32_t time{}, number{};
+    if (!decode_base16(roll, extranonce2) ||
+        roll.size() != jobs_.extranonce2_size() ||
+        !to_number(time, ntime) || !to_number(number, nonce) ||
+        time < job->source->mintime)
+    {
+        counter->rejected.fetch_add(one, relaxed);
+        send_code(error::invalid_argument);
+        return true;
+    }
+
+    // Shares of the job at a prior (lower) difficulty remain acceptable.
+    const auto difficulty = std::min(grace_, vardiff_.difficulty());
+
+    stratum_share share
+    {
+        job, extranonce1_, prefix_, std::move(roll), time, number, difficulty,
+        BIND(handle_share, _1, _2, _3, difficulty, counter)
+    };
+
+    // Shares of all channels are drained by up to one job per pool thread.
+    auto drain{ false };
+    if (!validator_.enqueue(drain, std::move(share)))
+    {
+        counter->rejected.fetch_add(one, relaxed);
+        send_code(error::validator_busy);
+        return true;
+    }
+
+    if (drain && !pooled(BIND(do_validate)))
+        PARALLEL(do_validate);
+
     return true;
 }
 
+// The extranonce1 of a channel is never changed, so there is nothing to send.
 bool protocol_stratum_v1::handle_mining_extranonce_subscribe(const code& ec,
     rpc_interface::mining_extranonce_subscribe) NOEXCEPT
 {
-    if (stopped(ec)) return false;
-    send_code(error::not_implemented);
+    if (stopped(ec))
+        return false;
+
+    send_result(true, 8);
     return true;
 }
 
@@ -168,6 +311,171 @@ bool protocol_stratum_v1::handle_client_rejected(const code& ec,
     return true;
 }
 
+// Shares.
+// ----------------------------------------------------------------------------
+
+void protocol_stratum_v1::do_validate() NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+    validator_.drain();
+}
+
+// Invoked on the draining thread, for shares of this channel only.
+void protocol_stratum_v1::handle_share(const code& ec,
+    const hash_digest& hash, const chain::block::cptr& block,
+    uint32_t difficulty, const share_counter::ptr& counter) NOEXCEPT
+{
+    BC_ASSERT(!stranded());
+
+    // A block is checked and organized (as submitblock), the share is
+    // accepted regardless.
+    if (block)
+    {
+        if (const auto reason = templates_.check(archive(),
+            system_settings(), *block); !reason.empty())
+        {
+            LOGF("Stratum v1 block rejected (" << encode_hash(hash) << ") "
+                << reason);
+        }
+        else
+        {
+            organize(block, BIND(handle_organize, _1, _2, hash, counter));
+        }
+    }
+
+    POST(complete_submit, ec, hash, difficulty, counter);
+}
+
+// Invoked on the organizer thread.
+void protocol_stratum_v1::handle_organize(const code& ec, size_t height,
+    const hash_digest& hash, const share_counter::ptr& counter) NOEXCEPT
+{
+    if (ec)
+    {
+        LOGF("Stratum v1 block rejected (" << encode_hash(hash) << ") "
+            << block_templates::to_bip22(ec));
+        return;
+    }
+
+    counter->blocks.fetch_add(one, relaxed);
+    LOGN("Stratum v1 block organized (" << encode_hash(hash) << ") at "
+        << height);
+}
+
+void protocol_stratum_v1::complete_submit(const code& ec,
+    const hash_digest& hash, uint32_t difficulty,
+    const share_counter::ptr& counter) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped())
+        return;
+
+    if (ec)
+    {
+        counter->rejected.fetch_add(one, relaxed);
+        send_code(ec);
+        return;
+    }
+
+    // Shares are unique by header hash, retained for the current job.
+    if (!shares_.insert(hash).second)
+    {
+        counter->rejected.fetch_add(one, relaxed);
+        send_code(error::duplicate_share);
+        return;
+    }
+
+    counter->accepted.fetch_add(one, relaxed);
+    counter->work.fetch_add(difficulty, relaxed);
+    send_result(true, 8);
+
+    // Miners apply a new difficulty upon the next notify, so the current job
+    // is sent again (it remains valid, and its shares remain unique).
+    if (vardiff_.accept())
+    {
+        notify_difficulty();
+        if (job_)
+            send_job(job_);
+    }
+}
+
+// Jobs.
+// ----------------------------------------------------------------------------
+
+bool protocol_stratum_v1::handle_chase(const code&, node::chase event_,
+    node::event_value) NOEXCEPT
+{
+    // Do not pass ec to stopped, it is not a call status.
+    if (stopped())
+        return false;
+
+    if (event_ == node::chase::organized)
+        POST(do_organized);
+
+    return true;
+}
+
+void protocol_stratum_v1::do_organized() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (stopped() || workers_.empty())
+        return;
+
+    // A miner that submits no shares is lowered only upon a new job.
+    if (vardiff_.retarget())
+        notify_difficulty();
+
+    notify_job();
+}
+
+// The template and job are built once over the confirmed top (by the first
+// channel to observe it), each channel then writes the shared notification.
+stratum_job::cptr protocol_stratum_v1::current_job() NOEXCEPT
+{
+    const auto& query = archive();
+    const auto link = query.to_confirmed(query.get_top_confirmed());
+    return jobs_.update(templates_.update(query, system_settings(), link));
+}
+
+void protocol_stratum_v1::notify_job() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    if (!subscribed_)
+        return;
+
+    const auto job = current_job();
+    if (!job || job == job_)
+        return;
+
+    job_ = job;
+    prefix_ = stratum_jobs::prefix(*job, extranonce1_);
+    grace_ = vardiff_.difficulty();
+    shares_.clear();
+    send_job(job);
+}
+
+// The notification is serialized once per job and written by reference.
+void protocol_stratum_v1::send_job(const stratum_job::cptr& job) NOEXCEPT
+{
+    BC_ASSERT(stranded());
+    send_shared({ job, &job->notification });
+}
+
+void protocol_stratum_v1::notify_difficulty() NOEXCEPT
+{
+    BC_ASSERT(stranded());
+
+    const auto difficulty = vardiff_.difficulty();
+    grace_ = std::min(grace_, difficulty);
+    send_notification("mining.set_difficulty", array_t
+    {
+        difficulty
+    }, 32);
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -18,8 +18,13 @@
  */
 #include <bitcoin/server/server_node.hpp>
 
+#include <chrono>
+#include <memory>
+#include <thread>
 #include <utility>
+#include <variant>
 #include <bitcoin/server/define.hpp>
+#include <bitcoin/server/events.hpp>
 #include <bitcoin/server/sessions/sessions.hpp>
 
 namespace libbitcoin {
@@ -29,6 +34,7 @@ using namespace system;
 using namespace database;
 using namespace network;
 using namespace node;
+using namespace std::chrono;
 using namespace std::placeholders;
 
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
@@ -37,12 +43,23 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 server_node::server_node(query& query, const configuration& configuration,
     const logger& log) NOEXCEPT
   : full_node(query, configuration, log),
-    config_(configuration)
+    config_(configuration),
+    stats_cache_(configuration.server.bitcoind.block_stats_cache),
+    jobs_(configuration.server),
+    accounts_(configuration.server.stratum_v1.maximum_accounts),
+    validator_(configuration.server.stratum_v1.maximum_shares,
+        is_zero(configuration.server.pools.stratum_v1.threads) ?
+            configuration.network.threads :
+            configuration.server.pools.stratum_v1.threads),
+    pools_(configuration.server, log),
+    limits_(configuration.server),
+    counters_(std::make_shared<server_metrics>(configuration.server))
 {
 }
 
 server_node::~server_node() NOEXCEPT
 {
+    stop_seeder();
 }
 
 // Properties.
@@ -58,39 +75,131 @@ const settings& server_node::server_settings() const NOEXCEPT
     return config_.server;
 }
 
+// Services.
+// ----------------------------------------------------------------------------
+
+block_stats_cache& server_node::stats_cache() NOEXCEPT
+{
+    return stats_cache_;
+}
+
+chain_tx_index& server_node::tx_index() NOEXCEPT
+{
+    return tx_index_;
+}
+
+block_waiters& server_node::waiters() NOEXCEPT
+{
+    return waiters_;
+}
+
+block_notifications& server_node::notices() NOEXCEPT
+{
+    return notices_;
+}
+
+chase_hub& server_node::hub() NOEXCEPT
+{
+    return hub_;
+}
+
+block_templates& server_node::templates() NOEXCEPT
+{
+    return templates_;
+}
+
+stratum_jobs& server_node::jobs() NOEXCEPT
+{
+    return jobs_;
+}
+
+stratum_accounts& server_node::accounts() NOEXCEPT
+{
+    return accounts_;
+}
+
+share_validator& server_node::validator() NOEXCEPT
+{
+    return validator_;
+}
+
+executor_pools& server_node::pools() NOEXCEPT
+{
+    return pools_;
+}
+
+rate_limits& server_node::limits() NOEXCEPT
+{
+    return limits_;
+}
+
+request_metrics& server_node::metrics() NOEXCEPT
+{
+    return metrics_;
+}
+
+server_metrics& server_node::counters() NOEXCEPT
+{
+    return *counters_;
+}
+
 // Sequences.
 // ----------------------------------------------------------------------------
 
 void server_node::run(result_handler&& handler) NOEXCEPT
 {
+    // log outlives node, so the handler shares ownership of the counters.
+    log.subscribe_events(
+        [counters = counters_](const code& ec, uint8_t event_,
+            uint64_t value, const logger::time&) NOEXCEPT
+        {
+            if (ec)
+                return false;
+
+            counters->fire(event_, value);
+            return true;
+        });
+
     // Base (net) invokes do_run().
     full_node::run(std::move(handler));
 }
 
-void server_node::do_run(const result_handler& handler) NOEXCEPT
+// Pool threads and the seeder may hold store reads, so these are joined once
+// the network is closed and before the store is closed by the owner.
+void server_node::close() NOEXCEPT
 {
-    BC_ASSERT(stranded());
+    full_node::close();
+    stop_seeder();
+    pools_.stop();
+}
 
-    // Start services after node is running.
-    full_node::do_run(std::bind(&server_node::start_admin, this, _1, handler));
+void server_node::stop_seeder() NOEXCEPT
+{
+    closed_.store(true, std::memory_order_relaxed);
+    if (seeder_.joinable() && seeder_.get_id() != std::this_thread::get_id())
+        seeder_.join();
 }
 
-void server_node::start_admin(const code& ec,
-    const result_handler& handler) NOEXCEPT
+void server_node::do_run(const result_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    if (ec)
-    {
-        handler(ec);
-        return;
-    }
-
-    attach_admin_session()->start(
-        std::bind(&server_node::start_native, this, _1, handler));
+    // Start services after node is running.
+    full_node::do_run(
+        std::bind(&server_node::start_sessions, this, _1, handler));
 }
 
-void server_node::start_native(const code& ec,
+// Sessions are independent, so all are started without awaiting any other.
+// Completion is joined on the node strand, reporting the first error code.
+struct server_node::startup
+{
+    size_t remaining;
+    code ec;
+    logger::time start;
+    result_handler handler;
+};
+
+void server_node::start_sessions(const code& ec,
     const result_handler& handler) NOEXCEPT
 {
     BC_ASSERT(stranded());
@@ -101,82 +210,98 @@ void server_node::start_native(const code& ec,
         return;
     }
 
-    attach_native_session()->start(
-        std::bind(&server_node::start_bitcoind, this, _1, handler));
-}
+    // Chaser events are fanned out by type to subscribed channels only.
+    subscribe_chase(
+        std::bind(&server_node::handle_chase, this, _1, _2, _3),
+        std::bind(&server_node::handle_subscribed, this, _1, _2));
 
-void server_node::start_bitcoind(const code& ec,
-    const result_handler& handler) NOEXCEPT
-{
-    BC_ASSERT(stranded());
+    // The tx index seed walks the confirmed chain, so it is not awaited. Until
+    // it is ready getchaintxstats reads the store directly.
+    seeder_ = std::thread([this]() NOEXCEPT
+    {
+        tx_index_.seed(archive(), closed_);
+    });
 
-    if (ec)
+    constexpr size_t sessions = 7;
+    const auto join = std::make_shared<startup>(startup
     {
-        handler(ec);
-        return;
-    }
+        sessions, {}, logger::now(), handler
+    });
 
-    attach_bitcoind_session()->start(
-        std::bind(&server_node::start_btcd, this, _1, handler));
+    const auto started = [&](uint8_t event_) NOEXCEPT
+    {
+        return std::bind(&server_node::handle_session, this, _1, event_,
+            logger::now(), join);
+    };
+
+    attach_admin_session()->start(started(admin_start_msecs));
+    attach_native_session()->start(started(native_start_msecs));
+    attach_bitcoind_session()->start(started(bitcoind_start_msecs));
+    attach_btcd_session()->start(started(btcd_start_msecs));
+    attach_electrum_session()->start(started(electrum_start_msecs));
+    attach_stratum_v1_session()->start(started(stratum1_start_msecs));
+    attach_stratum_v2_session()->start(started(stratum2_start_msecs));
 }
 
-void server_node::start_btcd(const code& ec,
-    const result_handler& handler) NOEXCEPT
+void server_node::handle_session(const code& ec, uint8_t event_,
+    const logger::time& start, const startup_ptr& join) NOEXCEPT
 {
     BC_ASSERT(stranded());
 
-    if (ec)
-    {
-        handler(ec);
+    const auto now = logger::now();
+    fire(event_, to_unsigned(duration_cast<milliseconds>(now -
+        start).count()));
+
+    if (ec && !join->ec)
+        join->ec = ec;
+
+    if (!is_zero(--join->remaining))
         return;
-    }
 
-    attach_btcd_session()->start(
-        std::bind(&server_node::start_electrum, this, _1, handler));
+    fire(sessions_start_msecs, to_unsigned(duration_cast<milliseconds>(now -
+        join->start).count()));
+
+    join->handler(join->ec);
 }
 
-void server_node::start_electrum(const code& ec,
-    const result_handler& handler) NOEXCEPT
+// Chase events.
+// ----------------------------------------------------------------------------
+
+bool server_node::handle_chase(const code& ec, chase event_,
+    event_value value) NOEXCEPT
 {
-    BC_ASSERT(stranded());
+    // Server-wide services are updated once, before channels are notified.
+    if (!ec && (event_ == chase::organized || event_ == chase::reorganized))
+        tx_index_.update(archive());
 
-    if (ec)
+    // The template is built before long-polls are released to consume it,
+    // and over the confirmed top (a late event must not displace it).
+    if (!ec && event_ == chase::organized)
     {
-        handler(ec);
-        return;
+        BC_ASSERT(std::holds_alternative<header_t>(value));
+        const auto& query = archive();
+        const auto top = query.to_confirmed(query.get_top_confirmed());
+        templates_.update(query, config_.bitcoin, top);
+        waiters_.notify(query, std::get<header_t>(value));
     }
 
-    attach_electrum_session()->start(
-        std::bind(&server_node::start_stratum_v1, this, _1, handler));
-}
-
-void server_node::start_stratum_v1(const code& ec,
-    const result_handler& handler) NOEXCEPT
-{
-    BC_ASSERT(stranded());
-
-    if (ec)
+    if (!ec && event_ == chase::transaction)
     {
-        handler(ec);
-        return;
+        BC_ASSERT(std::holds_alternative<transaction_t>(value));
+        templates_.add(archive(), std::get<transaction_t>(value));
     }
 
-    attach_stratum_v1_session()->start(
-        std::bind(&server_node::start_stratum_v2, this, _1, handler));
+    // Stop is not fanned out (channels unsubscribe themselves upon stop).
+    hub_.notify(ec, event_, value);
+    return !ec;
 }
 
-void server_node::start_stratum_v2(const code& ec,
-    const result_handler& handler) NOEXCEPT
+void server_node::handle_subscribed(const code& ec, object_key) NOEXCEPT
 {
-    BC_ASSERT(stranded());
-
     if (ec)
     {
-        handler(ec);
-        return;
+        LOGF("Chase subscription failed, " << ec.message());
     }
-
-    attach_stratum_v2_session()->start(move_copy(handler));
 }
 
 // Session attachments.
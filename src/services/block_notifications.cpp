@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/block_notifications.hpp>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace network::rpc;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+block_notification::cptr block_notifications::get(const node::query& query,
+    const database::header_link& link) NOEXCEPT
+{
+    if (const auto notice = find(link))
+        return notice;
+
+    // Reads are small (height and header), so they are performed unlocked
+    // and a concurrent build of the same block is discarded for the first.
+    size_t height{};
+    if (!query.get_height(height, link))
+        return {};
+
+    const auto header = query.get_header(link);
+    if (!header)
+        return {};
+
+    auto notice = build(link, height, header);
+    std::unique_lock lock{ mutex_ };
+    for (const auto& recent: recent_)
+        if (recent->link == link)
+            return recent;
+
+    recent_.push_front(notice);
+    if (recent_.size() > history)
+        recent_.pop_back();
+
+    return notice;
+}
+
+block_notification::cptr block_notifications::find(
+    const database::header_link& link) const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    for (const auto& recent: recent_)
+        if (recent->link == link)
+            return recent;
+
+    return {};
+}
+
+// static
+block_notification::cptr block_notifications::build(
+    const database::header_link& link, size_t height,
+    const chain::header::cptr& header) NOEXCEPT
+{
+    if (!header)
+        return {};
+
+    auto text = encode_base16(header->to_data());
+
+    // Electrum header notification, serialized once (newline delimited) for
+    // all subscribers, as written by protocol_electrum::do_header.
+    const request_t headers
+    {
+        .jsonrpc = version::v2,
+        .method = "blockchain.headers.subscribe",
+        .params = params_t
+        {
+            array_t
+            {
+                object_t
+                {
+                    { "height", height },
+                    { "hex", text }
+                }
+            }
+        }
+    };
+
+    auto serialized = boost::json::serialize(boost::json::value_from(headers));
+    serialized.push_back('\n');
+
+    // btcd (btcjson) marshals notifications as json-rpc 1.0 requests with a
+    // null id, serialized here once (from the rpc model) for all websocket
+    // subscribers, as written by protocol_btcd::notify_connected.
+    const request_t connected
+    {
+        .jsonrpc = version::v1,
+        .id = null_t{},
+        .method = "blockconnected",
+        .params = params_t
+        {
+            array_t
+            {
+                encode_hash(header->get_hash()),
+                height,
+                header->timestamp()
+            }
+        }
+    };
+
+    return std::make_shared<const block_notification>(block_notification
+    {
+        .link = link,
+        .height = height,
+        .header = header,
+        .header_text = std::move(text),
+        // Electrum expects singleton params (invalid json-rpc).
+        .numblocks = value_t{ height },
+        .headers = std::move(serialized),
+        .connected = boost::json::serialize(boost::json::value_from(connected))
+    });
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
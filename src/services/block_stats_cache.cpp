@@ -0,0 +1,70 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/block_stats_cache.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+block_stats_cache::block_stats_cache(size_t capacity) NOEXCEPT
+  : slots_(capacity)
+{
+}
+
+bool block_stats_cache::get(block_stats_record& out, size_t height,
+    const database::header_link& link) const NOEXCEPT
+{
+    if (slots_.empty() || link.is_terminal())
+        return false;
+
+    std::shared_lock lock{ mutex_ };
+    const auto& slot = slots_.at(height % slots_.size());
+    if (slot.link != link || slot.record.height != height)
+        return false;
+
+    out = slot.record;
+    return true;
+}
+
+void block_stats_cache::put(const database::header_link& link,
+    const block_stats_record& record) NOEXCEPT
+{
+    if (slots_.empty() || link.is_terminal())
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    auto& slot = slots_.at(record.height % slots_.size());
+    slot.link = link;
+    slot.record = record;
+}
+
+size_t block_stats_cache::capacity() const NOEXCEPT
+{
+    return slots_.size();
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
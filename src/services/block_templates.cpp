@@ -0,0 +1,627 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/block_templates.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+// Block limits in weight and sigop cost (legacy limits scale by four).
+constexpr auto maximum_weight = 4'000'000_size -
+    block_templates::reserved_weight;
+constexpr auto maximum_sigops = 80'000_size -
+    block_templates::reserved_sigops;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Witness transactions are not valid prior to bip141 activation.
+static template_txs legacy(const template_txs& txs) NOEXCEPT
+{
+    template_txs out{};
+    out.reserve(txs.size());
+    for (const auto& tx: txs)
+        if (tx->txid == tx->wtxid)
+            out.push_back(tx);
+
+    return out;
+}
+
+block_templates::block_templates() NOEXCEPT
+{
+}
+
+// A new parent prunes the pool (store reads), and a new parent or a pending
+// reselection selects from it. Both are outside of the lock, so a transaction
+// pooled meanwhile is left to the next reselection.
+block_template::cptr block_templates::update(const node::query& query,
+    const system::settings& settings, node::header_t link) NOEXCEPT
+{
+    const auto current = [&]() NOEXCEPT
+    {
+        return current_ && current_->parent == link && !reselect_;
+    };
+
+    bool parent{};
+    uint64_t changes{};
+    template_txs candidates{};
+    {
+        std::shared_lock lock{ mutex_ };
+        if (current())
+            return current_;
+
+        parent = !current_ || current_->parent != link;
+        changes = changes_;
+        candidates.reserve(pool_.size());
+        for (const auto& entry: pool_)
+            candidates.push_back(entry.second);
+    }
+
+    const auto retained = parent ? prune(query, candidates) : candidates;
+    const auto built = build(query, settings, link, retained);
+    if (!built)
+        return {};
+
+    std::unique_lock lock{ mutex_ };
+    if (parent && retained.size() != candidates.size())
+    {
+        std::unordered_set<hash_digest> keep{};
+        keep.reserve(retained.size());
+        for (const auto& tx: retained)
+            keep.insert(tx->txid);
+
+        for (const auto& tx: candidates)
+            if (!keep.contains(tx->txid))
+                pool_.erase(tx->txid);
+    }
+
+    if (current())
+        return current_;
+
+    // The template is not yet shared, so the sequence is set in place.
+    built->sequence = ++sequence_;
+    current_ = built;
+    reselect_ = changes_ != changes;
+    return current_;
+}
+
+// Store reads are outside of the lock. An input is either of a pooled parent
+// or of a confirmed tx, otherwise the transaction is not poolable (its parent
+// was not announced, e.g. prior to startup).
+bool block_templates::add(const node::query& query,
+    node::transaction_t link) NOEXCEPT
+{
+    const auto tx = query.get_transaction(link, true);
+    if (!tx || tx->is_coinbase() || !query.populate_without_metadata(*tx))
+        return false;
+
+    const auto out = std::make_shared<template_tx>();
+    out->data = tx->to_data(true);
+    out->txid = tx->hash(false);
+    out->wtxid = tx->hash(true);
+    out->weight = tx->weight();
+    out->sigops = tx->signature_operations(true, true);
+
+    uint64_t value{};
+    hashes unconfirmed{};
+    out->spends.reserve(tx->inputs_ptr()->size());
+    for (const auto& in: *tx->inputs_ptr())
+    {
+        value += in->prevout->value();
+        out->spends.push_back(in->point());
+
+        size_t height{};
+        const auto& hash = in->point().hash();
+        if (!query.get_tx_height(height, query.to_tx(hash)))
+            unconfirmed.push_back(hash);
+    }
+
+    uint64_t spend{};
+    for (const auto& output: *tx->outputs_ptr())
+        spend += output->value();
+
+    out->fee = floored_subtract(value, spend);
+
+    std::unique_lock lock{ mutex_ };
+    for (const auto& hash: unconfirmed)
+    {
+        if (!pool_.contains(hash))
+            return false;
+
+        if (std::ranges::find(out->parents, hash) == out->parents.end())
+            out->parents.push_back(hash);
+    }
+
+    if (!pool_.emplace(out->txid, out).second)
+        return true;
+
+    ++changes_;
+    if (!current_ || reselect_)
+        return true;
+
+    if (appendable(*out))
+        append(out);
+    else
+        reselect_ = true;
+
+    return true;
+}
+
+block_template::cptr block_templates::current() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return current_;
+}
+
+size_t block_templates::pooled() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return pool_.size();
+}
+
+std::string block_templates::check(const node::query& query,
+    const system::settings& settings, const chain::block& block) NOEXCEPT
+{
+    const auto& header = block.header();
+    if (!query.to_header(block.hash()).is_terminal())
+        return "duplicate";
+
+    const auto top = query.to_confirmed(query.get_top_confirmed());
+    const auto value = update(query, settings, top);
+    if (!value)
+        return "rejected";
+
+    if (header.previous_block_hash() != value->previous)
+        return "inconclusive-not-best-prevblk";
+
+    if (header.bits() != value->bits)
+        return "bad-diffbits";
+
+    if (to_uintx(block.hash()) > chain::compact::expand(header.bits()))
+        return "high-hash";
+
+    if (header.timestamp() < value->mintime)
+        return "time-too-old";
+
+    if (const auto ec = block.check())
+        return to_bip22(ec);
+
+    const auto state = query.get_chain_state(settings, value->previous);
+    if (!state)
+        return "rejected";
+
+    const auto context = chain::chain_state{ *state, settings }.context();
+    if (const auto ec = block.check(context))
+        return to_bip22(ec);
+
+    return {};
+}
+
+// Reasons as returned by bitcoind (validation state reject reasons).
+std::string block_templates::to_bip22(const code& ec) NOEXCEPT
+{
+    if (!ec)
+        return {};
+
+    if (ec == node::error::duplicate_block)
+        return "duplicate";
+
+    // The block was not rejected, its validity is not yet known.
+    if (ec == network::error::service_stopped)
+        return "inconclusive";
+
+    using namespace system::error;
+    static const std::array<std::pair<error_t, const char*>, 15> reasons
+    {
+        std::pair{ invalid_proof_of_work, "high-hash" },
+        std::pair{ futuristic_timestamp, "time-too-new" },
+        std::pair{ timestamp_too_early, "time-too-old" },
+        std::pair{ incorrect_proof_of_work, "bad-diffbits" },
+        std::pair{ invalid_block_version, "bad-version" },
+        std::pair{ block_size_limit, "bad-blk-length" },
+        std::pair{ empty_block, "bad-blk-length" },
+        std::pair{ first_not_coinbase, "bad-cb-missing" },
+        std::pair{ extra_coinbases, "bad-cb-multiple" },
+        std::pair{ internal_duplicate, "bad-txns-duplicate" },
+        std::pair{ merkle_mismatch, "bad-txnmrklroot" },
+        std::pair{ block_legacy_sigop_limit, "bad-blk-sigops" },
+        std::pair{ block_non_final, "bad-txns-nonfinal" },
+        std::pair{ coinbase_height_mismatch, "bad-cb-height" },
+        std::pair{ invalid_witness_commitment, "bad-witness-merkle-match" }
+    };
+
+    // Comparison is by category, so other error codes do not alias.
+    for (const auto& reason: reasons)
+        if (ec == reason.first)
+            return reason.second;
+
+    return "rejected";
+}
+
+std::string block_templates::longpollid(const block_template& value) NOEXCEPT
+{
+    return encode_hash(value.previous) + std::to_string(value.sequence);
+}
+
+// The coinbase wtxid is null, so the witness root of a coinbase-only block
+// is null, and the commitment is the hash of the root and reserved value.
+hash_digest block_templates::empty_commitment() NOEXCEPT
+{
+    return bitcoin_hash(splice(null_hash, null_hash));
+}
+
+hash_digest block_templates::commitment(const template_txs& txs) NOEXCEPT
+{
+    if (txs.empty())
+        return empty_commitment();
+
+    hashes wtxids{ null_hash };
+    wtxids.reserve(add1(txs.size()));
+    for (const auto& tx: txs)
+        wtxids.push_back(tx->wtxid);
+
+    return bitcoin_hash(splice(sha256::merkle_root(std::move(wtxids)),
+        null_hash));
+}
+
+// Ancestor sets are over candidates, and a package (the unselected ancestors
+// of a tx and the tx) is ordered by ancestor count, which is a dependency
+// order. Upon selection the aggregates of unselected descendants are reduced
+// and requeued, and stale queue entries are skipped (lazy deletion).
+template_txs block_templates::select(const template_txs& candidates,
+    size_t weight_limit, size_t sigop_limit) NOEXCEPT
+{
+    const auto count = candidates.size();
+    std::unordered_map<hash_digest, size_t> index{};
+    index.reserve(count);
+    for (size_t at{}; at < count; ++at)
+        index.emplace(candidates.at(at)->txid, at);
+
+    // Parents and children by candidate index, excluding orphans.
+    std::vector<std::vector<size_t>> parents(count);
+    std::vector<std::vector<size_t>> children(count);
+    std::vector<bool> excluded(count);
+    for (size_t at{}; at < count; ++at)
+    {
+        for (const auto& hash: candidates.at(at)->parents)
+        {
+            const auto it = index.find(hash);
+            if (it == index.end())
+            {
+                excluded.at(at) = true;
+                break;
+            }
+
+            parents.at(at).push_back(it->second);
+            children.at(it->second).push_back(at);
+        }
+    }
+
+    // Transitive closure over parents (excluded if any ancestor is).
+    std::vector<std::vector<size_t>> ancestors(count);
+    std::vector<bool> resolved(count);
+    const auto resolve = [&](size_t root) NOEXCEPT
+    {
+        std::vector<size_t> stack{ root };
+        while (!stack.empty())
+        {
+            const auto at = stack.back();
+            if (resolved.at(at))
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            auto ready = true;
+            for (const auto parent: parents.at(at))
+            {
+                if (!resolved.at(parent))
+                {
+                    stack.push_back(parent);
+                    ready = false;
+                }
+            }
+
+            if (!ready)
+                continue;
+
+            std::unordered_set<size_t> set{ at };
+            for (const auto parent: parents.at(at))
+            {
+                excluded.at(at) = excluded.at(at) || excluded.at(parent);
+                set.insert(ancestors.at(parent).begin(),
+                    ancestors.at(parent).end());
+            }
+
+            ancestors.at(at).assign(set.begin(), set.end());
+            resolved.at(at) = true;
+            stack.pop_back();
+        }
+    };
+
+    for (size_t at{}; at < count; ++at)
+        resolve(at);
+
+    // Aggregates of unselected ancestors (including self).
+    struct package
+    {
+        uint64_t fee{};
+        size_t weight{};
+        size_t sigops{};
+        size_t version{};
+    };
+
+    std::vector<package> packages(count);
+    std::vector<bool> selected(count);
+    const auto aggregate = [&](size_t at) NOEXCEPT
+    {
+        auto& value = packages.at(at);
+        value.fee = zero;
+        value.weight = zero;
+        value.sigops = zero;
+        for (const auto ancestor: ancestors.at(at))
+        {
+            if (selected.at(ancestor))
+                continue;
+
+            const auto& tx = *candidates.at(ancestor);
+            value.fee += tx.fee;
+            value.weight += tx.weight;
+            value.sigops += tx.sigops;
+        }
+
+        ++value.version;
+    };
+
+    using entry = std::pair<double, std::pair<size_t, size_t>>;
+    std::priority_queue<entry> queue{};
+    const auto enqueue = [&](size_t at) NOEXCEPT
+    {
+        aggregate(at);
+        const auto& value = packages.at(at);
+        const auto rate = to_floating(value.fee) /
+            to_floating(std::max(value.weight, one));
+        queue.emplace(rate, std::pair{ at, value.version });
+    };
+
+    for (size_t at{}; at < count; ++at)
+        if (!excluded.at(at))
+            enqueue(at);
+
+    template_txs out{};
+    size_t weight{}, sigops{};
+    std::unordered_set<chain::point> spent{};
+    std::vector<bool> failed(count);
+    while (!queue.empty())
+    {
+        const auto [at, version] = queue.top().second;
+        queue.pop();
+        if (selected.at(at) || failed.at(at) ||
+            packages.at(at).version != version)
+            continue;
+
+        const auto& value = packages.at(at);
+        if (weight + value.weight > weight_limit ||
+            sigops + value.sigops > sigop_limit)
+        {
+            failed.at(at) = true;
+            continue;
+        }
+
+        std::vector<size_t> members{};
+        for (const auto ancestor: ancestors.at(at))
+            if (!selected.at(ancestor))
+                members.push_back(ancestor);
+
+        const auto conflicted = std::ranges::any_of(members,
+            [&](size_t member) NOEXCEPT
+            {
+                return std::ranges::any_of(candidates.at(member)->spends,
+                    [&](const auto& point) NOEXCEPT
+                    {
+                        return spent.contains(point);
+                    });
+            });
+
+        if (conflicted)
+        {
+            failed.at(at) = true;
+            continue;
+        }
+
+        std::ranges::sort(members, [&](size_t left, size_t right) NOEXCEPT
+        {
+            return ancestors.at(left).size() < ancestors.at(right).size();
+        });
+
+        weight += value.weight;
+        sigops += value.sigops;
+        std::unordered_set<size_t> affected{};
+        for (const auto member: members)
+        {
+            const auto& tx = candidates.at(member);
+            selected.at(member) = true;
+            spent.insert(tx->spends.begin(), tx->spends.end());
+            out.push_back(tx);
+
+            std::vector<size_t> stack{ children.at(member) };
+            while (!stack.empty())
+            {
+                const auto child = stack.back();
+                stack.pop_back();
+                if (affected.insert(child).second)
+                    stack.insert(stack.end(), children.at(child).begin(),
+                        children.at(child).end());
+            }
+        }
+
+        for (const auto child: affected)
+            if (!selected.at(child) && !excluded.at(child))
+                enqueue(child);
+    }
+
+    return out;
+}
+
+// private
+block_template::ptr block_templates::build(const node::query& query,
+    const system::settings& settings, node::header_t link,
+    const template_txs& candidates) NOEXCEPT
+{
+    const auto previous = query.get_header_key(link);
+    const auto state = query.get_chain_state(settings, previous);
+    if (!state)
+        return {};
+
+    // The context of the next block, which the template becomes.
+    const auto context = chain::chain_state{ *state, settings }.context();
+    const auto subsidy = chain::block::subsidy(context.height,
+        settings.subsidy_interval_blocks, settings.initial_subsidy(),
+        settings.forks.bip42);
+
+    const auto out = std::make_shared<block_template>();
+    out->parent = link;
+    out->previous = previous;
+    out->height = context.height;
+    out->version = std::max(version, context.minimum_block_version);
+    out->bits = context.work_required;
+    out->mintime = add1(context.median_time_past);
+    out->segwit = context.is_enabled(chain::flags::bip141_rule);
+
+    out->transactions = select(out->segwit ? candidates : legacy(candidates),
+        maximum_weight, maximum_sigops);
+    for (const auto& tx: out->transactions)
+    {
+        out->fees += tx->fee;
+        out->weight += tx->weight;
+        out->sigops += tx->sigops;
+    }
+
+    out->coinbase_value = subsidy + out->fees;
+    out->witness_commitment = commitment(out->transactions);
+    return out;
+}
+
+// private
+// A pooled transaction is dropped once confirmed, or once any of its inputs
+// is spent by a confirmed transaction (a conflict). Descendants of dropped
+// transactions are excluded by selection (their parent is not a candidate)
+// and are dropped by the next prune.
+template_txs block_templates::prune(const node::query& query,
+    const template_txs& candidates) NOEXCEPT
+{
+    std::unordered_set<hash_digest> pooled{};
+    pooled.reserve(candidates.size());
+    for (const auto& tx: candidates)
+        pooled.insert(tx->txid);
+
+    template_txs out{};
+    out.reserve(candidates.size());
+    for (const auto& tx: candidates)
+    {
+        size_t height{};
+        if (query.get_tx_height(height, query.to_tx(tx->txid)))
+            continue;
+
+        const auto conflicted = std::ranges::any_of(tx->spends,
+            [&](const auto& point) NOEXCEPT
+            {
+                return query.is_confirmed_spent(query.to_output(point.hash(),
+                    point.index()));
+            });
+
+        const auto orphaned = std::ranges::any_of(tx->parents,
+            [&](const auto& hash) NOEXCEPT
+            {
+                return !pooled.contains(hash) &&
+                    !query.get_tx_height(height, query.to_tx(hash));
+            });
+
+        if (!conflicted && !orphaned)
+            out.push_back(tx);
+    }
+
+    return out;
+}
+
+// private (requires lock)
+// The parents of the transaction are selected (or confirmed), it does not
+// conflict with a selected transaction, and it fits the limits.
+bool block_templates::appendable(const template_tx& tx) const NOEXCEPT
+{
+    const auto& value = *current_;
+    if ((!value.segwit && tx.txid != tx.wtxid) ||
+        value.weight + tx.weight > maximum_weight ||
+        value.sigops + tx.sigops > maximum_sigops)
+        return false;
+
+    const auto& txs = value.transactions;
+    const auto selected = [&](const hash_digest& hash) NOEXCEPT
+    {
+        return std::ranges::any_of(txs, [&](const auto& other) NOEXCEPT
+        {
+            return other->txid == hash;
+        });
+    };
+
+    const auto conflicts = [&](const chain::point& point) NOEXCEPT
+    {
+        return std::ranges::any_of(txs, [&](const auto& other) NOEXCEPT
+        {
+            return std::ranges::find(other->spends, point) !=
+                other->spends.end();
+        });
+    };
+
+    return std::ranges::all_of(tx.parents, selected) &&
+        std::ranges::none_of(tx.spends, conflicts);
+}
+
+// private (requires lock)
+// The template is copied (it is shared) and extended with a new sequence.
+void block_templates::append(const template_tx::cptr& tx) NOEXCEPT
+{
+    const auto out = std::make_shared<block_template>(*current_);
+    out->transactions.push_back(tx);
+    out->fees += tx->fee;
+    out->weight += tx->weight;
+    out->sigops += tx->sigops;
+    out->coinbase_value += tx->fee;
+    out->witness_commitment = commitment(out->transactions);
+    out->sequence = ++sequence_;
+    current_ = out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
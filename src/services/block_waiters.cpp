@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/block_waiters.hpp>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+block_waiters::block_waiters() NOEXCEPT
+{
+}
+
+bool block_waiters::wait_height(key& out, size_t height,
+    handler&& complete) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    waiter value{ kind::height, height, {}, std::move(complete) };
+    if (is_satisfied(value))
+        return false;
+
+    out = park(std::move(value));
+    return true;
+}
+
+bool block_waiters::wait_hash(key& out, const hash_digest& hash,
+    handler&& complete) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    waiter value{ kind::hash, {}, hash, std::move(complete) };
+    if (is_satisfied(value))
+        return false;
+
+    out = park(std::move(value));
+    return true;
+}
+
+bool block_waiters::wait_change(key& out, const hash_digest& top,
+    handler&& complete) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    waiter value{ kind::change, {}, top, std::move(complete) };
+    if (is_satisfied(value))
+        return false;
+
+    out = park(std::move(value));
+    return true;
+}
+
+bool block_waiters::cancel(key id) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    const auto it = waiters_.find(id);
+    if (it == waiters_.end())
+        return false;
+
+    unindex(id, it->second);
+    waiters_.erase(it);
+    return true;
+}
+
+void block_waiters::notify(const node::query& query,
+    node::header_t link) NOEXCEPT
+{
+    std::vector<hash_digest> parked{};
+    {
+        std::unique_lock lock{ mutex_ };
+        if (notified_ && link_ == link)
+            return;
+
+        for (auto it = hashes_.begin(); it != hashes_.end();
+            it = hashes_.equal_range(it->first).second)
+            parked.push_back(it->first);
+    }
+
+    // Store reads are outside of the lock, once per link per notifier.
+    size_t height{};
+    if (!query.get_height(height, link))
+        return;
+
+    const auto hash = query.get_header_key(link);
+    std::erase_if(parked, [&](const auto& value) NOEXCEPT
+    {
+        return value == hash || !is_confirmed(query, value);
+    });
+    std::vector<handler> released{};
+    {
+        std::unique_lock lock{ mutex_ };
+        if (notified_ && link_ == link)
+            return;
+
+        notified_ = true;
+        link_ = link;
+        top_height_ = height;
+        top_hash_ = hash;
+
+        std::vector<key> ids{};
+        const auto last = heights_.upper_bound(height);
+        for (auto it = heights_.begin(); it != last; ++it)
+            ids.push_back(it->second);
+
+        const auto [first, end] = hashes_.equal_range(hash);
+        for (auto it = first; it != end; ++it)
+            ids.push_back(it->second);
+
+        for (const auto& confirmed: parked)
+        {
+            const auto [from, to] = hashes_.equal_range(confirmed);
+            for (auto it = from; it != to; ++it)
+                ids.push_back(it->second);
+        }
+
+        for (const auto& [id, prior]: changes_)
+            if (prior != hash)
+                ids.push_back(id);
+
+        released.reserve(ids.size());
+        for (const auto id: ids)
+        {
+            auto it = waiters_.find(id);
+            unindex(id, it->second);
+            released.push_back(std::move(it->second.complete));
+            waiters_.erase(it);
+        }
+    }
+
+    for (const auto& complete: released)
+        complete(error::success);
+}
+
+bool block_waiters::is_confirmed(const node::query& query,
+    const hash_digest& hash) NOEXCEPT
+{
+    size_t height{};
+    const auto link = query.to_header(hash);
+    return query.get_height(height, link) &&
+        query.to_confirmed(height) == link;
+}
+
+size_t block_waiters::size() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return waiters_.size();
+}
+
+// private (requires lock)
+// ----------------------------------------------------------------------------
+
+bool block_waiters::is_satisfied(const waiter& value) const NOEXCEPT
+{
+    if (!notified_)
+        return false;
+
+    switch (value.type)
+    {
+        case kind::height:
+            return value.height <= top_height_;
+        case kind::hash:
+            return value.hash == top_hash_;
+        case kind::change:
+        default:
+            return value.hash != top_hash_;
+    }
+}
+
+block_waiters::key block_waiters::park(waiter&& value) NOEXCEPT
+{
+    const auto id = ++next_;
+    switch (value.type)
+    {
+        case kind::height:
+            heights_.emplace(value.height, id);
+            break;
+        case kind::hash:
+            hashes_.emplace(value.hash, id);
+            break;
+        case kind::change:
+        default:
+            changes_.emplace(id, value.hash);
+            break;
+    }
+
+    waiters_.emplace(id, std::move(value));
+    return id;
+}
+
+void block_waiters::unindex(key id, const waiter& value) NOEXCEPT
+{
+    switch (value.type)
+    {
+        case kind::height:
+        {
+            const auto [first, last] = heights_.equal_range(value.height);
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->second == id)
+                {
+                    heights_.erase(it);
+                    break;
+                }
+            }
+
+            break;
+        }
+        case kind::hash:
+        {
+            const auto [first, last] = hashes_.equal_range(value.hash);
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->second == id)
+                {
+                    hashes_.erase(it);
+                    break;
+                }
+            }
+
+            break;
+        }
+        case kind::change:
+        default:
+        {
+            changes_.erase(id);
+            break;
+        }
+    }
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
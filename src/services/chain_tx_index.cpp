@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/chain_tx_index.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+chain_tx_index::chain_tx_index() NOEXCEPT
+{
+}
+
+bool chain_tx_index::get(size_t& out, const node::query& query,
+    size_t height) NOEXCEPT
+{
+    if (!ready())
+        return false;
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (is_current(query, height))
+        {
+            out = counts_.at(height);
+            return true;
+        }
+    }
+
+    std::unique_lock lock{ mutex_ };
+    if (!current(query, height))
+        return false;
+
+    out = counts_.at(height);
+    return true;
+}
+
+// Both ends are read under one lock, so that they are of one index state.
+// A current last height implies that all lower heights are current.
+bool chain_tx_index::window(size_t& out, const node::query& query,
+    size_t first, size_t last) NOEXCEPT
+{
+    if (!ready() || first > last)
+        return false;
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (is_current(query, last))
+        {
+            out = counts_.at(last) - counts_.at(first);
+            return true;
+        }
+    }
+
+    std::unique_lock lock{ mutex_ };
+    if (!current(query, last))
+        return false;
+
+    out = counts_.at(last) - counts_.at(first);
+    return true;
+}
+
+// The walk is not locked, as it reads every confirmed height. The result is
+// then adopted under the lock, rewound to any fork point that has since been
+// reorganized and extended through the new top.
+bool chain_tx_index::seed(const node::query& query,
+    const std::atomic_bool& canceled) NOEXCEPT
+{
+    const auto top = query.get_top_confirmed();
+    std::vector<database::header_link> links{};
+    std::vector<uint64_t> counts{};
+    links.reserve(add1(top));
+    counts.reserve(add1(top));
+
+    uint64_t total{};
+    for (size_t height{}; height <= top; ++height)
+    {
+        if (canceled.load(std::memory_order_relaxed))
+            return false;
+
+        const auto link = query.to_confirmed(height);
+        if (link.is_terminal())
+            break;
+
+        total += query.get_tx_count(link);
+        links.push_back(link);
+        counts.push_back(total);
+    }
+
+    std::unique_lock lock{ mutex_ };
+    links_ = std::move(links);
+    counts_ = std::move(counts);
+    ready_.store(true, std::memory_order_release);
+    return extend(query, query.get_top_confirmed());
+}
+
+bool chain_tx_index::update(const node::query& query) NOEXCEPT
+{
+    if (!ready())
+        return false;
+
+    const auto top = query.get_top_confirmed();
+    std::unique_lock lock{ mutex_ };
+    return extend(query, top);
+}
+
+bool chain_tx_index::ready() const NOEXCEPT
+{
+    return ready_.load(std::memory_order_acquire);
+}
+
+size_t chain_tx_index::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return links_.size();
+}
+
+// private (requires lock)
+// ----------------------------------------------------------------------------
+
+bool chain_tx_index::is_current(const node::query& query,
+    size_t height) const NOEXCEPT
+{
+    return height < links_.size() &&
+        links_.at(height) == query.to_confirmed(height);
+}
+
+bool chain_tx_index::current(const node::query& query,
+    size_t height) NOEXCEPT
+{
+    return is_current(query, height) || extend(query, height);
+}
+
+bool chain_tx_index::extend(const node::query& query, size_t height) NOEXCEPT
+{
+    // Rewind to the highest retained height that remains confirmed.
+    while (!links_.empty() && !is_current(query, sub1(links_.size())))
+    {
+        links_.pop_back();
+        counts_.pop_back();
+    }
+
+    // Extend through height, stopping at the first unconfirmed height.
+    while (links_.size() <= height)
+    {
+        const auto link = query.to_confirmed(links_.size());
+        if (link.is_terminal())
+            return false;
+
+        const auto previous = counts_.empty() ? zero : counts_.back();
+        links_.push_back(link);
+        counts_.push_back(previous + query.get_tx_count(link));
+    }
+
+    return true;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/chase_hub.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+struct chase_hub::subscriber
+{
+    handler notify;
+
+    // These are protected by hub mutex.
+    std::array<size_t, types> counts{};
+    std::array<size_t, types> slots{};
+};
+
+chase_hub::subscriber_ptr chase_hub::make(handler&& notify) NOEXCEPT
+{
+    return std::make_shared<subscriber>(subscriber{ std::move(notify) });
+}
+
+chase_hub::events chase_hub::to_events(node::chase event_) NOEXCEPT
+{
+    switch (event_)
+    {
+        case node::chase::organized:
+            return organized;
+        case node::chase::reorganized:
+            return reorganized;
+        case node::chase::block:
+            return block;
+        case node::chase::transaction:
+            return transaction;
+        default:
+            return none;
+    }
+}
+
+void chase_hub::subscribe(const subscriber_ptr& value, events mask) NOEXCEPT
+{
+    if (!value)
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    for (size_t type{}; type < types; ++type)
+        if (to_bool(mask & (1u << type)) && is_zero(value->counts[type]++))
+            insert(type, value);
+}
+
+void chase_hub::unsubscribe(const subscriber_ptr& value, events mask) NOEXCEPT
+{
+    if (!value)
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    for (size_t type{}; type < types; ++type)
+        if (to_bool(mask & (1u << type)) && !is_zero(value->counts[type]) &&
+            is_zero(--value->counts[type]))
+            remove(type, value);
+}
+
+void chase_hub::unsubscribe(const subscriber_ptr& value) NOEXCEPT
+{
+    if (!value)
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    for (size_t type{}; type < types; ++type)
+    {
+        if (!is_zero(value->counts[type]))
+        {
+            value->counts[type] = zero;
+            remove(type, value);
+        }
+    }
+}
+
+void chase_hub::insert(size_t type, const subscriber_ptr& value) NOEXCEPT
+{
+    auto& list = lists_[type];
+    if (list.free.empty())
+    {
+        value->slots[type] = list.slots.size();
+        list.slots.push_back(value);
+    }
+    else
+    {
+        value->slots[type] = list.free.back();
+        list.free.pop_back();
+        list.slots[value->slots[type]] = value;
+    }
+
+    ++list.size;
+    list.changed = true;
+}
+
+void chase_hub::remove(size_t type, const subscriber_ptr& value) NOEXCEPT
+{
+    auto& list = lists_[type];
+    const auto slot = value->slots[type];
+    list.slots[slot].reset();
+    list.free.push_back(slot);
+    --list.size;
+    list.changed = true;
+
+    // The snapshot would otherwise retain the subscriber until next event.
+    list.snapshot.reset();
+}
+
+// Rebuilt only if changed, the prior snapshot remains valid for readers.
+chase_hub::list_ptr chase_hub::snapshot(size_t type) NOEXCEPT
+{
+    auto& list = lists_[type];
+    if (list.changed)
+    {
+        auto next = std::make_shared<chase_hub::list>();
+        next->reserve(list.size);
+        for (const auto& slot: list.slots)
+            if (slot)
+                next->push_back(slot);
+
+        list.snapshot = std::move(next);
+        list.changed = false;
+    }
+
+    return list.snapshot;
+}
+
+void chase_hub::notify(const code& ec, node::chase event_,
+    const node::event_value& value) NOEXCEPT
+{
+    const auto mask = to_events(event_);
+    if (is_zero(mask))
+        return;
+
+    list_ptr subscribers{};
+    {
+        std::unique_lock lock{ mutex_ };
+        subscribers = snapshot(std::countr_zero(mask));
+    }
+
+    if (!subscribers)
+        return;
+
+    // Handlers are invoked outside of the lock, as in node subscription.
+    std::vector<subscriber_ptr> expired{};
+    for (const auto& subscriber: *subscribers)
+        if (!subscriber->notify(ec, event_, value))
+            expired.push_back(subscriber);
+
+    for (const auto& subscriber: expired)
+        unsubscribe(subscriber);
+}
+
+size_t chase_hub::subscribers(node::chase event_) const NOEXCEPT
+{
+    const auto mask = to_events(event_);
+    if (is_zero(mask))
+        return zero;
+
+    std::unique_lock lock{ mutex_ };
+    return lists_[std::countr_zero(mask)].size;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/executor_pools.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+#if defined(HAVE_LINUX)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+struct executor_pools::pool
+{
+    using guard = boost::asio::executor_work_guard<
+        service_t::executor_type>;
+
+    service_t service{};
+    std::optional<guard> work{ service.get_executor() };
+    std::vector<std::thread> threads{};
+};
+
+// Construct.
+// ----------------------------------------------------------------------------
+
+executor_pools::executor_pools(const server::settings& settings,
+    const network::logger& log) NOEXCEPT
+  : network::reporter(log)
+{
+    const auto& pools = settings.pools;
+    const std::pair<std::string, const server::settings::executor&> all[]
+    {
+        { settings.admin.name, pools.admin },
+        { settings.native.name, pools.native },
+        { settings.bitcoind.name, pools.bitcoind },
+        { settings.btcd.name, pools.btcd },
+        { settings.electrum.name, pools.electrum },
+        { settings.stratum_v1.name, pools.stratum_v1 },
+        { settings.stratum_v2.name, pools.stratum_v2 }
+    };
+
+    for (const auto& [name, executor]: all)
+        if (!is_zero(executor.threads))
+            pools_.emplace(name, make_pool(name, executor));
+}
+
+executor_pools::~executor_pools() NOEXCEPT
+{
+    stop();
+}
+
+executor_pools::service_t* executor_pools::find(
+    const std::string& name) const NOEXCEPT
+{
+    const auto it = pools_.find(name);
+    return it == pools_.end() ? nullptr : &it->second->service;
+}
+
+executor_pools::service_t& executor_pools::service(const std::string& name,
+    service_t& fallback) const NOEXCEPT
+{
+    const auto pool = find(name);
+    return is_null(pool) ? fallback : *pool;
+}
+
+// Joining is idempotent, as stopped threads are not joinable.
+void executor_pools::stop() NOEXCEPT
+{
+    for (auto& [name, value]: pools_)
+    {
+        value->work.reset();
+        value->service.stop();
+        for (auto& thread: value->threads)
+            if (thread.joinable() &&
+                thread.get_id() != std::this_thread::get_id())
+                thread.join();
+    }
+}
+
+// private
+std::unique_ptr<executor_pools::pool> executor_pools::make_pool(
+    const std::string& name,
+    const server::settings::executor& settings) NOEXCEPT
+{
+    std::vector<size_t> cpus{};
+    if (!settings.cpus.empty())
+    {
+        // Cpus are validated by the parser.
+        parse_cpus(cpus, settings.cpus);
+    }
+    else if (settings.numa_node >= 0)
+    {
+        cpus = numa_cpus(settings.numa_node);
+        if (cpus.empty())
+            LOGF("Pool [" << name << "] numa node (" << settings.numa_node
+                << ") cpus not found, threads not pinned.");
+    }
+
+    auto out = std::make_unique<pool>();
+    out->threads.reserve(settings.threads);
+    for (size_t thread{}; thread < settings.threads; ++thread)
+    {
+        out->threads.emplace_back([this, &service = out->service, name,
+            cpus]() NOEXCEPT
+        {
+            if (!cpus.empty() && !pin(cpus))
+                LOGF("Pool [" << name << "] thread not pinned to cpus.");
+
+            service.run();
+        });
+    }
+
+    return out;
+}
+
+// Cpus (static).
+// ----------------------------------------------------------------------------
+
+bool executor_pools::parse_cpus(std::vector<size_t>& out,
+    const std::string& text) NOEXCEPT
+{
+    out.clear();
+    for (const auto& token: split(text, ",", true, true))
+    {
+        size_t first{}, last{};
+        const auto range = split(token, "-", true, false);
+        if (range.size() > two ||
+            !deserialize(first, range.front()) ||
+            !deserialize(last, range.back()) || last < first)
+        {
+            out.clear();
+            return false;
+        }
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+            out.push_back(cpu);
+    }
+
+    return !out.empty();
+}
+
+std::vector<size_t> executor_pools::numa_cpus(int32_t node) NOEXCEPT
+{
+#if defined(HAVE_LINUX)
+    std::ifstream file{ "/sys/devices/system/node/node" +
+        std::to_string(node) + "/cpulist" };
+
+    std::string text{};
+    std::vector<size_t> out{};
+    if (node >= 0 && std::getline(file, text))
+        parse_cpus(out, text);
+
+    return out;
+#else
+    return {};
+#endif
+}
+
+bool executor_pools::pin(const std::vector<size_t>& cpus) NOEXCEPT
+{
+#if defined(HAVE_LINUX)
+    cpu_set_t set{};
+    CPU_ZERO(&set);
+    for (const auto cpu: cpus)
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+
+    return is_zero(pthread_setaffinity_np(pthread_self(), sizeof(set), &set));
+#else
+    return false;
+#endif
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/query_deadline.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+query_deadline::timeouts query_deadline::parse(
+    const std::vector<std::string>& entries) NOEXCEPT
+{
+    timeouts out{};
+    for (const auto& entry: entries)
+    {
+        uint32_t milliseconds{};
+        const auto parts = split(entry, ":", true, true);
+        if (parts.size() == two && deserialize(milliseconds, parts.back()))
+            out.insert_or_assign(parts.front(), duration{ milliseconds });
+    }
+
+    return out;
+}
+
+query_deadline::query_deadline(strand_t& strand) NOEXCEPT
+  : strand_(strand),
+    timer_(strand)
+{
+}
+
+void query_deadline::start(const duration& timeout) NOEXCEPT
+{
+    BC_ASSERT(strand_.running_in_this_thread());
+    if (is_zero(timeout.count()))
+        return;
+
+    timer_.expires_after(timeout);
+    timer_.async_wait([self = shared_from_this()](
+        const boost::system::error_code& ec) NOEXCEPT
+    {
+        // Aborted by completion (or by destruction of the service).
+        if (ec)
+            return;
+
+        // Expiry after completion (timer fired before cancel) is ignored.
+        auto expected = state::pending;
+        if (self->state_.compare_exchange_strong(expected, state::expired))
+            self->canceled_.store(true);
+    });
+}
+
+void query_deadline::cancel() NOEXCEPT
+{
+    canceled_.store(true);
+}
+
+code query_deadline::complete(const code& ec) NOEXCEPT
+{
+    completed_.store(true);
+    auto expected = state::pending;
+    if (!state_.compare_exchange_strong(expected, state::completed))
+        return expected == state::expired ? code{ error::query_canceled } : ec;
+
+    // The timer is not thread safe, and completion is off the strand.
+    boost::asio::post(strand_, [self = shared_from_this()]() NOEXCEPT
+    {
+        self->timer_.cancel();
+    });
+
+    return ec;
+}
+
+const std::atomic_bool& query_deadline::canceled() const NOEXCEPT
+{
+    return canceled_;
+}
+
+bool query_deadline::completed() const NOEXCEPT
+{
+    return completed_.load();
+}
+
+bool query_deadline::expired() const NOEXCEPT
+{
+    return state_.load() == state::expired;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
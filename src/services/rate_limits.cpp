@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/rate_limits.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace std::chrono;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Buckets are swept of idle (full) clients as the table grows.
+constexpr size_t minimum_sweep = 1'024;
+
+// rate_limiter
+// ----------------------------------------------------------------------------
+
+rate_limiter::rate_limiter(
+    const server::settings::limiter& settings) NOEXCEPT
+  : rate_(settings.rate),
+    burst_(settings.burst),
+    cost_(settings.cost),
+    query_msecs_(settings.query_msecs),
+    query_rows_(settings.query_rows),
+    costs_(parse_costs(settings)),
+    next_sweep_(minimum_sweep)
+{
+}
+
+double rate_limiter::cost(const std::string_view& method) const NOEXCEPT
+{
+    const auto it = costs_.find(method);
+    return std::min(it == costs_.end() ? cost_ : it->second, burst_);
+}
+
+bool rate_limiter::admit(const std::string& client,
+    const std::string_view& method, clock::time_point now) NOEXCEPT
+{
+    // Free methods are admitted even when the client is in debt.
+    const auto debit = cost(method);
+    if (debit <= 0.0)
+        return true;
+
+    std::unique_lock lock{ mutex_ };
+    auto it = buckets_.find(client);
+    if (it == buckets_.end())
+    {
+        sweep(now);
+        it = buckets_.emplace(client, bucket{ burst_, now }).first;
+    }
+    else
+    {
+        refill(it->second, now);
+    }
+
+    auto& tokens = it->second.tokens;
+    if (tokens < debit)
+        return false;
+
+    tokens -= debit;
+    return true;
+}
+
+void rate_limiter::charge(const std::string& client, size_t rows,
+    const clock::duration& elapsed) NOEXCEPT
+{
+    double debit{};
+    if (query_msecs_ > 0.0)
+        debit += duration<double, std::milli>(elapsed).count() / query_msecs_;
+
+    if (query_rows_ > 0.0)
+        debit += static_cast<double>(rows) / query_rows_;
+
+    if (debit <= 0.0)
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    const auto it = buckets_.find(client);
+    if (it == buckets_.end())
+        return;
+
+    // Debt is bounded so that a client is not locked out indefinitely.
+    auto& tokens = it->second.tokens;
+    tokens = std::max(tokens - debit, -burst_);
+}
+
+size_t rate_limiter::clients() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return buckets_.size();
+}
+
+// private
+// Tokens may be fractional (e.g. "server.ping:0.25"), but not negative.
+rate_limiter::costs rate_limiter::parse_costs(
+    const server::settings::limiter& settings) NOEXCEPT
+{
+    costs out{};
+    for (const auto& entry: settings.costs)
+    {
+        const auto parts = split(entry, ":", true, true);
+        if (parts.size() != two)
+            continue;
+
+        double tokens{};
+        const auto& text = parts.back();
+        const auto end = std::next(text.data(), text.size());
+        const auto [last, ec] = std::from_chars(text.data(), end, tokens);
+        if (ec == std::errc{} && last == end && std::isfinite(tokens) &&
+            !(tokens < 0.0))
+            out.insert_or_assign(parts.front(), tokens);
+    }
+
+    return out;
+}
+
+// private
+void rate_limiter::refill(bucket& bucket, clock::time_point now) const NOEXCEPT
+{
+    if (now <= bucket.time)
+        return;
+
+    const auto seconds = duration<double>(now - bucket.time).count();
+    bucket.tokens = std::min(bucket.tokens + seconds * rate_, burst_);
+    bucket.time = now;
+}
+
+// private, requires mutex.
+void rate_limiter::sweep(clock::time_point now) NOEXCEPT
+{
+    if (buckets_.size() < next_sweep_)
+        return;
+
+    std::erase_if(buckets_, [&](auto& pair) NOEXCEPT
+    {
+        refill(pair.second, now);
+        return pair.second.tokens >= burst_;
+    });
+
+    next_sweep_ = std::max(minimum_sweep, two * buckets_.size());
+}
+
+// rate_limits
+// ----------------------------------------------------------------------------
+
+rate_limits::rate_limits(const server::settings& settings) NOEXCEPT
+{
+    const auto& limits = settings.limits;
+    const std::pair<std::string, const server::settings::limiter&> all[]
+    {
+        { settings.bitcoind.name, limits.bitcoind },
+        { settings.btcd.name, limits.btcd },
+        { settings.electrum.name, limits.electrum }
+    };
+
+    for (const auto& [name, limiter]: all)
+        if (!is_zero(limiter.rate))
+            limiters_.emplace(name, std::make_unique<rate_limiter>(limiter));
+}
+
+rate_limiter* rate_limits::find(const std::string& name) const NOEXCEPT
+{
+    const auto it = limiters_.find(name);
+    return it == limiters_.end() ? nullptr : it->second.get();
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
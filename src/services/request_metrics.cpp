@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/request_metrics.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace std::chrono;
+
+constexpr auto relaxed = std::memory_order_relaxed;
+using counts = std::array<uint64_t, request_counter::buckets>;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// request_counter
+// ----------------------------------------------------------------------------
+
+size_t request_counter::to_bucket(uint64_t usecs) NOEXCEPT
+{
+    if (usecs < sub_buckets)
+        return usecs;
+
+    // Exponent is at least two, so the shift selects the two bits that follow
+    // the most significant bit (linear sub-bucket within the power of two).
+    const size_t exponent = sub1(std::bit_width(usecs));
+    const size_t sub = (usecs >> (exponent - two)) & sub1(sub_buckets);
+    return std::min(sub_buckets * sub1(exponent) + sub, sub1(buckets));
+}
+
+uint64_t request_counter::to_usecs(size_t bucket) NOEXCEPT
+{
+    if (bucket < sub_buckets)
+        return add1(bucket);
+
+    const auto exponent = add1(bucket / sub_buckets);
+    const auto sub = bucket % sub_buckets;
+    return add1<uint64_t>(sub_buckets + sub) << (exponent - two);
+}
+
+// request_metrics
+// ----------------------------------------------------------------------------
+
+request_metrics::request_metrics() NOEXCEPT
+{
+}
+
+void request_metrics::record(const std::string& interface,
+    const std::string_view& method, const duration& elapsed, size_t bytes,
+    bool error) NOEXCEPT
+{
+    const auto count = duration_cast<microseconds>(elapsed).count();
+    const auto usecs = is_negative(count) ? 0_u64 : to_unsigned(count);
+
+    auto& counter = this->counter(interface, method);
+    counter.requests.fetch_add(one, relaxed);
+    counter.bytes.fetch_add(bytes, relaxed);
+    counter.usecs.fetch_add(usecs, relaxed);
+    counter.histogram[request_counter::to_bucket(usecs)].fetch_add(one,
+        relaxed);
+
+    if (error)
+        counter.errors.fetch_add(one, relaxed);
+}
+
+void request_metrics::fail(const std::string& interface,
+    const std::string_view& method) NOEXCEPT
+{
+    auto& counter = this->counter(interface, method);
+    counter.requests.fetch_add(one, relaxed);
+    counter.errors.fetch_add(one, relaxed);
+}
+
+// The upper bound of the bucket containing the quantile (in permille).
+static uint64_t quantile(const counts& histogram, uint64_t total,
+    uint64_t permille) NOEXCEPT
+{
+    const auto threshold = std::max<uint64_t>(one,
+        ceilinged_divide(total * permille, uint64_t{ 1'000 }));
+
+    uint64_t cumulative{};
+    for (size_t bucket{}; bucket < histogram.size(); ++bucket)
+        if ((cumulative += histogram[bucket]) >= threshold)
+            return request_counter::to_usecs(bucket);
+
+    return {};
+}
+
+request_metrics::summaries request_metrics::aggregate() const NOEXCEPT
+{
+    summaries out{};
+    std::shared_lock lock{ mutex_ };
+    for (const auto& [interface, methods]: interfaces_)
+    {
+        for (const auto& [method, counter]: methods)
+        {
+            uint64_t total{};
+            counts histogram{};
+            size_t top{};
+            for (size_t bucket{}; bucket < histogram.size(); ++bucket)
+            {
+                histogram[bucket] = counter->histogram[bucket].load(relaxed);
+                if (!is_zero(histogram[bucket]))
+                {
+                    total += histogram[bucket];
+                    top = bucket;
+                }
+            }
+
+            out.push_back(
+            {
+                .interface = interface,
+                .method = method,
+                .requests = counter->requests.load(relaxed),
+                .errors = counter->errors.load(relaxed),
+                .bytes = counter->bytes.load(relaxed),
+                .usecs = counter->usecs.load(relaxed),
+                .samples = total,
+                .p50_usecs = quantile(histogram, total, 500),
+                .p90_usecs = quantile(histogram, total, 900),
+                .p99_usecs = quantile(histogram, total, 990),
+                .maximum_usecs = is_zero(total) ? 0_u64 :
+                    request_counter::to_usecs(top)
+            });
+        }
+    }
+
+    return out;
+}
+
+// private
+request_counter& request_metrics::counter(const std::string& interface,
+    const std::string_view& method) NOEXCEPT
+{
+    {
+        std::shared_lock lock{ mutex_ };
+        const auto methods = interfaces_.find(interface);
+        if (methods != interfaces_.end())
+        {
+            const auto it = methods->second.find(method);
+            if (it != methods->second.end())
+                return *it->second;
+        }
+    }
+
+    // Counters are never removed, so the reference remains valid.
+    std::unique_lock lock{ mutex_ };
+    auto& counter = interfaces_[interface][std::string{ method }];
+    if (!counter)
+        counter = std::make_shared<request_counter>();
+
+    return *counter;
+}
+
+// Prometheus (static).
+// ----------------------------------------------------------------------------
+
+constexpr auto metric_prefix = "libbitcoin_server_";
+
+static std::string to_seconds(uint64_t usecs) NOEXCEPT
+{
+    constexpr auto micro = 1'000'000_u64;
+    auto fraction = std::to_string(usecs % micro);
+    fraction.insert(0, 6u - fraction.size(), '0');
+    return std::to_string(usecs / micro) + "." + fraction;
+}
+
+static std::string to_labels(const request_summary& summary) NOEXCEPT
+{
+    // Interface and method names are ascii tokens (no escapes required).
+    return "interface=\"" + summary.interface + "\",method=\"" +
+        summary.method + "\"";
+}
+
+static void append_counter(std::string& out, const std::string& name,
+    const std::string& help, const request_metrics::summaries& summaries,
+    uint64_t request_summary::*member) NOEXCEPT
+{
+    const auto metric = metric_prefix + name;
+    out += "# HELP " + metric + " " + help + "\n";
+    out += "# TYPE " + metric + " counter\n";
+    for (const auto& summary: summaries)
+        out += metric + "{" + to_labels(summary) + "} " +
+            std::to_string(summary.*member) + "\n";
+}
+
+std::string request_metrics::to_prometheus(
+    const summaries& summaries) NOEXCEPT
+{
+    std::string out{};
+    append_counter(out, "requests_total",
+        "Completed requests by interface method.", summaries,
+        &request_summary::requests);
+    append_counter(out, "request_errors_total",
+        "Completed requests with error responses.", summaries,
+        &request_summary::errors);
+    append_counter(out, "response_bytes_total",
+        "Response bytes (approximate) by interface method.", summaries,
+        &request_summary::bytes);
+
+    const auto metric = std::string{ metric_prefix } + "request_seconds";
+    out += "# HELP " + metric + " Request latency by interface method.\n";
+    out += "# TYPE " + metric + " summary\n";
+    for (const auto& summary: summaries)
+    {
+        const auto labels = to_labels(summary);
+        out += metric + "{" + labels + ",quantile=\"0.5\"} " +
+            to_seconds(summary.p50_usecs) + "\n";
+        out += metric + "{" + labels + ",quantile=\"0.9\"} " +
+            to_seconds(summary.p90_usecs) + "\n";
+        out += metric + "{" + labels + ",quantile=\"0.99\"} " +
+            to_seconds(summary.p99_usecs) + "\n";
+        out += metric + "_sum{" + labels + "} " +
+            to_seconds(summary.usecs) + "\n";
+        out += metric + "_count{" + labels + "} " +
+            std::to_string(summary.samples) + "\n";
+    }
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
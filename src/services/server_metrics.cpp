@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/server_metrics.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/events.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace node;
+
+constexpr auto relaxed = std::memory_order_relaxed;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Event names (also of the console event log, where padded).
+static const std::unordered_map<uint8_t, std::string> names
+{
+    { events::header_archived, "header_archived" },
+    { events::header_organized, "header_organized" },
+    { events::header_reorganized, "header_reorganized" },
+
+    { events::block_archived, "block_archived" },
+    { events::block_buffered, "block_buffered" },
+    { events::block_validated, "block_validated" },
+    { events::block_confirmed, "block_confirmed" },
+    { events::block_unconfirmable, "block_unconfirmable" },
+    { events::validate_bypassed, "validate_bypassed" },
+    { events::confirm_bypassed, "confirm_bypassed" },
+
+    { events::tx_archived, "tx_archived" },
+    { events::tx_validated, "tx_validated" },
+    { events::tx_invalidated, "tx_invalidated" },
+
+    { events::block_organized, "block_organized" },
+    { events::block_reorganized, "block_reorganized" },
+
+    { events::template_issued, "template_issued" },
+
+    { events::snapshot_secs, "snapshot_secs" },
+    { events::prune_msecs, "prune_msecs" },
+    { events::reload_msecs, "reload_msecs" },
+    { events::block_usecs, "block_usecs" },
+    { events::ancestry_msecs, "ancestry_msecs" },
+    { events::filter_msecs, "filter_msecs" },
+    { events::filterhashes_msecs, "filterhashes_msecs" },
+    { events::filterchecks_msecs, "filterchecks_msecs" },
+    { events::ecdsa_secs, "ecdsa_secs" },
+    { events::schnorr_secs, "schnorr_secs" },
+    { events::silent_secs, "silent_secs" },
+
+    { server_events::admin_start_msecs, "admin_start_msecs" },
+    { server_events::native_start_msecs, "native_start_msecs" },
+    { server_events::bitcoind_start_msecs, "bitcoind_start_msecs" },
+    { server_events::btcd_start_msecs, "btcd_start_msecs" },
+    { server_events::electrum_start_msecs, "electrum_start_msecs" },
+    { server_events::stratum1_start_msecs, "stratum1_start_msecs" },
+    { server_events::stratum2_start_msecs, "stratum2_start_msecs" },
+    { server_events::sessions_start_msecs, "sessions_start_msecs" }
+};
+
+// Construct.
+// ----------------------------------------------------------------------------
+
+server_metrics::server_metrics(const server::settings& settings) NOEXCEPT
+{
+    for (const auto& name:
+    {
+        settings.admin.name,
+        settings.native.name,
+        settings.bitcoind.name,
+        settings.btcd.name,
+        settings.electrum.name,
+        settings.stratum_v1.name,
+        settings.stratum_v2.name
+    })
+        accepts_.try_emplace(name);
+}
+
+// Counters.
+// ----------------------------------------------------------------------------
+
+void server_metrics::fire(uint8_t event_, uint64_t value) NOEXCEPT
+{
+    if (event_ >= limit || !names.contains(event_))
+        return;
+
+    auto& counter = events_[event_];
+    counter.count.fetch_add(one, relaxed);
+    counter.value.store(value, relaxed);
+    counter.total.fetch_add(value, relaxed);
+}
+
+void server_metrics::accept(const std::string& interface) NOEXCEPT
+{
+    const auto it = accepts_.find(interface);
+    if (it != accepts_.end())
+        it->second.fetch_add(one, relaxed);
+}
+
+std::vector<server_metrics::event_summary>
+server_metrics::events() const NOEXCEPT
+{
+    std::vector<event_summary> out{};
+    for (size_t event_{}; event_ < limit; ++event_)
+    {
+        const auto& counter = events_[event_];
+        const auto count = counter.count.load(relaxed);
+        if (is_zero(count))
+            continue;
+
+        out.push_back(
+        {
+            .name = to_name(narrow_cast<uint8_t>(event_)),
+            .count = count,
+            .value = counter.value.load(relaxed),
+            .total = counter.total.load(relaxed)
+        });
+    }
+
+    return out;
+}
+
+std::vector<server_metrics::connection_summary>
+server_metrics::connections() const NOEXCEPT
+{
+    std::vector<connection_summary> out{};
+    out.reserve(accepts_.size());
+    for (const auto& [interface, accepted]: accepts_)
+        out.push_back({ interface, accepted.load(relaxed) });
+
+    return out;
+}
+
+// static
+std::string server_metrics::to_name(uint8_t event_) NOEXCEPT
+{
+    const auto it = names.find(event_);
+    return it == names.end() ? std::string{} : it->second;
+}
+
+// Prometheus.
+// ----------------------------------------------------------------------------
+
+static void append_family(std::string& out, const std::string& metric,
+    const std::string& type, const std::string& help) NOEXCEPT
+{
+    out += "# HELP " + metric + " " + help + "\n";
+    out += "# TYPE " + metric + " " + type + "\n";
+}
+
+std::string server_metrics::to_prometheus() const NOEXCEPT
+{
+    std::string out{};
+    const auto fired = events();
+
+    // The latest value is a duration for timing events (units named).
+    constexpr auto events_total = "libbitcoin_server_events_total";
+    append_family(out, events_total, "counter", "Fired node events.");
+    for (const auto& event_: fired)
+        out += std::string{ events_total } + "{event=\"" + event_.name +
+            "\"} " + std::to_string(event_.count) + "\n";
+
+    constexpr auto event_value = "libbitcoin_server_event_value";
+    append_family(out, event_value, "gauge", "Latest node event value.");
+    for (const auto& event_: fired)
+        out += std::string{ event_value } + "{event=\"" + event_.name +
+            "\"} " + std::to_string(event_.value) + "\n";
+
+    constexpr auto event_total = "libbitcoin_server_event_value_total";
+    append_family(out, event_total, "counter", "Sum of node event values.");
+    for (const auto& event_: fired)
+        out += std::string{ event_total } + "{event=\"" + event_.name +
+            "\"} " + std::to_string(event_.total) + "\n";
+
+    constexpr auto accepted = "libbitcoin_server_connections_accepted_total";
+    append_family(out, accepted, "counter",
+        "Accepted connections by interface.");
+    for (const auto& connection: connections())
+        out += std::string{ accepted } + "{interface=\"" +
+            connection.interface + "\"} " +
+            std::to_string(connection.accepted) + "\n";
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/share_validator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+share_validator::share_validator(size_t maximum,
+    size_t concurrency) NOEXCEPT
+  : maximum_(maximum),
+    concurrency_(std::max(concurrency, one))
+{
+}
+
+bool share_validator::enqueue(bool& drain, stratum_share&& share) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    if (pending_.size() >= maximum_)
+    {
+        drain = false;
+        return false;
+    }
+
+    pending_.push_back(std::move(share));
+    drain = draining_ < concurrency_;
+    if (drain)
+        ++draining_;
+
+    return true;
+}
+
+void share_validator::drain() NOEXCEPT
+{
+    std::vector<stratum_share> shares{};
+    shares.reserve(chunk);
+    while (true)
+    {
+        {
+            std::unique_lock lock{ mutex_ };
+            if (pending_.empty())
+            {
+                --draining_;
+                return;
+            }
+
+            const auto count = std::min(chunk, pending_.size());
+            const auto end = std::next(pending_.begin(), count);
+            shares.assign(std::make_move_iterator(pending_.begin()),
+                std::make_move_iterator(end));
+            pending_.erase(pending_.begin(), end);
+        }
+
+        for (const auto& share: shares)
+            validate(share);
+
+        shares.clear();
+    }
+}
+
+void share_validator::validate(const stratum_share& share) NOEXCEPT
+{
+    const auto& job = *share.job;
+    const auto txid = stratum_jobs::coinbase_hash(job, share.prefix,
+        share.extranonce2);
+    const auto header = stratum_jobs::header(job, txid, share.time,
+        share.nonce);
+    const auto hash = bitcoin_hash(header);
+    const auto value = to_uintx(hash);
+    if (value > stratum_jobs::share_target(share.difficulty))
+    {
+        share.complete(error::low_difficulty, hash, nullptr);
+        return;
+    }
+
+    // A share that meets the network target is a block.
+    chain::block::cptr block{};
+    if (value <= chain::compact::expand(job.source->bits))
+        block = stratum_jobs::block(job, header, stratum_jobs::coinbase(job,
+            share.extranonce1, share.extranonce2));
+
+    share.complete(error::success, hash, block);
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
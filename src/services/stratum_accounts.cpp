@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/stratum_accounts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace std::chrono;
+constexpr auto relaxed = std::memory_order_relaxed;
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+stratum_accounts::stratum_accounts(size_t maximum) NOEXCEPT
+  : maximum_(maximum), aggregated_(clock::now())
+{
+}
+
+share_counter::ptr stratum_accounts::counter(const std::string& worker) NOEXCEPT
+{
+    {
+        std::shared_lock lock{ mutex_ };
+        if (const auto it = accounts_.find(worker); it != accounts_.end())
+            return it->second.counter;
+    }
+
+    std::unique_lock lock{ mutex_ };
+    if (const auto it = accounts_.find(worker); it != accounts_.end())
+        return it->second.counter;
+
+    // An account held only by the map is not authorized by any channel.
+    if (accounts_.size() >= maximum_)
+        std::erase_if(accounts_, [](const auto& item) NOEXCEPT
+        {
+            return item.second.counter.use_count() == one;
+        });
+
+    if (accounts_.size() >= maximum_)
+        return {};
+
+    auto& value = accounts_[worker];
+    value.counter = std::make_shared<share_counter>();
+    return value.counter;
+}
+
+size_t stratum_accounts::size() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return accounts_.size();
+}
+
+std::vector<share_summary> stratum_accounts::aggregate(
+    clock::time_point now) NOEXCEPT
+{
+    std::vector<share_summary> out{};
+    std::unique_lock lock{ mutex_ };
+    out.reserve(accounts_.size());
+
+    const auto elapsed = duration_cast<seconds>(now - aggregated_);
+    const auto roll = elapsed >= window;
+    if (roll)
+        aggregated_ = now;
+
+    for (auto& [worker, value]: accounts_)
+    {
+        const auto& counter = *value.counter;
+        const auto accepted = counter.accepted.load(relaxed);
+        if (roll)
+        {
+            value.rate = (accepted - value.accepted) * 60.0 / elapsed.count();
+            value.accepted = accepted;
+        }
+
+        out.push_back(
+        {
+            worker,
+            accepted,
+            counter.rejected.load(relaxed),
+            counter.stale.load(relaxed),
+            counter.work.load(relaxed),
+            counter.blocks.load(relaxed),
+            value.rate
+        });
+    }
+
+    std::ranges::sort(out, {}, &share_summary::worker);
+    return out;
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,401 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/stratum_jobs.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+#include <bitcoin/server/parsers/bitcoind_script.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace system;
+using namespace network::rpc;
+
+constexpr uint32_t coinbase_version = 1;
+constexpr uint32_t difficulty_one_bits = 0x1d00ffff;
+constexpr size_t minimum_extranonce2 = 1;
+constexpr size_t maximum_extranonce2 = 8;
+constexpr data_array<6> commitment_prefix{ 0x6a, 0x24, 0xaa, 0x21, 0xa9, 0xed };
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Utilities.
+// ----------------------------------------------------------------------------
+
+static void append(data_chunk& out, const data_slice& bytes) NOEXCEPT
+{
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+// Coinbase counts and script sizes are always single byte varints.
+static void append_size(data_chunk& out, size_t size) NOEXCEPT
+{
+    BC_ASSERT(size < varint_two_bytes);
+    out.push_back(narrow_cast<uint8_t>(size));
+}
+
+// Block transaction counts may exceed a single byte varint.
+static void append_count(data_chunk& out, size_t count) NOEXCEPT
+{
+    if (count < varint_two_bytes)
+    {
+        append_size(out, count);
+    }
+    else if (count <= max_uint16)
+    {
+        out.push_back(varint_two_bytes);
+        append(out, to_little_endian(narrow_cast<uint16_t>(count)));
+    }
+    else
+    {
+        out.push_back(varint_four_bytes);
+        append(out, to_little_endian(possible_narrow_cast<uint32_t>(count)));
+    }
+}
+
+// bip34 height push (minimal script number, as bitcoind).
+static data_chunk height_push(size_t height) NOEXCEPT
+{
+    if (is_zero(height))
+        return { 0x00 };
+
+    if (height <= 16u)
+        return { narrow_cast<uint8_t>(0x50u + height) };
+
+    data_chunk number{};
+    for (auto value = height; !is_zero(value); value >>= byte_bits)
+        number.push_back(narrow_cast<uint8_t>(value & 0xffu));
+
+    // A set high bit would imply a negative number.
+    if (get_right(number.back(), sub1(byte_bits)))
+        number.push_back(0x00);
+
+    data_chunk out{ narrow_cast<uint8_t>(number.size()) };
+    append(out, number);
+    return out;
+}
+
+static data_chunk to_payout(const server::settings& settings) NOEXCEPT
+{
+    chain::script script{};
+    const auto& wallet = settings.wallet;
+    const auto& address = settings.stratum_v1.payout_address;
+    if (address.empty() || output_script(script, address,
+        wallet.p2kh_prefix, wallet.p2sh_prefix, wallet.witness_prefix))
+        return {};
+
+    return script.to_data(false);
+}
+
+// Construct.
+// ----------------------------------------------------------------------------
+
+stratum_jobs::stratum_jobs(const server::settings& settings) NOEXCEPT
+  : payout_(to_payout(settings)),
+    extranonce2_size_(std::clamp<size_t>(
+        settings.stratum_v1.extranonce2_size, minimum_extranonce2,
+        maximum_extranonce2))
+{
+}
+
+bool stratum_jobs::enabled() const NOEXCEPT
+{
+    return !payout_.empty();
+}
+
+size_t stratum_jobs::extranonce2_size() const NOEXCEPT
+{
+    return extranonce2_size_;
+}
+
+uint32_t stratum_jobs::extranonce1() NOEXCEPT
+{
+    return extranonce1_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Jobs.
+// ----------------------------------------------------------------------------
+
+stratum_job::cptr stratum_jobs::update(
+    const block_template::cptr& source) NOEXCEPT
+{
+    if (!enabled() || !source)
+        return {};
+
+    {
+        std::shared_lock lock{ mutex_ };
+        if (current_ && current_->source == source)
+            return current_;
+    }
+
+    // Conversion is cheap (no store reads), so it is performed under lock.
+    std::unique_lock lock{ mutex_ };
+    if (current_ && current_->source == source)
+        return current_;
+
+    if (current_)
+    {
+        recent_.push_front(current_);
+        if (recent_.size() > history)
+            recent_.pop_back();
+    }
+
+    current_ = build(source, ++sequence_);
+    return current_;
+}
+
+stratum_job::cptr stratum_jobs::find(const std::string& id) const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    if (current_ && current_->id == id)
+        return current_;
+
+    const auto it = std::ranges::find_if(recent_, [&](const auto& job) NOEXCEPT
+    {
+        return job->id == id;
+    });
+
+    return it == recent_.end() ? nullptr : *it;
+}
+
+// private
+stratum_job::cptr stratum_jobs::build(const block_template::cptr& source,
+    uint64_t sequence) const NOEXCEPT
+{
+    const auto job = std::make_shared<stratum_job>();
+    const auto now = possible_narrow_and_sign_cast<uint32_t>(zulu_time());
+    job->id = encode_base16(to_big_endian(
+        possible_narrow_cast<uint32_t>(sequence)));
+    job->source = source;
+    job->time = std::max(now, source->mintime);
+
+    // Version, one null input, script size, height push [extranonces].
+    const auto push = height_push(source->height);
+    auto& coinb1 = job->coinb1;
+    append(coinb1, to_little_endian(coinbase_version));
+    append_size(coinb1, one);
+    append(coinb1, null_hash);
+    append(coinb1, to_little_endian(max_uint32));
+    append_size(coinb1, push.size() + sizeof(uint32_t) + extranonce2_size_);
+    append(coinb1, push);
+
+    // [extranonces] sequence, payout (and commitment) outputs, locktime.
+    auto& coinb2 = job->coinb2;
+    append(coinb2, to_little_endian(max_uint32));
+    append_size(coinb2, source->segwit ? two : one);
+    append(coinb2, to_little_endian(source->coinbase_value));
+    append_size(coinb2, payout_.size());
+    append(coinb2, payout_);
+    if (source->segwit)
+    {
+        append(coinb2, to_little_endian(uint64_t{}));
+        append_size(coinb2, commitment_prefix.size() + hash_size);
+        append(coinb2, commitment_prefix);
+        append(coinb2, source->witness_commitment);
+    }
+
+    append(coinb2, to_little_endian(uint32_t{}));
+
+    hashes txids{};
+    txids.reserve(source->transactions.size());
+    for (const auto& tx: source->transactions)
+        txids.push_back(tx->txid);
+
+    job->branch = merkle_branch(txids);
+
+    array_t branch{};
+    for (const auto& hash: job->branch)
+        branch.emplace_back(encode_base16(hash));
+
+    const request_t notify
+    {
+        .jsonrpc = version::v1,
+        .id = null_t{},
+        .method = "mining.notify",
+        .params = params_t
+        {
+            array_t
+            {
+                job->id,
+                to_prevhash(source->previous),
+                encode_base16(job->coinb1),
+                encode_base16(job->coinb2),
+                std::move(branch),
+                encode_base16(to_big_endian(source->version)),
+                encode_base16(to_big_endian(source->bits)),
+                encode_base16(to_big_endian(job->time)),
+                true
+            }
+        }
+    };
+
+    job->notification = boost::json::serialize(boost::json::value_from(notify));
+    job->notification.push_back('\n');
+    return job;
+}
+
+// Shares (static).
+// ----------------------------------------------------------------------------
+
+stratum_jobs::midstate stratum_jobs::prefix(const stratum_job& job,
+    uint32_t extranonce1) NOEXCEPT
+{
+    midstate out{};
+    out.write(job.coinb1);
+    out.write(to_big_endian(extranonce1));
+    return out;
+}
+
+hash_digest stratum_jobs::coinbase_hash(const stratum_job& job,
+    const midstate& prefix, const data_chunk& extranonce2) NOEXCEPT
+{
+    auto copy = prefix;
+    copy.write(extranonce2);
+    copy.write(job.coinb2);
+    return sha256_hash(copy.flush());
+}
+
+data_chunk stratum_jobs::coinbase(const stratum_job& job,
+    uint32_t extranonce1, const data_chunk& extranonce2) NOEXCEPT
+{
+    data_chunk out{};
+    out.reserve(job.coinb1.size() + sizeof(uint32_t) + extranonce2.size() +
+        job.coinb2.size());
+    append(out, job.coinb1);
+    append(out, to_big_endian(extranonce1));
+    append(out, extranonce2);
+    append(out, job.coinb2);
+    return out;
+}
+
+data_chunk stratum_jobs::header(const stratum_job& job,
+    const hash_digest& coinbase_hash, uint32_t time, uint32_t nonce) NOEXCEPT
+{
+    data_chunk out{};
+    out.reserve(chain::header::serialized_size());
+    append(out, to_little_endian(job.source->version));
+    append(out, job.source->previous);
+    append(out, merkle_root(coinbase_hash, job.branch));
+    append(out, to_little_endian(time));
+    append(out, to_little_endian(job.source->bits));
+    append(out, to_little_endian(nonce));
+    return out;
+}
+
+chain::block::cptr stratum_jobs::block(const stratum_job& job,
+    const data_chunk& header, const data_chunk& coinbase) NOEXCEPT
+{
+    const auto& txs = job.source->transactions;
+    auto size = header.size() + coinbase.size() + 64u;
+    for (const auto& tx: txs)
+        size += tx->data.size();
+
+    data_chunk out{};
+    out.reserve(size);
+    append(out, header);
+    append_count(out, add1(txs.size()));
+
+    if (job.source->segwit)
+    {
+        // Marker and flag follow the version, and the single witness element
+        // (the null reserved value) precedes the locktime.
+        const auto body = std::next(coinbase.begin(), sizeof(uint32_t));
+        const auto tail = std::prev(coinbase.end(), sizeof(uint32_t));
+        out.insert(out.end(), coinbase.begin(), body);
+        out.push_back(0x00);
+        out.push_back(0x01);
+        out.insert(out.end(), body, tail);
+        append_size(out, one);
+        append_size(out, hash_size);
+        append(out, null_hash);
+        out.insert(out.end(), tail, coinbase.end());
+    }
+    else
+    {
+        append(out, coinbase);
+    }
+
+    for (const auto& tx: txs)
+        append(out, tx->data);
+
+    const auto block = to_shared<chain::block>(out, true);
+    return block->is_valid() ? block : nullptr;
+}
+
+hashes stratum_jobs::merkle_branch(const hashes& txids) NOEXCEPT
+{
+    // The first element of each level is on the (unknown) coinbase path.
+    hashes branch{};
+    hashes level{ null_hash };
+    level.insert(level.end(), txids.begin(), txids.end());
+
+    while (level.size() > one)
+    {
+        branch.push_back(level.at(one));
+        if (is_odd(level.size()))
+            level.push_back(level.back());
+
+        hashes next{ null_hash };
+        for (auto index = two; index < level.size(); index += two)
+            next.push_back(bitcoin_hash(splice(level.at(index),
+                level.at(add1(index)))));
+
+        level = std::move(next);
+    }
+
+    return branch;
+}
+
+hash_digest stratum_jobs::merkle_root(const hash_digest& coinbase,
+    const hashes& branch) NOEXCEPT
+{
+    auto root = coinbase;
+    for (const auto& hash: branch)
+        root = bitcoin_hash(splice(root, hash));
+
+    return root;
+}
+
+uint256_t stratum_jobs::share_target(uint32_t difficulty) NOEXCEPT
+{
+    return chain::compact::expand(difficulty_one_bits) /
+        uint256_t{ std::max(difficulty, 1_u32) };
+}
+
+std::string stratum_jobs::to_prevhash(const hash_digest& hash) NOEXCEPT
+{
+    auto words = hash;
+    for (auto it = words.begin(); it != words.end();
+        std::advance(it, sizeof(uint32_t)))
+        std::reverse(it, std::next(it, sizeof(uint32_t)));
+
+    return encode_base16(words);
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
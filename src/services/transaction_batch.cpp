@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/transaction_batch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+transaction_batch::transaction_batch(const duration& window,
+    size_t maximum) NOEXCEPT
+  : window_(window), maximum_(std::max(maximum, one))
+{
+}
+
+std::optional<transaction_batch::duration> transaction_batch::push(
+    node::transaction_t link) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    pending_.push_back(link);
+
+    if (pending_.size() == maximum_)
+        return duration::zero();
+
+    if (is_one(pending_.size()))
+        return window_;
+
+    return {};
+}
+
+transaction_batch::links transaction_batch::pop() NOEXCEPT
+{
+    links out{};
+    std::unique_lock lock{ mutex_ };
+    std::swap(out, pending_);
+    return out;
+}
+
+size_t transaction_batch::size() const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    return pending_.size();
+}
+
+void transaction_batch::schedule(network::asio::strand& strand,
+    const duration& delay, handler&& drain) NOEXCEPT
+{
+    if (is_zero(delay.count()))
+    {
+        boost::asio::post(strand, std::move(drain));
+        return;
+    }
+
+    // The timer is retained by its own completion handler.
+    const auto timer = std::make_shared<boost::asio::steady_timer>(strand,
+        delay);
+    timer->async_wait([timer, drain = std::move(drain)](
+        const boost::system::error_code&) NOEXCEPT
+    {
+        drain();
+    });
+}
+
+BC_POP_WARNING()
+
+} // namespace server
+} // namespace libbitcoin
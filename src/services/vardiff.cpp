@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/server/services/vardiff.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <bitcoin/server/define.hpp>
+
+namespace libbitcoin {
+namespace server {
+
+using namespace std::chrono;
+
+vardiff::vardiff(const server::settings::stratum_v1_server& settings,
+    clock::time_point now) NOEXCEPT
+  : rate_(settings.share_rate),
+    maximum_(std::max(settings.maximum_difficulty, 1_u32)),
+    interval_(seconds(settings.retarget_seconds)),
+    difficulty_(std::clamp(settings.share_difficulty, 1_u32, maximum_)),
+    start_(now)
+{
+}
+
+bool vardiff::enabled() const NOEXCEPT
+{
+    return !is_zero(rate_) && interval_ != clock::duration::zero();
+}
+
+uint32_t vardiff::difficulty() const NOEXCEPT
+{
+    return difficulty_;
+}
+
+bool vardiff::accept(clock::time_point now) NOEXCEPT
+{
+    if (!enabled())
+        return false;
+
+    // Shares expected over a full interval, reached early by a fast miner.
+    ++shares_;
+    const auto minutes = duration<double, std::ratio<60>>(interval_).count();
+    if (shares_ >= rate_ * minutes)
+        return update(now);
+
+    return retarget(now);
+}
+
+bool vardiff::retarget(clock::time_point now) NOEXCEPT
+{
+    if (!enabled() || (now - start_) < interval_)
+        return false;
+
+    return update(now);
+}
+
+// private
+bool vardiff::update(clock::time_point now) NOEXCEPT
+{
+    const auto elapsed = duration<double, std::ratio<60>>(now - start_);
+    const auto shares = shares_;
+    start_ = now;
+    shares_ = zero;
+
+    if (elapsed.count() <= 0.0)
+        return false;
+
+    // No shares over an interval lowers by the maximum factor.
+    const auto current = static_cast<double>(difficulty_);
+    const auto ratio = std::clamp(shares / elapsed.count() / rate_,
+        1.0 / factor, factor);
+
+    if (std::abs(ratio - 1.0) <= tolerance)
+        return false;
+
+    const auto target = std::clamp(std::round(current * ratio), 1.0,
+        static_cast<double>(maximum_));
+    const auto next = static_cast<uint32_t>(target);
+    if (next == difficulty_)
+        return false;
+
+    difficulty_ = next;
+    return true;
+}
+
+} // namespace server
+} // namespace libbitcoin
@@ -41,6 +41,12 @@ BOOST_AUTO_TEST_CASE(configuration__construct1__none_context__expected)
     BOOST_REQUIRE(!instance.slabs);
     BOOST_REQUIRE(!instance.buckets);
     BOOST_REQUIRE(!instance.collisions);
+    BOOST_REQUIRE_EQUAL(instance.scan_threads, 0u);
+    BOOST_REQUIRE_EQUAL(instance.scan_memory, 4096u);
+    BOOST_REQUIRE(instance.bench.empty());
+    BOOST_REQUIRE_EQUAL(instance.bench_threads, 0u);
+    BOOST_REQUIRE_EQUAL(instance.bench_samples, 1000u);
+    BOOST_REQUIRE_EQUAL(instance.bench_format, "text");
     BOOST_REQUIRE_EQUAL(instance.get, system::null_hash);
     BOOST_REQUIRE_EQUAL(instance.put, system::null_hash);
 
@@ -281,4 +281,58 @@ BOOST_AUTO_TEST_CASE(error_t__code__server_error__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "server_error");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__rate_limited__true_expected_message)
+{
+    constexpr auto value = error::rate_limited;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "rate_limited");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__query_canceled__true_expected_message)
+{
+    constexpr auto value = error::query_canceled;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "query_canceled");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__stale_job__true_expected_message)
+{
+    constexpr auto value = error::stale_job;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "stale_job");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__duplicate_share__true_expected_message)
+{
+    constexpr auto value = error::duplicate_share;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "duplicate_share");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__low_difficulty__true_expected_message)
+{
+    constexpr auto value = error::low_difficulty;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "low_difficulty");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__validator_busy__true_expected_message)
+{
+    constexpr auto value = error::validator_busy;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "validator_busy");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
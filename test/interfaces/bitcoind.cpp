@@ -117,11 +117,12 @@ static_assert(bitcoind_blockchain_methods::names ==
     "getbestblockhash getblock getblockchaininfo getblockcount "
     "getblockfilter getblockhash getblockheader getblockstats "
     "getchaintxstats gettxout verifychain gettxoutproof verifytxoutproof "
-    "getchainstates getchaintips getdeploymentinfo getdifficulty");
+    "getchainstates getchaintips getdeploymentinfo getdifficulty "
+    "waitforblock waitforblockheight waitfornewblock");
 static_assert(bitcoind_control_methods::names ==
     "help getmemoryinfo getrpcinfo logging uptime");
 static_assert(bitcoind_mining_methods::names ==
-    "getnetworkhashps getmininginfo");
+    "getnetworkhashps getmininginfo submitblock getblocktemplate");
 static_assert(bitcoind_network_methods::names ==
     "getnetworkinfo getconnectioncount getnettotals");
 static_assert(bitcoind_notifications_methods::names == "getzmqnotifications");
@@ -132,3 +133,37 @@ static_assert(bitcoind_transaction_methods::names ==
 static_assert(bitcoind_utility_methods::names ==
     "decodescript validateaddress createmultisig verifymessage getindexinfo");
 static_assert(bitcoind_wallet_methods::names == "");
+
+// bitcoind_map
+// -----------------------------------------------------------------------------
+
+// Every declared name (served or not) resolves to its own entry.
+template <typename Map>
+constexpr bool resolves() NOEXCEPT
+{
+    for (const auto& entry: Map::table.entries)
+        if (Map::find(entry.name) != &entry)
+            return false;
+
+    return true;
+}
+
+static_assert(resolves<bitcoind_map>());
+
+// Resolved to the declaring subgroup.
+static_assert(bitcoind_map::find("getblockcount")->group ==
+    bitcoind_map::group<bitcoind_blockchain>());
+static_assert(bitcoind_map::contains<bitcoind_blockchain>("getblockcount"));
+static_assert(!bitcoind_map::contains<bitcoind_utility>("getblockcount"));
+static_assert(bitcoind_map::contains<bitcoind_utility>("getindexinfo"));
+static_assert(bitcoind_map::contains<bitcoind_blockchain>("gettxoutsetinfo"));
+
+// Groups are ordinals of the routed subgroups (in template order).
+static_assert(bitcoind_map::groups == 9u);
+static_assert(bitcoind_map::group<bitcoind_wallet>() ==
+    sub1(bitcoind_map::groups));
+
+// A name absent from the interface (or a prefix of one) resolves to none.
+static_assert(is_null(bitcoind_map::find("getcurrentnet")));
+static_assert(is_null(bitcoind_map::find("getblock ")));
+static_assert(is_null(bitcoind_map::find("")));
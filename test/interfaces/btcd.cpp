@@ -76,3 +76,12 @@ static_assert(btcd_methods::names ==
     "notifyblocks stopnotifyblocks "
     "loadtxfilter rescanblocks "
     "rescan");
+
+// btcd_map
+// -----------------------------------------------------------------------------
+
+static_assert(btcd_map::contains<btcd>("authenticate"));
+static_assert(btcd_map::contains<btcd>("rescan"));
+static_assert(btcd_map::contains<btcd>("stopnotifyspent"));
+static_assert(btcd_map::find("notifyblocks")->name == "notifyblocks");
+static_assert(!btcd_map::contains<btcd>("getblockcount"));
@@ -49,7 +49,7 @@ BOOST_AUTO_TEST_CASE(parsers__admin_query__no_supported_media__unknown)
 {
     request_t out{};
     out.params = object_t{};
-    const media_types accepts{ media_type::text_plain };
+    const media_types accepts{ media_type::application_octet_stream };
     BOOST_REQUIRE(admin_query(out, "/", accepts));
     BOOST_REQUIRE_EQUAL(strip_media(out), media_type::unknown);
 }
@@ -107,13 +107,32 @@ BOOST_AUTO_TEST_CASE(parsers__admin_query__query_format_html__html)
     BOOST_REQUIRE_EQUAL(strip_media(out), media_type::text_html);
 }
 
-BOOST_AUTO_TEST_CASE(parsers__admin_query__query_format_text__false)
+BOOST_AUTO_TEST_CASE(parsers__admin_query__query_format_text__text)
 {
-    // Text is not a supported admin format.
+    // Text (metrics exposition) overrides the accept header.
     request_t out{};
     out.params = object_t{};
     const media_types accepts{ media_type::application_json };
-    BOOST_REQUIRE(!admin_query(out, "/?format=text", accepts));
+    BOOST_REQUIRE(admin_query(out, "/?format=text", accepts));
+    BOOST_REQUIRE_EQUAL(strip_media(out), media_type::text_plain);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_query__no_query_accept_text__text)
+{
+    request_t out{};
+    out.params = object_t{};
+    const media_types accepts{ media_type::text_plain };
+    BOOST_REQUIRE(admin_query(out, "/", accepts));
+    BOOST_REQUIRE_EQUAL(strip_media(out), media_type::text_plain);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_query__no_query_accept_priority_html__html)
+{
+    request_t out{};
+    out.params = object_t{};
+    const media_types accepts{ media_type::text_plain, media_type::text_html };
+    BOOST_REQUIRE(admin_query(out, "/", accepts));
+    BOOST_REQUIRE_EQUAL(strip_media(out), media_type::text_html);
 }
 
 BOOST_AUTO_TEST_CASE(parsers__admin_query__query_format_data__false)
@@ -307,7 +326,7 @@ BOOST_AUTO_TEST_CASE(parsers__strip_media__unsupported_value__unknown_not_erased
     request_t model{};
     model.params = object_t{};
     auto& params = std::get<object_t>(model.params.value());
-    params["media"] = value_t{ static_cast<uint8_t>(media_type::text_plain) };
+    params["media"] = value_t{ static_cast<uint8_t>(media_type::application_octet_stream) };
     BOOST_REQUIRE_EQUAL(strip_media(model), media_type::unknown);
     BOOST_REQUIRE(params.find("media") != params.end());
 }
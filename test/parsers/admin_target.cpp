@@ -160,6 +160,61 @@ BOOST_AUTO_TEST_CASE(parsers__admin_target__event_subscribe_extra_segment__extra
     BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/event/subscribe/extra"), server::error::extra_segment);
 }
 
+// stratum/workers
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__stratum_workers_valid__expected)
+{
+    const std::string path = "/v1/stratum/workers";
+
+    request_t request{};
+    BOOST_REQUIRE(!admin_target(request, path));
+    BOOST_REQUIRE_EQUAL(request.method, "stratum_workers");
+
+    const auto& object = std::get<object_t>(request.params.value());
+    BOOST_REQUIRE_EQUAL(object.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__stratum_invalid_subcomponent__invalid_subcomponent)
+{
+    request_t out{};
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/stratum"), server::error::invalid_subcomponent);
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/stratum/invalid"), server::error::invalid_subcomponent);
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/stratum/workers/extra"), server::error::extra_segment);
+}
+
+// metrics/requests
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__request_metrics_valid__expected)
+{
+    const std::string path = "/v1/metrics/requests";
+
+    request_t request{};
+    BOOST_REQUIRE(!admin_target(request, path));
+    BOOST_REQUIRE_EQUAL(request.method, "request_metrics");
+
+    const auto& object = std::get<object_t>(request.params.value());
+    BOOST_REQUIRE_EQUAL(object.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__metrics_valid__expected)
+{
+    const std::string path = "/v1/metrics";
+
+    request_t request{};
+    BOOST_REQUIRE(!admin_target(request, path));
+    BOOST_REQUIRE_EQUAL(request.method, "metrics");
+
+    const auto& object = std::get<object_t>(request.params.value());
+    BOOST_REQUIRE_EQUAL(object.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__admin_target__metrics_invalid_subcomponent__invalid_subcomponent)
+{
+    request_t out{};
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/metrics/invalid"), server::error::invalid_subcomponent);
+    BOOST_REQUIRE_EQUAL(admin_target(out, "/v3/metrics/requests/extra"), server::error::extra_segment);
+}
+
 // Cross-interface targets (native grammar is not admin grammar).
 
 BOOST_AUTO_TEST_CASE(parsers__admin_target__native_target__invalid_target)
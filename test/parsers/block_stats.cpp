@@ -111,4 +111,42 @@ BOOST_AUTO_TEST_CASE(block_stats__repeat__coinbase_excluded_from_actual)
     BOOST_REQUIRE_EQUAL(std::get<int64_t>(stats.at("utxo_increase_actual").value()), 0);
 }
 
+// The summary record reproduces the statistics of the block.
+BOOST_AUTO_TEST_CASE(block_stats__summary__equals_block_stats)
+{
+    const auto block = make_block({ make_coinbase(),
+        make_paying(100'000, 90'000), make_paying(50'000, 48'000) });
+    const auto record = server::block_summary(block, 2, 40, false);
+    const auto expected = server::block_stats(block, 2, 40, test_subsidy, false);
+    const auto stats = server::block_stats(record, block.hash(), test_subsidy);
+
+    BOOST_REQUIRE_EQUAL(record.height, 2u);
+    BOOST_REQUIRE_EQUAL(record.txs, 3u);
+    BOOST_REQUIRE_EQUAL(record.total_fee, 12'000u);
+    BOOST_REQUIRE_EQUAL(stats.size(), expected.size());
+
+    for (const auto name: { "avgfee", "avgfeerate", "avgtxsize", "ins",
+        "maxfee", "maxfeerate", "maxtxsize", "medianfee", "mediantxsize",
+        "minfee", "minfeerate", "mintxsize", "outs", "subsidy", "total_out",
+        "total_size", "total_weight", "totalfee", "txs" })
+    {
+        BOOST_REQUIRE_EQUAL(std::get<uint64_t>(stats.at(name).value()),
+            std::get<uint64_t>(expected.at(name).value()));
+    }
+
+    BOOST_REQUIRE_EQUAL(std::get<network::rpc::string_t>(stats.at("blockhash").value()),
+        std::get<network::rpc::string_t>(expected.at("blockhash").value()));
+}
+
+// Minimums of a coinbase-only block are normalized to zero in the record.
+BOOST_AUTO_TEST_CASE(block_stats__summary_coinbase_only__zero_minimums)
+{
+    const auto record = server::block_summary(make_block({ make_coinbase() }),
+        1, 40, false);
+
+    BOOST_REQUIRE_EQUAL(record.min_fee, 0u);
+    BOOST_REQUIRE_EQUAL(record.min_fee_rate, 0u);
+    BOOST_REQUIRE_EQUAL(record.min_tx_size, 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -304,6 +304,32 @@ BOOST_AUTO_TEST_CASE(parsers__native_query__http_request_overload_with_accept_js
     BOOST_REQUIRE_EQUAL(get_media(out), media_type::application_json);
 }
 
+BOOST_AUTO_TEST_CASE(parsers__native_query__request_defaults__expected)
+{
+    native_request out{};
+    BOOST_REQUIRE(native_query(out, "/v3/top", {}));
+    BOOST_REQUIRE(out.media == media_type::unknown);
+    BOOST_REQUIRE(out.witness);
+    BOOST_REQUIRE(out.turbo);
+    BOOST_REQUIRE(!out.stop);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__native_query__request_percent_encoded__expected)
+{
+    native_request out{};
+    BOOST_REQUIRE(native_query(out, "/v3/top?%74urbo=f%61lse&format=%6Aso%6E#frag", {}));
+    BOOST_REQUIRE(out.media == media_type::application_json);
+    BOOST_REQUIRE(!out.turbo);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__native_query__request_malformed_percent__false)
+{
+    native_request out{};
+    BOOST_REQUIRE(!native_query(out, "/v3/top?turbo=%4", {}));
+    BOOST_REQUIRE(!native_query(out, "/v3/top?turbo=%zz", {}));
+    BOOST_REQUIRE(!native_query(out, "", {}));
+}
+
 BOOST_AUTO_TEST_CASE(parsers__get_media__unknown_no_params__unknown)
 {
     request_t model{};
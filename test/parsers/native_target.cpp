@@ -1491,4 +1491,48 @@ BOOST_AUTO_TEST_CASE(parsers__native_target__block_details_hash_extra_segment__e
     BOOST_REQUIRE_EQUAL(native_target(out, path), server::error::extra_segment);
 }
 
+// native_request
+
+BOOST_AUTO_TEST_CASE(parsers__native_target__request_block_tx_height__expected)
+{
+    native_request request{};
+    BOOST_REQUIRE(!native_target(request, "/v3/block/height/123/tx/7?witness=false"));
+    BOOST_REQUIRE(request.method == native_method::block_tx);
+    BOOST_REQUIRE_EQUAL(request.version, 3u);
+    BOOST_REQUIRE(request.height.has_value());
+    BOOST_REQUIRE_EQUAL(request.height.value(), 123u);
+    BOOST_REQUIRE_EQUAL(request.position, 7u);
+    BOOST_REQUIRE(!request.hash.has_value());
+    BOOST_REQUIRE(request.witness);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__native_target__request_output_subscribe__expected)
+{
+    const std::string path = "/v3/output/0000000000000000000000000000000000000000000000000000000000000042/5/subscribe";
+
+    native_request request{};
+    BOOST_REQUIRE(!native_target(request, path));
+    BOOST_REQUIRE(request.method == native_method::output_subscribe);
+    BOOST_REQUIRE_EQUAL(request.index, 5u);
+    BOOST_REQUIRE(request.hash.has_value());
+    BOOST_REQUIRE_EQUAL(to_uintx(request.hash.value()), uint256_t{ 0x42 });
+}
+
+BOOST_AUTO_TEST_CASE(parsers__native_target__request_errors__expected)
+{
+    native_request request{};
+    BOOST_REQUIRE_EQUAL(native_target(request, ""), server::error::empty_path);
+    BOOST_REQUIRE_EQUAL(native_target(request, "//"), server::error::missing_version);
+    BOOST_REQUIRE_EQUAL(native_target(request, "/v3/tx"), server::error::missing_hash);
+    BOOST_REQUIRE_EQUAL(native_target(request, "/v3/top/extra"), server::error::invalid_subcomponent);
+    BOOST_REQUIRE_EQUAL(native_target(request, "/v3/top/subscribe/extra"), server::error::extra_segment);
+}
+
+BOOST_AUTO_TEST_CASE(parsers__native_target__to_method__interface_names)
+{
+    BOOST_REQUIRE_EQUAL(to_method(native_method::configuration), "configuration");
+    BOOST_REQUIRE_EQUAL(to_method(native_method::block_filter_header), "block_filter_header");
+    BOOST_REQUIRE_EQUAL(to_method(native_method::address_subscribe), "address_subscribe");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
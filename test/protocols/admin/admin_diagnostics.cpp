@@ -248,4 +248,66 @@ BOOST_AUTO_TEST_CASE(admin__ws_event_subscribe__unfiltered_event__not_notified)
     BOOST_REQUIRE_EQUAL(frame.at("value").as_int64(), 2);
 }
 
+// stratum workers (http)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(admin__stratum_workers__no_workers__empty)
+{
+    const auto response = get_json("/v1/stratum/workers?format=json");
+    REQUIRE_NO_THROW_TRUE(response.at("workers").is_array());
+    BOOST_REQUIRE(response.at("workers").as_array().empty());
+}
+
+// request metrics (http)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(admin__request_metrics__json__recorded)
+{
+    // The first request is recorded only once its response is sent.
+    auto response = get_json("/v1/metrics/requests?format=json");
+    REQUIRE_NO_THROW_TRUE(response.at("requests").is_array());
+
+    response = get_json("/v1/metrics/requests?format=json");
+    REQUIRE_NO_THROW_TRUE(response.at("requests").is_array());
+    const auto& requests = response.at("requests").as_array();
+    BOOST_REQUIRE(!requests.empty());
+
+    const auto& summary = requests.back().as_object();
+    BOOST_REQUIRE_EQUAL(summary.at("method").as_string(), "request_metrics");
+    BOOST_REQUIRE_EQUAL(summary.at("requests").as_int64(), 1);
+    BOOST_REQUIRE_EQUAL(summary.at("errors").as_int64(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(admin__request_metrics__text__prometheus)
+{
+    const auto text = get_text("/v1/metrics/requests?format=text");
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_requests_total counter") != std::string::npos);
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_request_seconds summary") != std::string::npos);
+}
+
+// metrics (http)
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(admin__metrics__text__prometheus)
+{
+    const auto text = get_text("/v1/metrics?format=text");
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_events_total counter") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_connections_accepted_total{interface=\"admin\"}") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_chain_height{chain=\"confirmed\"} 9\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_store_body_bytes{table=\"header\"}") != std::string::npos);
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_request_seconds summary") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(admin__metrics__json__not_acceptable)
+{
+    const auto value = get_status("/v1/metrics?format=json");
+    BOOST_REQUIRE(value == status::not_acceptable);
+}
+
+BOOST_AUTO_TEST_CASE(admin__stratum_workers__text__not_acceptable)
+{
+    const auto value = get_status("/v1/stratum/workers?format=text");
+    BOOST_REQUIRE(value == status::not_acceptable);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -67,9 +67,6 @@ const std::vector<std::string> wip_methods
     "getdescriptoractivity",
     "preciousblock",
     "scanblocks",
-    "waitforblock",
-    "waitforblockheight",
-    "waitfornewblock",
     "analyzepsbt",
     "combinepsbt",
     "converttopsbt",
@@ -79,7 +76,6 @@ const std::vector<std::string> wip_methods
     "joinpsbts",
     "descriptorprocesspsbt",
     "utxoupdatepsbt",
-    "submitblock",
     "submitheader",
     "addnode",
     "disconnectnode",
@@ -194,7 +190,6 @@ const std::vector<std::string> pending_methods
     "abortprivatebroadcast",
     "getprivatebroadcastinfo",
     "submitpackage",
-    "getblocktemplate",
     "getprioritisedtransactions",
     "prioritisetransaction",
     "estimatesmartfee"
@@ -399,6 +394,61 @@ BOOST_AUTO_TEST_CASE(bitcoind_rpc__getmininginfo__ten_block_store__expected)
     BOOST_REQUIRE(result.at("warnings").as_array().empty());
 }
 
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblocktemplate__ten_block_store__empty_over_top)
+{
+    const auto response = rpc("getblocktemplate");
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 10);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("previousblockhash")), block9);
+    BOOST_REQUIRE_EQUAL(result.at("coinbasevalue").as_int64(), 5'000'000'000);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("bits")), "1d00ffff");
+    BOOST_REQUIRE(result.at("transactions").as_array().empty());
+    BOOST_REQUIRE(as_text(result.at("longpollid")).starts_with(block9));
+    BOOST_REQUIRE(result.at("curtime").as_int64() >= result.at("mintime").as_int64());
+    BOOST_REQUIRE(!result.as_object().contains("default_witness_commitment"));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblocktemplate__repeated__same_longpollid)
+{
+    const auto first = rpc("getblocktemplate", "[{\"rules\": [\"segwit\"]}]");
+    const auto second = rpc("getblocktemplate", "[{\"rules\": [\"segwit\"]}]");
+    BOOST_REQUIRE_EQUAL(as_text(first.at("result").at("longpollid")),
+        as_text(second.at("result").at("longpollid")));
+}
+
+// A stale longpollid (prior top) is answered immediately.
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblocktemplate__stale_longpollid__current)
+{
+    const auto response = rpc("getblocktemplate", "[{\"longpollid\": \"" + block5 + "1\"}]");
+    BOOST_REQUIRE_EQUAL(as_text(response.at("result").at("previousblockhash")), block9);
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblocktemplate__invalid_mode__error)
+{
+    const auto response = rpc("getblocktemplate", "[{\"mode\": \"bogus\"}]");
+    BOOST_REQUIRE(has_error(response));
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__getblocktemplate__proposal_existing__duplicate)
+{
+    const auto data = encode_base16(test::block1.to_data(true));
+    const auto response = rpc("getblocktemplate", "[{\"mode\": \"proposal\", \"data\": \"" + data + "\"}]");
+    BOOST_REQUIRE_EQUAL(as_text(response.at("result")), "duplicate");
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitblock__existing__duplicate)
+{
+    const auto data = encode_base16(test::block1.to_data(true));
+    const auto response = rpc("submitblock", "[\"" + data + "\"]");
+    BOOST_REQUIRE_EQUAL(as_text(response.at("result")), "duplicate");
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__submitblock__invalid_hex__error)
+{
+    const auto response = rpc("submitblock", "[\"zz\"]");
+    BOOST_REQUIRE(has_error(response));
+}
+
 BOOST_AUTO_TEST_CASE(bitcoind_rpc__createrawtransaction__one_in_one_out__hex)
 {
     const auto txid = encode_hash(test::block1.transactions_ptr()->front()->hash(false));
@@ -762,6 +812,60 @@ BOOST_AUTO_TEST_CASE(bitcoind_rpc__getchaintxstats__block_hash__that_block)
     BOOST_REQUIRE_EQUAL(result.at("window_tx_count").as_int64(), 2);
 }
 
+// A reached height is not parked (returns the confirmed top).
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblockheight__reached__top)
+{
+    const auto response = rpc("waitforblockheight", "[5]");
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 9);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("hash")), block9);
+}
+
+// An unreached height is parked until the timeout (milliseconds).
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblockheight__unreached_timeout__top)
+{
+    const auto response = rpc("waitforblockheight", "[10, 50]");
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 9);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("hash")), block9);
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblockheight__negative__error)
+{
+    const auto response = rpc("waitforblockheight", "[-1]");
+    BOOST_REQUIRE(has_error(response));
+}
+
+// A confirmed block is not parked (returns the confirmed top).
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblock__confirmed__top)
+{
+    const auto response = rpc("waitforblock", "[\"" + block5 + "\"]");
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 9);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("hash")), block9);
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblock__unknown_timeout__top)
+{
+    const auto response = rpc("waitforblock", hash_param(system::one_hash, "50"));
+    BOOST_REQUIRE_EQUAL(response.at("result").at("height").as_int64(), 9);
+}
+
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitforblock__invalid_hash__error)
+{
+    const auto response = rpc("waitforblock", "[\"bogus\"]");
+    BOOST_REQUIRE(has_error(response));
+}
+
+// No block is organized, so the wait times out at the current top.
+BOOST_AUTO_TEST_CASE(bitcoind_rpc__waitfornewblock__timeout__top)
+{
+    const auto response = rpc("waitfornewblock", "[50]");
+    const auto& result = response.at("result");
+    BOOST_REQUIRE_EQUAL(result.at("height").as_int64(), 9);
+    BOOST_REQUIRE_EQUAL(as_text(result.at("hash")), block9);
+}
+
 BOOST_AUTO_TEST_CASE(bitcoind_rpc__uptime__running__seconds)
 {
     const auto response = rpc("uptime");
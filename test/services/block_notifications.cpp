@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_notifications_tests)
+
+using namespace network::rpc;
+
+static chain::header::cptr make_header() NOEXCEPT
+{
+    return std::make_shared<const chain::header>(
+        1u, null_hash, null_hash, 1231006505u, 0x1d00ffffu, 42u);
+}
+
+BOOST_AUTO_TEST_CASE(block_notifications__build__null_header__null)
+{
+    const database::header_link link{ 7 };
+    BOOST_REQUIRE(!block_notifications::build(link, 3, {}));
+}
+
+BOOST_AUTO_TEST_CASE(block_notifications__build__header__expected_fields)
+{
+    const auto header = make_header();
+    const database::header_link link{ 7 };
+    const auto notice = block_notifications::build(link, 3, header);
+    BOOST_REQUIRE(notice);
+    BOOST_REQUIRE(notice->link == link);
+    BOOST_REQUIRE_EQUAL(notice->height, 3u);
+    BOOST_REQUIRE(notice->header == header);
+    BOOST_REQUIRE_EQUAL(notice->header_text, encode_base16(header->to_data()));
+    BOOST_REQUIRE_EQUAL(notice->header_text.size(),
+        two * chain::header::serialized_size());
+}
+
+BOOST_AUTO_TEST_CASE(block_notifications__build__header__electrum_headers)
+{
+    const auto notice = block_notifications::build(
+        database::header_link{ 7 }, 3, make_header());
+    BOOST_REQUIRE(notice);
+
+    // Newline delimited, as written directly to the channel.
+    BOOST_REQUIRE(!notice->headers.empty());
+    BOOST_REQUIRE_EQUAL(notice->headers.back(), '\n');
+
+    const auto value = boost::json::parse(notice->headers);
+    const auto& object = value.as_object();
+    const auto& params = object.at("params").as_array();
+    BOOST_REQUIRE_EQUAL(object.at("jsonrpc").as_string(), "2.0");
+    BOOST_REQUIRE_EQUAL(object.at("method").as_string(),
+        "blockchain.headers.subscribe");
+    BOOST_REQUIRE_EQUAL(params.size(), one);
+
+    const auto& element = params.at(0).as_object();
+    BOOST_REQUIRE_EQUAL(element.at("height").to_number<size_t>(), 3u);
+    BOOST_REQUIRE_EQUAL(element.at("hex").as_string(), notice->header_text);
+}
+
+BOOST_AUTO_TEST_CASE(block_notifications__build__header__btcd_connected)
+{
+    const auto header = make_header();
+    const auto notice = block_notifications::build(
+        database::header_link{ 7 }, 3, header);
+    BOOST_REQUIRE(notice);
+
+    // Member order is that of the rpc model serializer.
+    const auto value = boost::json::parse(notice->connected);
+    const auto& object = value.as_object();
+    const auto& params = object.at("params").as_array();
+    BOOST_REQUIRE_EQUAL(object.at("jsonrpc").as_string(), "1.0");
+    BOOST_REQUIRE_EQUAL(object.at("method").as_string(), "blockconnected");
+    BOOST_REQUIRE(object.at("id").is_null());
+    BOOST_REQUIRE_EQUAL(params.size(), 3u);
+    BOOST_REQUIRE_EQUAL(params.at(0).as_string(),
+        encode_hash(header->get_hash()));
+    BOOST_REQUIRE_EQUAL(params.at(1).to_number<size_t>(), 3u);
+    BOOST_REQUIRE_EQUAL(params.at(2).to_number<uint32_t>(), 1231006505u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_stats_cache_tests)
+
+static block_stats_record make_record(size_t height) NOEXCEPT
+{
+    block_stats_record record{};
+    record.height = height;
+    record.txs = add1(height);
+    return record;
+}
+
+BOOST_AUTO_TEST_CASE(block_stats_cache__get__empty__false)
+{
+    const block_stats_cache instance{ 8 };
+    block_stats_record out{};
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 8u);
+    BOOST_REQUIRE(!instance.get(out, 3, database::header_link{ 42 }));
+}
+
+BOOST_AUTO_TEST_CASE(block_stats_cache__get__put__expected)
+{
+    block_stats_cache instance{ 8 };
+    instance.put(database::header_link{ 42 }, make_record(3));
+
+    block_stats_record out{};
+    BOOST_REQUIRE(instance.get(out, 3, database::header_link{ 42 }));
+    BOOST_REQUIRE_EQUAL(out.height, 3u);
+    BOOST_REQUIRE_EQUAL(out.txs, 4u);
+}
+
+// A reorganized height (distinct link) misses.
+BOOST_AUTO_TEST_CASE(block_stats_cache__get__distinct_link__false)
+{
+    block_stats_cache instance{ 8 };
+    instance.put(database::header_link{ 42 }, make_record(3));
+
+    block_stats_record out{};
+    BOOST_REQUIRE(!instance.get(out, 3, database::header_link{ 43 }));
+}
+
+// A colliding height (same slot) overwrites the prior record.
+BOOST_AUTO_TEST_CASE(block_stats_cache__put__colliding_height__overwritten)
+{
+    block_stats_cache instance{ 8 };
+    instance.put(database::header_link{ 42 }, make_record(3));
+    instance.put(database::header_link{ 50 }, make_record(11));
+
+    block_stats_record out{};
+    BOOST_REQUIRE(!instance.get(out, 3, database::header_link{ 42 }));
+    BOOST_REQUIRE(instance.get(out, 11, database::header_link{ 50 }));
+    BOOST_REQUIRE_EQUAL(out.height, 11u);
+}
+
+BOOST_AUTO_TEST_CASE(block_stats_cache__put__zero_capacity__disabled)
+{
+    block_stats_cache instance{ 0 };
+    instance.put(database::header_link{ 42 }, make_record(3));
+
+    block_stats_record out{};
+    BOOST_REQUIRE(!instance.get(out, 3, database::header_link{ 42 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_templates_tests)
+
+using namespace system;
+
+static template_tx::cptr make_tx(uint8_t id, uint64_t fee, size_t weight,
+    const hashes& parents={}, const chain::points& spends={}) NOEXCEPT
+{
+    const auto out = std::make_shared<template_tx>();
+    out->txid = hash_digest{ id };
+    out->wtxid = out->txid;
+    out->fee = fee;
+    out->weight = weight;
+    out->sigops = 4;
+    out->parents = parents;
+    out->spends = spends;
+    return out;
+}
+
+static hashes to_txids(const template_txs& txs) NOEXCEPT
+{
+    hashes out{};
+    for (const auto& tx: txs)
+        out.push_back(tx->txid);
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__current__default__null)
+{
+    const block_templates instance{};
+    BOOST_REQUIRE(!instance.current());
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__longpollid__template__hash_and_sequence)
+{
+    block_template value{};
+    value.previous = system::one_hash;
+    value.sequence = 42;
+    BOOST_REQUIRE_EQUAL(block_templates::longpollid(value),
+        system::encode_hash(system::one_hash) + "42");
+}
+
+// The well-known commitment of a coinbase-only block.
+BOOST_AUTO_TEST_CASE(block_templates__empty_commitment__always__expected)
+{
+    BOOST_REQUIRE_EQUAL(system::encode_base16(block_templates::empty_commitment()),
+        "e2f61c3f71d1defd3fa999dfa36953755c690689799962b48bebd836974e8cf9");
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__commitment__empty__empty_commitment)
+{
+    BOOST_REQUIRE_EQUAL(block_templates::commitment({}),
+        block_templates::empty_commitment());
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__commitment__transaction__not_empty)
+{
+    const template_txs txs{ make_tx(1, 0, 400) };
+    BOOST_REQUIRE_NE(block_templates::commitment(txs),
+        block_templates::empty_commitment());
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__select__empty__empty)
+{
+    BOOST_REQUIRE(block_templates::select({}, 4'000, 400).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__select__fee_rates__descending)
+{
+    const auto low = make_tx(1, 100, 1'000);
+    const auto high = make_tx(2, 3'000, 1'000);
+    const auto mid = make_tx(3, 1'000, 1'000);
+    const auto out = block_templates::select({ low, high, mid }, 4'000, 400);
+    BOOST_REQUIRE_EQUAL(to_txids(out), (hashes{ high->txid, mid->txid,
+        low->txid }));
+}
+
+// The child pays for its parent, the package rate exceeds the independent.
+BOOST_AUTO_TEST_CASE(block_templates__select__child_pays_for_parent__package)
+{
+    const auto parent = make_tx(1, 100, 1'000);
+    const auto child = make_tx(2, 2'000, 1'000, { parent->txid });
+    const auto other = make_tx(3, 1'000, 1'000);
+    const auto out = block_templates::select({ child, other, parent }, 2'000,
+        400);
+    BOOST_REQUIRE_EQUAL(to_txids(out), (hashes{ parent->txid, child->txid }));
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__select__orphan__excluded)
+{
+    const auto orphan = make_tx(1, 5'000, 1'000, { hash_digest{ 42 } });
+    const auto other = make_tx(2, 100, 1'000);
+    const auto out = block_templates::select({ orphan, other }, 4'000, 400);
+    BOOST_REQUIRE_EQUAL(to_txids(out), hashes{ other->txid });
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__select__conflict__higher_rate_only)
+{
+    const chain::point spent{ one_hash, 0 };
+    const auto first = make_tx(1, 100, 1'000, {}, { spent });
+    const auto second = make_tx(2, 200, 1'000, {}, { spent });
+    const auto out = block_templates::select({ first, second }, 4'000, 400);
+    BOOST_REQUIRE_EQUAL(to_txids(out), hashes{ second->txid });
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__select__over_limits__skipped)
+{
+    const auto heavy = make_tx(1, 9'000, 3'000);
+    const auto light = make_tx(2, 100, 1'000);
+    BOOST_REQUIRE_EQUAL(to_txids(block_templates::select({ heavy, light },
+        2'000, 400)), hashes{ light->txid });
+    BOOST_REQUIRE(block_templates::select({ heavy, light }, 4'000, 3).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_templates__pooled__default__zero)
+{
+    const block_templates instance{};
+    BOOST_REQUIRE_EQUAL(instance.pooled(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
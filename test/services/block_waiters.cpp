@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_waiters_tests)
+
+BOOST_AUTO_TEST_CASE(block_waiters__wait__unnotified__parked)
+{
+    block_waiters instance{};
+    block_waiters::key height{}, hash{}, change{};
+    BOOST_REQUIRE(instance.wait_height(height, 10, [](const code&) {}));
+    BOOST_REQUIRE(instance.wait_hash(hash, system::one_hash, [](const code&) {}));
+    BOOST_REQUIRE(instance.wait_change(change, system::null_hash, [](const code&) {}));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_NE(height, hash);
+    BOOST_REQUIRE_NE(hash, change);
+}
+
+BOOST_AUTO_TEST_CASE(block_waiters__cancel__parked__true_not_invoked)
+{
+    block_waiters instance{};
+    block_waiters::key id{};
+    auto invoked = false;
+    BOOST_REQUIRE(instance.wait_height(id, 10, [&](const code&)
+    {
+        invoked = true;
+    }));
+
+    BOOST_REQUIRE(instance.cancel(id));
+    BOOST_REQUIRE(!instance.cancel(id));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!invoked);
+}
+
+BOOST_AUTO_TEST_CASE(block_waiters__cancel__unknown__false)
+{
+    block_waiters instance{};
+    BOOST_REQUIRE(!instance.cancel(42));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+struct block_waiters_setup_fixture
+{
+    DELETE_COPY_MOVE(block_waiters_setup_fixture);
+
+    block_waiters_setup_fixture()
+      : config_
+        {
+            system::chain::selection::mainnet,
+            test::web_pages,
+            test::web_pages
+        },
+        store_
+        {
+            [this]() NOEXCEPT -> const database::settings&
+            {
+                config_.database.path = TEST_DIRECTORY;
+                return config_.database;
+            }()
+        },
+        query_{ store_ }
+    {
+        BOOST_REQUIRE_MESSAGE(test::clear(test::directory), "waiters setup");
+        const auto ec = store_.create([](auto, auto) {});
+        BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+        BOOST_REQUIRE_MESSAGE(test::setup_ten_block_store(query_),
+            "waiters initialize");
+    }
+
+    ~block_waiters_setup_fixture()
+    {
+        const auto ec = store_.close([](auto, auto) {});
+        BOOST_WARN_MESSAGE(!ec, ec.message());
+        BOOST_WARN_MESSAGE(test::clear(test::directory), "waiters cleanup");
+    }
+
+    configuration config_;
+    test::store_t store_;
+    test::query_t query_;
+};
+
+BOOST_FIXTURE_TEST_SUITE(block_waiters_store_tests,
+    block_waiters_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(block_waiters__is_confirmed__confirmed_unconfirmed__expected)
+{
+    BOOST_REQUIRE(block_waiters::is_confirmed(query_, test::block3_hash));
+    BOOST_REQUIRE(!block_waiters::is_confirmed(query_, system::one_hash));
+}
+
+BOOST_AUTO_TEST_CASE(block_waiters__notify__top__hash_released)
+{
+    block_waiters instance{};
+    block_waiters::key id{};
+    auto invoked = false;
+    BOOST_REQUIRE(instance.wait_hash(id, test::block9_hash, [&](const code&)
+    {
+        invoked = true;
+    }));
+
+    instance.notify(query_, query_.to_header(test::block9_hash));
+    BOOST_REQUIRE(invoked);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+// The parked block was confirmed below the notified top.
+BOOST_AUTO_TEST_CASE(block_waiters__notify__confirmed_below_top__hash_released)
+{
+    block_waiters instance{};
+    block_waiters::key confirmed{}, unconfirmed{};
+    auto invoked = false;
+    BOOST_REQUIRE(instance.wait_hash(confirmed, test::block3_hash,
+        [&](const code&)
+        {
+            invoked = true;
+        }));
+    BOOST_REQUIRE(instance.wait_hash(unconfirmed, system::one_hash,
+        [](const code&) {}));
+
+    instance.notify(query_, query_.to_header(test::block9_hash));
+    BOOST_REQUIRE(invoked);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE(instance.cancel(unconfirmed));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+
+struct chain_tx_index_setup_fixture
+{
+    DELETE_COPY_MOVE(chain_tx_index_setup_fixture);
+
+    chain_tx_index_setup_fixture()
+      : config_
+        {
+            system::chain::selection::mainnet,
+            test::web_pages,
+            test::web_pages
+        },
+        store_
+        {
+            [this]() NOEXCEPT -> const database::settings&
+            {
+                config_.database.path = TEST_DIRECTORY;
+                return config_.database;
+            }()
+        },
+        query_{ store_ }
+    {
+        BOOST_REQUIRE_MESSAGE(test::clear(test::directory), "index setup");
+        const auto ec = store_.create([](auto, auto) {});
+        BOOST_REQUIRE_MESSAGE(!ec, ec.message());
+        BOOST_REQUIRE_MESSAGE(test::setup_ten_block_store(query_),
+            "index initialize");
+    }
+
+    ~chain_tx_index_setup_fixture()
+    {
+        const auto ec = store_.close([](auto, auto) {});
+        BOOST_WARN_MESSAGE(!ec, ec.message());
+        BOOST_WARN_MESSAGE(test::clear(test::directory), "index cleanup");
+    }
+
+    // Confirmed tx count from genesis through height, by direct query.
+    size_t expected(size_t height) const NOEXCEPT
+    {
+        size_t count{};
+        for (size_t index = 0; index <= height; ++index)
+            count += query_.get_tx_count(query_.to_confirmed(index));
+
+        return count;
+    }
+
+    std::atomic_bool canceled_{};
+    configuration config_;
+    test::store_t store_;
+    test::query_t query_;
+};
+
+BOOST_FIXTURE_TEST_SUITE(chain_tx_index_tests, chain_tx_index_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__seed__ten_blocks__all_indexed_ready)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(!instance.ready());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+    BOOST_REQUIRE(instance.ready());
+    BOOST_REQUIRE_EQUAL(instance.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__seed__canceled__false_not_ready)
+{
+    chain_tx_index instance{};
+    canceled_ = true;
+    BOOST_REQUIRE(!instance.seed(query_, canceled_));
+    BOOST_REQUIRE(!instance.ready());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__get__confirmed__expected)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    size_t out{};
+    BOOST_REQUIRE(instance.get(out, query_, 0));
+    BOOST_REQUIRE_EQUAL(out, expected(0));
+    BOOST_REQUIRE(instance.get(out, query_, 5));
+    BOOST_REQUIRE_EQUAL(out, expected(5));
+    BOOST_REQUIRE(instance.get(out, query_, 9));
+    BOOST_REQUIRE_EQUAL(out, expected(9));
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__get__not_seeded__false)
+{
+    chain_tx_index instance{};
+
+    size_t out{};
+    BOOST_REQUIRE(!instance.update(query_));
+    BOOST_REQUIRE(!instance.get(out, query_, 4));
+    BOOST_REQUIRE(!instance.window(out, query_, 2, 4));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__get__above_top__false)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    size_t out{};
+    BOOST_REQUIRE(!instance.get(out, query_, 10));
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__window__confirmed__difference)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    size_t out{};
+    BOOST_REQUIRE(instance.window(out, query_, 2, 7));
+    BOOST_REQUIRE_EQUAL(out, expected(7) - expected(2));
+    BOOST_REQUIRE(instance.window(out, query_, 3, 3));
+    BOOST_REQUIRE_EQUAL(out, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__window__reversed_or_above_top__false)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    size_t out{};
+    BOOST_REQUIRE(!instance.window(out, query_, 7, 2));
+    BOOST_REQUIRE(!instance.window(out, query_, 2, 10));
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__update__popped__truncated)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    BOOST_REQUIRE(query_.pop_confirmed()); // 9
+    BOOST_REQUIRE(query_.pop_confirmed()); // 8
+    BOOST_REQUIRE(query_.pop_confirmed()); // 7
+    BOOST_REQUIRE(instance.update(query_));
+    BOOST_REQUIRE_EQUAL(instance.size(), 7u);
+
+    size_t out{};
+    BOOST_REQUIRE(!instance.get(out, query_, 7));
+    BOOST_REQUIRE(instance.get(out, query_, 6));
+    BOOST_REQUIRE_EQUAL(out, expected(6));
+}
+
+BOOST_AUTO_TEST_CASE(chain_tx_index__get__reorganized__rewound_to_fork)
+{
+    chain_tx_index instance{};
+    BOOST_REQUIRE(instance.seed(query_, canceled_));
+
+    // Reorganize block1a over block1 (genesis is the fork point).
+    for (size_t height = 9; height > 0; --height)
+    {
+        BOOST_REQUIRE(query_.pop_confirmed());
+    }
+
+    BOOST_REQUIRE(query_.set(test::block1a, database::context{ 0, 1, 0 },
+        false, false));
+    BOOST_REQUIRE(query_.push_confirmed(
+        query_.to_header(test::block1a.hash()), true));
+
+    size_t out{};
+    BOOST_REQUIRE(instance.get(out, query_, 1));
+    BOOST_REQUIRE_EQUAL(out, expected(1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.get(out, query_, 2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(chase_hub_tests)
+
+static chase_hub::subscriber_ptr make_counter(size_t& count,
+    bool result = true) NOEXCEPT
+{
+    return chase_hub::make([&count, result](const code&, node::chase,
+        node::event_value) NOEXCEPT
+    {
+        ++count;
+        return result;
+    });
+}
+
+static const node::event_value value{ node::header_t{ 42 } };
+
+BOOST_AUTO_TEST_CASE(chase_hub__to_events__fanned_out__expected)
+{
+    BOOST_REQUIRE_EQUAL(chase_hub::to_events(node::chase::organized), chase_hub::organized);
+    BOOST_REQUIRE_EQUAL(chase_hub::to_events(node::chase::reorganized), chase_hub::reorganized);
+    BOOST_REQUIRE_EQUAL(chase_hub::to_events(node::chase::block), chase_hub::block);
+    BOOST_REQUIRE_EQUAL(chase_hub::to_events(node::chase::transaction), chase_hub::transaction);
+    BOOST_REQUIRE_EQUAL(chase_hub::to_events(node::chase::start), chase_hub::none);
+}
+
+BOOST_AUTO_TEST_CASE(chase_hub__notify__unsubscribed__not_invoked)
+{
+    chase_hub instance{};
+    size_t count{};
+    const auto subscriber = make_counter(count);
+    instance.notify(error::success, node::chase::organized, value);
+    BOOST_REQUIRE_EQUAL(count, 0u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(chase_hub__notify__subscribed__invoked_by_event)
+{
+    chase_hub instance{};
+    size_t count{};
+    const auto subscriber = make_counter(count);
+    instance.subscribe(subscriber, chase_hub::organized);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 1u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::transaction), 0u);
+
+    instance.notify(error::success, node::chase::transaction, value);
+    BOOST_REQUIRE_EQUAL(count, 0u);
+
+    instance.notify(error::success, node::chase::organized, value);
+    BOOST_REQUIRE_EQUAL(count, 1u);
+}
+
+// Independent subscriptions of a channel compose.
+BOOST_AUTO_TEST_CASE(chase_hub__unsubscribe__counted__removed_upon_last)
+{
+    chase_hub instance{};
+    size_t count{};
+    const auto subscriber = make_counter(count);
+    instance.subscribe(subscriber, chase_hub::organized);
+    instance.subscribe(subscriber, chase_hub::organized |
+        chase_hub::transaction);
+
+    // Listed once regardless of count.
+    instance.notify(error::success, node::chase::organized, value);
+    BOOST_REQUIRE_EQUAL(count, 1u);
+
+    instance.unsubscribe(subscriber, chase_hub::organized);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 1u);
+
+    instance.unsubscribe(subscriber, chase_hub::organized);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 0u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::transaction), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(chase_hub__unsubscribe__all__removed_from_all)
+{
+    chase_hub instance{};
+    size_t count{};
+    const auto subscriber = make_counter(count);
+    instance.subscribe(subscriber, chase_hub::block | chase_hub::reorganized);
+    instance.unsubscribe(subscriber);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::block), 0u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::reorganized), 0u);
+
+    // Unsubscribe of a subscriber without counts is a no-op.
+    instance.unsubscribe(subscriber, chase_hub::block);
+    instance.subscribe(subscriber, chase_hub::block);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::block), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(chase_hub__notify__false_return__removed_from_all)
+{
+    chase_hub instance{};
+    size_t stopped{};
+    size_t running{};
+    const auto expired = make_counter(stopped, false);
+    const auto active = make_counter(running);
+    instance.subscribe(expired, chase_hub::organized | chase_hub::block);
+    instance.subscribe(active, chase_hub::organized);
+
+    instance.notify(error::success, node::chase::organized, value);
+    BOOST_REQUIRE_EQUAL(stopped, 1u);
+    BOOST_REQUIRE_EQUAL(running, 1u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 1u);
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::block), 0u);
+
+    instance.notify(error::success, node::chase::organized, value);
+    BOOST_REQUIRE_EQUAL(stopped, 1u);
+    BOOST_REQUIRE_EQUAL(running, 2u);
+}
+
+// An owner whose subscriber handler binds the owner (as a protocol).
+class owner
+  : public std::enable_shared_from_this<owner>
+{
+public:
+    void start() NOEXCEPT
+    {
+        subscriber_ = chase_hub::make([self = shared_from_this()](
+            const code&, node::chase, node::event_value) NOEXCEPT
+        {
+            return !is_null(self);
+        });
+    }
+
+    void stopping(chase_hub& hub) NOEXCEPT
+    {
+        hub.unsubscribe(subscriber_);
+        subscriber_.reset();
+    }
+
+    chase_hub::subscriber_ptr subscriber_{};
+};
+
+BOOST_AUTO_TEST_CASE(chase_hub__unsubscribe__owner_released__expired)
+{
+    chase_hub instance{};
+    auto instance_owner = std::make_shared<owner>();
+    const std::weak_ptr<owner> weak{ instance_owner };
+    instance_owner->start();
+    instance.subscribe(instance_owner->subscriber_, chase_hub::organized);
+    instance.notify(error::success, node::chase::organized, value);
+
+    instance_owner->stopping(instance);
+    instance_owner.reset();
+    BOOST_REQUIRE(weak.expired());
+    BOOST_REQUIRE_EQUAL(instance.subscribers(node::chase::organized), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+#include <future>
+
+BOOST_AUTO_TEST_SUITE(executor_pools_tests)
+
+static const server::settings::embedded_pages pages{};
+
+BOOST_AUTO_TEST_CASE(executor_pools__find__no_threads__null_fallback)
+{
+    const server::settings settings{ system::chain::selection::none, pages,
+        pages };
+    const network::logger log{};
+    executor_pools instance{ settings, log };
+    executor_pools::service_t fallback{};
+    BOOST_REQUIRE(is_null(instance.find("electrum")));
+    BOOST_REQUIRE_EQUAL(&instance.service("electrum", fallback), &fallback);
+}
+
+BOOST_AUTO_TEST_CASE(executor_pools__service__threads__runs_posted_work)
+{
+    server::settings settings{ system::chain::selection::none, pages, pages };
+    settings.pools.stratum_v1.threads = 2;
+    const network::logger log{};
+    executor_pools instance{ settings, log };
+    executor_pools::service_t fallback{};
+    BOOST_REQUIRE(!is_null(instance.find("stratum_v1")));
+    BOOST_REQUIRE(is_null(instance.find("electrum")));
+
+    std::promise<bool> promise{};
+    auto& service = instance.service("stratum_v1", fallback);
+    BOOST_REQUIRE_NE(&service, &fallback);
+    boost::asio::post(service, [&]() NOEXCEPT
+    {
+        promise.set_value(true);
+    });
+
+    BOOST_REQUIRE(promise.get_future().get());
+    instance.stop();
+    instance.stop();
+}
+
+BOOST_AUTO_TEST_CASE(executor_pools__parse_cpus__list__expected)
+{
+    std::vector<size_t> cpus{};
+    BOOST_REQUIRE(executor_pools::parse_cpus(cpus, "0-2,8"));
+    BOOST_REQUIRE_EQUAL(cpus.size(), 4u);
+    BOOST_REQUIRE_EQUAL(cpus.at(0), 0u);
+    BOOST_REQUIRE_EQUAL(cpus.at(2), 2u);
+    BOOST_REQUIRE_EQUAL(cpus.at(3), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(executor_pools__parse_cpus__invalid__false_empty)
+{
+    std::vector<size_t> cpus{};
+    BOOST_REQUIRE(!executor_pools::parse_cpus(cpus, ""));
+    BOOST_REQUIRE(!executor_pools::parse_cpus(cpus, "3-1"));
+    BOOST_REQUIRE(!executor_pools::parse_cpus(cpus, "1-2-3"));
+    BOOST_REQUIRE(!executor_pools::parse_cpus(cpus, "a"));
+    BOOST_REQUIRE(cpus.empty());
+}
+
+BOOST_AUTO_TEST_CASE(executor_pools__numa_cpus__negative__empty)
+{
+    BOOST_REQUIRE(executor_pools::numa_cpus(-1).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
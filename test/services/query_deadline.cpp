@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(query_deadline_tests)
+
+using namespace std::chrono;
+
+// Start requires the strand.
+static void start(query_deadline::strand_t& strand,
+    const query_deadline::ptr& instance, const milliseconds& timeout) NOEXCEPT
+{
+    boost::asio::post(strand, [=]() NOEXCEPT
+    {
+        instance->start(timeout);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__parse__entries__expected)
+{
+    const auto timeouts = query_deadline::parse(
+    {
+        "blockchain.scripthash.get_history:5000",
+        "blockchain.scripthash.get_balance:0",
+        "invalid",
+        "invalid:time"
+    });
+
+    BOOST_REQUIRE_EQUAL(timeouts.size(), 2u);
+    BOOST_REQUIRE(timeouts.at("blockchain.scripthash.get_history") ==
+        milliseconds(5000));
+    BOOST_REQUIRE(timeouts.at("blockchain.scripthash.get_balance") ==
+        milliseconds(0));
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__complete__zero_timeout__not_expired)
+{
+    network::asio::io_context service{};
+    query_deadline::strand_t strand{ service.get_executor() };
+    const auto instance = std::make_shared<query_deadline>(strand);
+    start(strand, instance, milliseconds(0));
+    service.run();
+    BOOST_REQUIRE(!instance->canceled());
+    BOOST_REQUIRE(!instance->expired());
+    BOOST_REQUIRE(!instance->completed());
+
+    const code ec{ error::not_found };
+    BOOST_REQUIRE(instance->complete(ec) == ec);
+    BOOST_REQUIRE(instance->completed());
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__complete__expired__query_canceled)
+{
+    network::asio::io_context service{};
+    query_deadline::strand_t strand{ service.get_executor() };
+    const auto instance = std::make_shared<query_deadline>(strand);
+    start(strand, instance, milliseconds(1));
+    service.run();
+    BOOST_REQUIRE(instance->canceled());
+    BOOST_REQUIRE(instance->expired());
+    BOOST_REQUIRE(instance->complete({}) == error::query_canceled);
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__complete__before_expiry__not_expired)
+{
+    network::asio::io_context service{};
+    query_deadline::strand_t strand{ service.get_executor() };
+    const auto instance = std::make_shared<query_deadline>(strand);
+    start(strand, instance, hours(1));
+    BOOST_REQUIRE(!instance->complete({}));
+    service.run();
+    BOOST_REQUIRE(!instance->canceled());
+    BOOST_REQUIRE(!instance->expired());
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__complete__after_timer_fires__not_expired)
+{
+    network::asio::io_context service{};
+    query_deadline::strand_t strand{ service.get_executor() };
+    const auto instance = std::make_shared<query_deadline>(strand);
+    start(strand, instance, milliseconds(1));
+    service.run_one();
+
+    // The timer fires before its cancel is posted, completion still wins.
+    std::this_thread::sleep_for(milliseconds(10));
+    const code ec{ error::not_found };
+    BOOST_REQUIRE(instance->complete(ec) == ec);
+    service.run();
+    BOOST_REQUIRE(instance->completed());
+    BOOST_REQUIRE(!instance->canceled());
+    BOOST_REQUIRE(!instance->expired());
+}
+
+BOOST_AUTO_TEST_CASE(query_deadline__cancel__canceled_not_expired)
+{
+    network::asio::io_context service{};
+    query_deadline::strand_t strand{ service.get_executor() };
+    const auto instance = std::make_shared<query_deadline>(strand);
+    instance->cancel();
+    BOOST_REQUIRE(instance->canceled());
+    BOOST_REQUIRE(!instance->expired());
+    BOOST_REQUIRE(!instance->complete({}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
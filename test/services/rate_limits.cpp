@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(rate_limits_tests)
+
+using namespace std::chrono;
+static const server::settings::embedded_pages pages{};
+
+BOOST_AUTO_TEST_CASE(rate_limits__find__no_rate__null)
+{
+    const server::settings settings{ system::chain::selection::none, pages,
+        pages };
+    const rate_limits instance{ settings };
+    BOOST_REQUIRE(is_null(instance.find("bitcoind")));
+    BOOST_REQUIRE(is_null(instance.find("btcd")));
+    BOOST_REQUIRE(is_null(instance.find("electrum")));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limits__find__rate__expected)
+{
+    server::settings settings{ system::chain::selection::none, pages, pages };
+    settings.limits.electrum.rate = 10;
+    const rate_limits instance{ settings };
+    BOOST_REQUIRE(!is_null(instance.find("electrum")));
+    BOOST_REQUIRE(is_null(instance.find("bitcoind")));
+    BOOST_REQUIRE(is_null(instance.find("stratum_v1")));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__cost__configured__expected)
+{
+    server::settings::limiter settings{};
+    settings.burst = 20;
+    settings.costs =
+    {
+        "blockchain.scripthash.get_history:10",
+        "blockchain.headers.subscribe:0",
+        "blockchain.block.headers:1000",
+        "server.version:0.5",
+        "invalid",
+        "invalid:cost",
+        "invalid.negative:-1",
+        "invalid.suffix:1x"
+    };
+
+    const rate_limiter instance{ settings };
+    BOOST_REQUIRE_EQUAL(instance.cost("blockchain.scripthash.get_history"),
+        10.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("blockchain.headers.subscribe"), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("blockchain.block.headers"), 20.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("server.version"), 0.5);
+    BOOST_REQUIRE_EQUAL(instance.cost("invalid"), 1.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("invalid.negative"), 1.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("invalid.suffix"), 1.0);
+    BOOST_REQUIRE_EQUAL(instance.cost("server.ping"), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__burst_exhausted__false)
+{
+    server::settings::limiter settings{};
+    settings.rate = 1;
+    settings.burst = 3;
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("b", "server.ping", now));
+    BOOST_REQUIRE_EQUAL(instance.clients(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__refilled__true)
+{
+    server::settings::limiter settings{};
+    settings.rate = 2;
+    settings.burst = 2;
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now + milliseconds(500)));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now + milliseconds(500)));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__free_method_in_debt__true)
+{
+    server::settings::limiter settings{};
+    settings.rate = 1;
+    settings.burst = 1;
+    settings.costs = { "blockchain.headers.subscribe:0" };
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "blockchain.headers.subscribe", now));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__admit__fractional_cost__expected)
+{
+    server::settings::limiter settings{};
+    settings.rate = 1;
+    settings.burst = 1;
+    settings.costs = { "server.ping:0.25" };
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.version", now));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now + milliseconds(250)));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__charge__query_rows__debt_defers_admission)
+{
+    server::settings::limiter settings{};
+    settings.rate = 10;
+    settings.burst = 10;
+    settings.query_rows = 100;
+    settings.query_msecs = 0;
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+
+    // 9 tokens less 1'000 rows (10 tokens) leaves a debt of one token.
+    instance.charge("a", 1'000, {});
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now + milliseconds(150)));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now + milliseconds(250)));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__charge__query_time__bounded_debt)
+{
+    server::settings::limiter settings{};
+    settings.rate = 1;
+    settings.burst = 2;
+    settings.query_msecs = 10;
+    settings.query_rows = 0;
+    rate_limiter instance{ settings };
+    const auto now = rate_limiter::clock::now();
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now));
+
+    // An hour of query time is bounded to a debt of the burst (two tokens).
+    instance.charge("a", 0u, hours(1));
+    BOOST_REQUIRE(!instance.admit("a", "server.ping", now + seconds(2)));
+    BOOST_REQUIRE(instance.admit("a", "server.ping", now + seconds(3)));
+}
+
+BOOST_AUTO_TEST_CASE(rate_limiter__charge__unknown_client__not_tracked)
+{
+    server::settings::limiter settings{};
+    settings.rate = 1;
+    rate_limiter instance{ settings };
+    instance.charge("a", 1'000, seconds(1));
+    BOOST_REQUIRE_EQUAL(instance.clients(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(request_metrics_tests)
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(request_counter__to_bucket__linear__identity)
+{
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(0), 0u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(1), 1u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(3), 3u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(4), 4u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(7), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(request_counter__to_bucket__logarithmic__expected)
+{
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(8), 8u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(9), 8u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(15), 11u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(16), 12u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(1000), 35u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_bucket(max_uint64),
+        sub1(request_counter::buckets));
+}
+
+BOOST_AUTO_TEST_CASE(request_counter__to_usecs__bucket__exclusive_upper_bound)
+{
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(0), 1u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(3), 4u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(4), 5u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(8), 10u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(11), 16u);
+    BOOST_REQUIRE_EQUAL(request_counter::to_usecs(35), 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(request_metrics__aggregate__empty__empty)
+{
+    const request_metrics instance{};
+    BOOST_REQUIRE(instance.aggregate().empty());
+}
+
+BOOST_AUTO_TEST_CASE(request_metrics__record__quantiles__expected)
+{
+    request_metrics instance{};
+    for (auto count = 0; count < 99; ++count)
+        instance.record("electrum", "server.ping", microseconds(2), 10, false);
+
+    instance.record("electrum", "server.ping", microseconds(1000), 10, true);
+
+    const auto summaries = instance.aggregate();
+    BOOST_REQUIRE_EQUAL(summaries.size(), 1u);
+
+    const auto& summary = summaries.front();
+    BOOST_REQUIRE_EQUAL(summary.interface, "electrum");
+    BOOST_REQUIRE_EQUAL(summary.method, "server.ping");
+    BOOST_REQUIRE_EQUAL(summary.requests, 100u);
+    BOOST_REQUIRE_EQUAL(summary.errors, 1u);
+    BOOST_REQUIRE_EQUAL(summary.bytes, 1000u);
+    BOOST_REQUIRE_EQUAL(summary.usecs, 99u * 2u + 1000u);
+    BOOST_REQUIRE_EQUAL(summary.samples, 100u);
+    BOOST_REQUIRE_EQUAL(summary.p50_usecs, 3u);
+    BOOST_REQUIRE_EQUAL(summary.p90_usecs, 3u);
+    BOOST_REQUIRE_EQUAL(summary.p99_usecs, 3u);
+    BOOST_REQUIRE_EQUAL(summary.maximum_usecs, 1024u);
+}
+
+BOOST_AUTO_TEST_CASE(request_metrics__fail__untimed__counted)
+{
+    request_metrics instance{};
+    instance.fail("native", "block");
+
+    const auto summaries = instance.aggregate();
+    BOOST_REQUIRE_EQUAL(summaries.size(), 1u);
+    BOOST_REQUIRE_EQUAL(summaries.front().requests, 1u);
+    BOOST_REQUIRE_EQUAL(summaries.front().errors, 1u);
+    BOOST_REQUIRE_EQUAL(summaries.front().samples, 0u);
+    BOOST_REQUIRE_EQUAL(summaries.front().p50_usecs, 0u);
+    BOOST_REQUIRE_EQUAL(summaries.front().maximum_usecs, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(request_metrics__aggregate__multiple__ordered)
+{
+    request_metrics instance{};
+    instance.record("native", "top", microseconds(1), 1, false);
+    instance.record("bitcoind", "getblock", microseconds(1), 1, false);
+    instance.record("bitcoind", "getbestblockhash", microseconds(1), 1, false);
+
+    const auto summaries = instance.aggregate();
+    BOOST_REQUIRE_EQUAL(summaries.size(), 3u);
+    BOOST_REQUIRE_EQUAL(summaries[0].method, "getbestblockhash");
+    BOOST_REQUIRE_EQUAL(summaries[1].method, "getblock");
+    BOOST_REQUIRE_EQUAL(summaries[2].interface, "native");
+}
+
+BOOST_AUTO_TEST_CASE(request_metrics__to_prometheus__record__expected_lines)
+{
+    request_metrics instance{};
+    instance.record("btcd", "getblockcount", microseconds(1'500'000), 7,
+        false);
+
+    const auto text = request_metrics::to_prometheus(instance.aggregate());
+    const std::string labels{ "{interface=\"btcd\",method=\"getblockcount\"" };
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_requests_total counter\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_requests_total" + labels + "} 1\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_response_bytes_total" + labels + "} 7\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_request_seconds_sum" + labels + "} 1.500000\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_request_seconds_count" + labels + "} 1\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(server_metrics_tests)
+
+static const server::settings::embedded_pages pages{};
+static const server::settings settings{ system::chain::selection::none, pages,
+    pages };
+
+BOOST_AUTO_TEST_CASE(server_metrics__to_name__defined__expected)
+{
+    BOOST_REQUIRE_EQUAL(server_metrics::to_name(node::events::block_usecs), "block_usecs");
+    BOOST_REQUIRE_EQUAL(server_metrics::to_name(server_events::sessions_start_msecs), "sessions_start_msecs");
+    BOOST_REQUIRE(server_metrics::to_name(node::events::unknown).empty());
+}
+
+BOOST_AUTO_TEST_CASE(server_metrics__events__none_fired__empty)
+{
+    const server_metrics instance{ settings };
+    BOOST_REQUIRE(instance.events().empty());
+}
+
+BOOST_AUTO_TEST_CASE(server_metrics__fire__repeated__aggregated)
+{
+    server_metrics instance{ settings };
+    instance.fire(node::events::filter_msecs, 10);
+    instance.fire(node::events::filter_msecs, 30);
+    instance.fire(node::events::unknown, 42);
+    instance.fire(255, 42);
+
+    const auto events = instance.events();
+    BOOST_REQUIRE_EQUAL(events.size(), 1u);
+    BOOST_REQUIRE_EQUAL(events.front().name, "filter_msecs");
+    BOOST_REQUIRE_EQUAL(events.front().count, 2u);
+    BOOST_REQUIRE_EQUAL(events.front().value, 30u);
+    BOOST_REQUIRE_EQUAL(events.front().total, 40u);
+}
+
+BOOST_AUTO_TEST_CASE(server_metrics__accept__configured_interfaces__counted)
+{
+    server_metrics instance{ settings };
+    instance.accept("electrum");
+    instance.accept("electrum");
+    instance.accept("undefined");
+
+    const auto connections = instance.connections();
+    BOOST_REQUIRE_EQUAL(connections.size(), 7u);
+
+    const auto electrum = std::find_if(connections.begin(), connections.end(),
+        [](const auto& connection) { return connection.interface == "electrum"; });
+    BOOST_REQUIRE(electrum != connections.end());
+    BOOST_REQUIRE_EQUAL(electrum->accepted, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(server_metrics__to_prometheus__fired__expected_lines)
+{
+    server_metrics instance{ settings };
+    instance.fire(node::events::block_usecs, 5);
+    instance.accept("btcd");
+
+    const auto text = instance.to_prometheus();
+    BOOST_REQUIRE(text.find("# TYPE libbitcoin_server_events_total counter\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_events_total{event=\"block_usecs\"} 1\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_event_value{event=\"block_usecs\"} 5\n") != std::string::npos);
+    BOOST_REQUIRE(text.find("libbitcoin_server_connections_accepted_total{interface=\"btcd\"} 1\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
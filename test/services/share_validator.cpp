@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(share_validator_tests)
+
+using namespace system;
+
+static const server::settings::embedded_pages pages{};
+
+static stratum_job::cptr make_job(stratum_jobs& jobs) NOEXCEPT
+{
+    const auto out = std::make_shared<block_template>();
+    out->previous = one_hash;
+    out->height = 500'000;
+    out->version = block_templates::version;
+    out->bits = 0x1d00ffff;
+    out->mintime = 42;
+    out->coinbase_value = 5'000'000'000;
+    out->segwit = true;
+    out->witness_commitment = block_templates::empty_commitment();
+    return jobs.update(out);
+}
+
+struct result
+{
+    code ec{};
+    hash_digest hash{};
+    chain::block::cptr block{};
+};
+
+static stratum_share make_share(const stratum_job::cptr& job, uint32_t nonce,
+    uint32_t difficulty, std::vector<result>& results) NOEXCEPT
+{
+    return
+    {
+        job, 7, stratum_jobs::prefix(*job, 7), { 1, 2, 3, 4 }, job->time,
+        nonce, difficulty,
+        [&](const code& ec, const hash_digest& hash,
+            const chain::block::cptr& block) NOEXCEPT
+        {
+            results.push_back({ ec, hash, block });
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(share_validator__enqueue__second__no_drain_required)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    settings.stratum_v1.payout_address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+    stratum_jobs jobs{ settings };
+    const auto job = make_job(jobs);
+
+    std::vector<result> results{};
+    share_validator instance{};
+    auto drain{ false };
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 1, 1, results)));
+    BOOST_REQUIRE(drain);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 2, 1, results)));
+    BOOST_REQUIRE(!drain);
+
+    instance.drain();
+    BOOST_REQUIRE_EQUAL(results.size(), 2u);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 3, 1, results)));
+    BOOST_REQUIRE(drain);
+}
+
+BOOST_AUTO_TEST_CASE(share_validator__enqueue__full__rejected)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    settings.stratum_v1.payout_address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+    stratum_jobs jobs{ settings };
+    const auto job = make_job(jobs);
+
+    std::vector<result> results{};
+    share_validator instance{ 2 };
+    auto drain{ false };
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 1, 1, results)));
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 2, 1, results)));
+    BOOST_REQUIRE(!instance.enqueue(drain, make_share(job, 3, 1, results)));
+    BOOST_REQUIRE(!drain);
+
+    instance.drain();
+    BOOST_REQUIRE_EQUAL(results.size(), 2u);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 4, 1, results)));
+    BOOST_REQUIRE(drain);
+}
+
+BOOST_AUTO_TEST_CASE(share_validator__enqueue__concurrency__drains_bounded)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    settings.stratum_v1.payout_address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+    stratum_jobs jobs{ settings };
+    const auto job = make_job(jobs);
+
+    std::vector<result> results{};
+    share_validator instance{ max_size_t, 2 };
+    auto drain{ false };
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 1, 1, results)));
+    BOOST_REQUIRE(drain);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 2, 1, results)));
+    BOOST_REQUIRE(drain);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 3, 1, results)));
+    BOOST_REQUIRE(!drain);
+
+    // The first drain empties the queue, the second finds it empty.
+    instance.drain();
+    BOOST_REQUIRE_EQUAL(results.size(), 3u);
+    instance.drain();
+    BOOST_REQUIRE_EQUAL(results.size(), 3u);
+    BOOST_REQUIRE(instance.enqueue(drain, make_share(job, 4, 1, results)));
+    BOOST_REQUIRE(drain);
+}
+
+BOOST_AUTO_TEST_CASE(share_validator__validate__shares__expected_hashes)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    settings.stratum_v1.payout_address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+    stratum_jobs jobs{ settings };
+    const auto job = make_job(jobs);
+
+    constexpr uint32_t count = 4;
+    std::vector<result> results{};
+    for (uint32_t nonce{}; nonce < count; ++nonce)
+        share_validator::validate(make_share(job, nonce, 1, results));
+
+    BOOST_REQUIRE_EQUAL(results.size(), count);
+
+    const auto coinbase = stratum_jobs::coinbase(*job, 7, { 1, 2, 3, 4 });
+    for (uint32_t nonce{}; nonce < count; ++nonce)
+    {
+        const auto header = stratum_jobs::header(*job, bitcoin_hash(coinbase),
+            job->time, nonce);
+        const auto& value = results.at(nonce);
+        BOOST_REQUIRE_EQUAL(value.hash, bitcoin_hash(header));
+
+        // Arbitrary nonces are (overwhelmingly) not difficulty one shares.
+        BOOST_REQUIRE_EQUAL(value.ec, server::error::low_difficulty);
+        BOOST_REQUIRE(!value.block);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stratum_accounts_tests)
+
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_CASE(stratum_accounts__counter__same_worker__same_counter)
+{
+    stratum_accounts instance{};
+    const auto counter = instance.counter("a");
+    BOOST_REQUIRE(counter);
+    BOOST_REQUIRE(counter == instance.counter("a"));
+    BOOST_REQUIRE(counter != instance.counter("b"));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_accounts__counter__full_held__null)
+{
+    stratum_accounts instance{ 2 };
+    const auto a = instance.counter("a");
+    const auto b = instance.counter("b");
+    BOOST_REQUIRE(!instance.counter("c"));
+    BOOST_REQUIRE(a == instance.counter("a"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(stratum_accounts__counter__full_idle__evicted)
+{
+    stratum_accounts instance{ 2 };
+    const auto a = instance.counter("a");
+    BOOST_REQUIRE(instance.counter("b"));
+    BOOST_REQUIRE(instance.counter("c"));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(a == instance.counter("a"));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_accounts__aggregate__workers__sorted_totals)
+{
+    stratum_accounts instance{};
+    instance.counter("b")->rejected += 2;
+    const auto counter = instance.counter("a");
+    counter->accepted += 3;
+    counter->work += 24;
+    counter->blocks += 1;
+
+    const auto summaries = instance.aggregate();
+    BOOST_REQUIRE_EQUAL(summaries.size(), 2u);
+    BOOST_REQUIRE_EQUAL(summaries.front().worker, "a");
+    BOOST_REQUIRE_EQUAL(summaries.front().accepted, 3u);
+    BOOST_REQUIRE_EQUAL(summaries.front().work, 24u);
+    BOOST_REQUIRE_EQUAL(summaries.front().blocks, 1u);
+    BOOST_REQUIRE_EQUAL(summaries.back().worker, "b");
+    BOOST_REQUIRE_EQUAL(summaries.back().rejected, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(stratum_accounts__aggregate__window_elapsed__rate)
+{
+    stratum_accounts instance{};
+    instance.counter("a")->accepted += 30;
+
+    const auto now = stratum_accounts::clock::now();
+    BOOST_REQUIRE_EQUAL(instance.aggregate(now).front().shares_per_minute, 0.0);
+
+    // The window is measured from construction, so rate is near 30 per two.
+    const auto later = now + minutes(2);
+    const auto rate = instance.aggregate(later).front().shares_per_minute;
+    BOOST_REQUIRE(rate > 14.0 && rate <= 15.0);
+
+    // Rates are retained within the window.
+    instance.counter("a")->accepted += 30;
+    BOOST_REQUIRE_EQUAL(instance.aggregate(later).front().shares_per_minute,
+        rate);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
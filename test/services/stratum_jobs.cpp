@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stratum_jobs_tests)
+
+using namespace system;
+
+static const server::settings::embedded_pages pages{};
+
+static block_template::cptr make_template(size_t height,
+    bool segwit) NOEXCEPT
+{
+    const auto out = std::make_shared<block_template>();
+    out->previous = one_hash;
+    out->height = height;
+    out->version = block_templates::version;
+    out->bits = 0x1d00ffff;
+    out->mintime = 42;
+    out->coinbase_value = 5'000'000'000;
+    out->segwit = segwit;
+    out->witness_commitment = block_templates::empty_commitment();
+    return out;
+}
+
+static void set_payout(server::settings& settings) NOEXCEPT
+{
+    settings.stratum_v1.payout_address = "1A1zP1eP5QGefi2DMPTfTL5SLmv7DivfNa";
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__enabled__no_payout__false_no_jobs)
+{
+    const server::settings settings{ chain::selection::mainnet, pages, pages };
+    stratum_jobs instance{ settings };
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE(!instance.update(make_template(10, false)));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__extranonce1__repeated__unique)
+{
+    const server::settings settings{ chain::selection::mainnet, pages, pages };
+    stratum_jobs instance{ settings };
+    BOOST_REQUIRE_NE(instance.extranonce1(), instance.extranonce1());
+    BOOST_REQUIRE_EQUAL(instance.extranonce2_size(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__update__same_template__same_job)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+    BOOST_REQUIRE(instance.enabled());
+
+    const auto source = make_template(10, false);
+    const auto job = instance.update(source);
+    BOOST_REQUIRE(job);
+    BOOST_REQUIRE(job == instance.update(source));
+    BOOST_REQUIRE(job == instance.find(job->id));
+    BOOST_REQUIRE(job->branch.empty());
+    BOOST_REQUIRE(job->notification.find("\"mining.notify\"") !=
+        std::string::npos);
+    BOOST_REQUIRE_EQUAL(job->notification.back(), '\n');
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__update__transactions__branch_of_txids)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+
+    const auto tx = std::make_shared<template_tx>();
+    tx->txid = one_hash;
+    const auto source = std::const_pointer_cast<block_template>(
+        make_template(10, false));
+    source->transactions.push_back(tx);
+
+    const auto job = instance.update(source);
+    BOOST_REQUIRE(job);
+    BOOST_REQUIRE_EQUAL(job->branch, hashes{ one_hash });
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__update__new_template__prior_job_found)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+
+    const auto prior = instance.update(make_template(10, false));
+    const auto job = instance.update(make_template(11, false));
+    BOOST_REQUIRE(job != prior);
+    BOOST_REQUIRE_NE(job->id, prior->id);
+    BOOST_REQUIRE(instance.find(prior->id) == prior);
+    BOOST_REQUIRE(!instance.find("bogus"));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__coinbase__extranonces__valid_coinbase)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+
+    const auto job = instance.update(make_template(500'000, true));
+    const auto data = stratum_jobs::coinbase(*job, 7, { 1, 2, 3, 4 });
+    const chain::transaction tx{ data, false };
+    BOOST_REQUIRE(tx.is_valid());
+    BOOST_REQUIRE(tx.is_coinbase());
+    BOOST_REQUIRE_EQUAL(tx.outputs_ptr()->size(), 2u);
+    BOOST_REQUIRE_EQUAL(tx.outputs_ptr()->front()->value(), 5'000'000'000u);
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__coinbase_hash__prefix__coinbase_txid)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+
+    const auto job = instance.update(make_template(500'000, true));
+    const auto prefix = stratum_jobs::prefix(*job, 7);
+    const auto coinbase = stratum_jobs::coinbase(*job, 7, { 1, 2, 3, 4 });
+    BOOST_REQUIRE_EQUAL(stratum_jobs::coinbase_hash(*job, prefix,
+        { 1, 2, 3, 4 }), bitcoin_hash(coinbase));
+
+    // The prefix is unchanged by use (each share hashes a copy).
+    BOOST_REQUIRE_EQUAL(stratum_jobs::coinbase_hash(*job, prefix,
+        { 1, 2, 3, 5 }), bitcoin_hash(stratum_jobs::coinbase(*job, 7,
+        { 1, 2, 3, 5 })));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__block__segwit__valid_block_with_witness)
+{
+    server::settings settings{ chain::selection::mainnet, pages, pages };
+    set_payout(settings);
+    stratum_jobs instance{ settings };
+
+    const auto job = instance.update(make_template(500'000, true));
+    const auto coinbase = stratum_jobs::coinbase(*job, 7, { 1, 2, 3, 4 });
+    const auto header = stratum_jobs::header(*job, bitcoin_hash(coinbase),
+        job->time, 42);
+    BOOST_REQUIRE_EQUAL(header.size(), chain::header::serialized_size());
+
+    const auto block = stratum_jobs::block(*job, header, coinbase);
+    BOOST_REQUIRE(block);
+    BOOST_REQUIRE_EQUAL(block->hash(), bitcoin_hash(header));
+    BOOST_REQUIRE_EQUAL(block->header().nonce(), 42u);
+    BOOST_REQUIRE(block->is_segregated());
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__merkle_branch__no_txids__empty)
+{
+    BOOST_REQUIRE(stratum_jobs::merkle_branch({}).empty());
+    BOOST_REQUIRE_EQUAL(stratum_jobs::merkle_root(one_hash, {}), one_hash);
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__merkle_root__two_txids__expected)
+{
+    const hash_digest coinbase{ 0x01 };
+    const hash_digest first{ 0x02 };
+    const hash_digest second{ 0x03 };
+    const auto branch = stratum_jobs::merkle_branch({ first, second });
+    BOOST_REQUIRE_EQUAL(branch.size(), 2u);
+
+    const auto left = bitcoin_hash(splice(coinbase, first));
+    const auto right = bitcoin_hash(splice(second, second));
+    BOOST_REQUIRE_EQUAL(stratum_jobs::merkle_root(coinbase, branch),
+        bitcoin_hash(splice(left, right)));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__share_target__difficulty_one__pool_target)
+{
+    BOOST_REQUIRE(stratum_jobs::share_target(1) == chain::compact::expand(0x1d00ffff));
+    BOOST_REQUIRE(stratum_jobs::share_target(0) == stratum_jobs::share_target(1));
+    BOOST_REQUIRE(stratum_jobs::share_target(2) < stratum_jobs::share_target(1));
+}
+
+BOOST_AUTO_TEST_CASE(stratum_jobs__to_prevhash__hash__words_swapped)
+{
+    hash_digest hash{};
+    hash[0] = 0x01;
+    hash[3] = 0x04;
+    const auto text = stratum_jobs::to_prevhash(hash);
+    BOOST_REQUIRE_EQUAL(text.substr(0, 8), "04000001");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(transaction_batch_tests)
+
+using duration = transaction_batch::duration;
+
+BOOST_AUTO_TEST_CASE(transaction_batch__push__first__window)
+{
+    transaction_batch instance{ duration{ 50 }, 10 };
+    const auto delay = instance.push(1);
+    BOOST_REQUIRE(delay.has_value());
+    BOOST_REQUIRE(delay.value() == duration{ 50 });
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_batch__push__subsequent__no_drain)
+{
+    transaction_batch instance{ duration{ 50 }, 10 };
+    BOOST_REQUIRE(instance.push(1).has_value());
+    BOOST_REQUIRE(!instance.push(2).has_value());
+    BOOST_REQUIRE(!instance.push(3).has_value());
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(transaction_batch__push__filled__zero_delay)
+{
+    transaction_batch instance{ duration{ 50 }, 3 };
+    BOOST_REQUIRE(instance.push(1).has_value());
+    BOOST_REQUIRE(!instance.push(2).has_value());
+
+    const auto delay = instance.push(3);
+    BOOST_REQUIRE(delay.has_value());
+    BOOST_REQUIRE(delay.value() == duration::zero());
+}
+
+// A zero maximum is treated as one (every event drained immediately).
+BOOST_AUTO_TEST_CASE(transaction_batch__push__zero_maximum__zero_delay)
+{
+    transaction_batch instance{ duration{ 50 }, 0 };
+    const auto delay = instance.push(1);
+    BOOST_REQUIRE(delay.has_value());
+    BOOST_REQUIRE(delay.value() == duration::zero());
+}
+
+BOOST_AUTO_TEST_CASE(transaction_batch__pop__accumulated__ordered_and_emptied)
+{
+    transaction_batch instance{ duration{ 0 }, 10 };
+    instance.push(3);
+    instance.push(1);
+    instance.push(2);
+
+    const auto links = instance.pop();
+    BOOST_REQUIRE_EQUAL(links.size(), 3u);
+    BOOST_REQUIRE_EQUAL(links[0], 3u);
+    BOOST_REQUIRE_EQUAL(links[1], 1u);
+    BOOST_REQUIRE_EQUAL(links[2], 2u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.pop().empty());
+}
+
+// A push following a drain starts a new batch.
+BOOST_AUTO_TEST_CASE(transaction_batch__push__after_pop__window)
+{
+    transaction_batch instance{ duration{ 50 }, 10 };
+    instance.push(1);
+    instance.push(2);
+    instance.pop();
+
+    const auto delay = instance.push(3);
+    BOOST_REQUIRE(delay.has_value());
+    BOOST_REQUIRE(delay.value() == duration{ 50 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
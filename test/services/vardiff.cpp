@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(vardiff_tests)
+
+using namespace std::chrono;
+using settings_t = server::settings::stratum_v1_server;
+
+static settings_t make_settings(uint32_t difficulty, uint32_t rate) NOEXCEPT
+{
+    settings_t settings{ "stratum_v1" };
+    settings.share_difficulty = difficulty;
+    settings.share_rate = rate;
+    settings.retarget_seconds = 60;
+    settings.maximum_difficulty = 1'000;
+    return settings;
+}
+
+BOOST_AUTO_TEST_CASE(vardiff__enabled__zero_rate__false_unchanged)
+{
+    const vardiff::clock::time_point start{};
+    vardiff instance{ make_settings(8, 0), start };
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE(!instance.accept(start + minutes(5)));
+    BOOST_REQUIRE_EQUAL(instance.difficulty(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(vardiff__accept__fast_shares__raised_early)
+{
+    const vardiff::clock::time_point start{};
+    vardiff instance{ make_settings(8, 10), start };
+    BOOST_REQUIRE(instance.enabled());
+
+    // Ten shares (one interval of shares) in six seconds is ten times rate.
+    for (auto share = 1; share < 10; ++share)
+        BOOST_REQUIRE(!instance.accept(start + seconds(share)));
+
+    BOOST_REQUIRE(instance.accept(start + seconds(6)));
+    BOOST_REQUIRE_EQUAL(instance.difficulty(), 8u * 4u);
+}
+
+BOOST_AUTO_TEST_CASE(vardiff__retarget__no_shares__lowered)
+{
+    const vardiff::clock::time_point start{};
+    vardiff instance{ make_settings(8, 10), start };
+    BOOST_REQUIRE(!instance.retarget(start + seconds(30)));
+    BOOST_REQUIRE(instance.retarget(start + seconds(60)));
+    BOOST_REQUIRE_EQUAL(instance.difficulty(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(vardiff__retarget__rate_within_tolerance__unchanged)
+{
+    const vardiff::clock::time_point start{};
+    vardiff instance{ make_settings(8, 10), start };
+    for (auto share = 1; share < 9; ++share)
+        BOOST_REQUIRE(!instance.accept(start + seconds(share)));
+
+    // Eight shares per minute is within tolerance of ten.
+    BOOST_REQUIRE(!instance.retarget(start + seconds(60)));
+    BOOST_REQUIRE_EQUAL(instance.difficulty(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(vardiff__retarget__above_maximum__maximum)
+{
+    const vardiff::clock::time_point start{};
+    vardiff instance{ make_settings(800, 1), start };
+    BOOST_REQUIRE(instance.accept(start + seconds(1)));
+    BOOST_REQUIRE_EQUAL(instance.difficulty(), 1'000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
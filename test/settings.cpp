@@ -205,6 +205,9 @@ BOOST_AUTO_TEST_CASE(server__bitcoind_server__defaults__expected)
     BOOST_REQUIRE_EQUAL(server.server, BC_HTTP_SERVER_NAME);
     BOOST_REQUIRE(server.hosts.empty());
     BOOST_REQUIRE(server.host_names().empty());
+
+    // bitcoind_server
+    BOOST_REQUIRE_EQUAL(server.block_stats_cache, 4'096u);
 }
 
 BOOST_AUTO_TEST_CASE(server__electrum_server__defaults__expected)
@@ -236,6 +239,8 @@ BOOST_AUTO_TEST_CASE(server__electrum_server__defaults__expected)
     BOOST_REQUIRE_EQUAL(server.maximum_headers, 10u * 2016u);
     BOOST_REQUIRE_EQUAL(server.maximum_history, 1'000'000u);
     BOOST_REQUIRE_EQUAL(server.maximum_subscriptions, 1'000'000u);
+    BOOST_REQUIRE_EQUAL(server.query_deadline, 60'000u);
+    BOOST_REQUIRE(server.query_deadlines.empty());
     BOOST_REQUIRE_EQUAL(server.protocol_minimum, version(1, 0, 0, 0));
     BOOST_REQUIRE_EQUAL(server.protocol_maximum, version(1, 7, 0, 0));
     BOOST_REQUIRE_EQUAL(server.server_name, BC_USER_AGENT);
@@ -271,6 +276,17 @@ BOOST_AUTO_TEST_CASE(server__stratum_v1_server__defaults__expected)
     BOOST_REQUIRE(server.cert_path.empty());
     BOOST_REQUIRE(server.key_path.empty());
     BOOST_REQUIRE(server.key_pass.empty());
+
+    // stratum_v1_server
+    BOOST_REQUIRE(server.payout_address.empty());
+    BOOST_REQUIRE_EQUAL(server.extranonce2_size, 4u);
+    BOOST_REQUIRE_EQUAL(server.share_difficulty, 1u);
+    BOOST_REQUIRE_EQUAL(server.share_rate, 20u);
+    BOOST_REQUIRE_EQUAL(server.retarget_seconds, 120u);
+    BOOST_REQUIRE_EQUAL(server.maximum_difficulty, 1'000'000'000u);
+    BOOST_REQUIRE_EQUAL(server.maximum_workers, 16u);
+    BOOST_REQUIRE_EQUAL(server.maximum_accounts, 10'000u);
+    BOOST_REQUIRE_EQUAL(server.maximum_shares, 4'096u);
 }
 
 BOOST_AUTO_TEST_CASE(server__stratum_v2_server__defaults__expected)
@@ -291,4 +307,55 @@ BOOST_AUTO_TEST_CASE(server__stratum_v2_server__defaults__expected)
     BOOST_REQUIRE(server.expiration() == minutes(60));
 }
 
+BOOST_AUTO_TEST_CASE(server__executors__defaults__expected)
+{
+    const server::settings::embedded_pages admin{};
+    const server::settings::embedded_pages native{};
+    const server::settings instance{ selection::none, native, admin };
+    const auto& pools = instance.pools;
+
+    for (const auto& pool:
+    {
+        pools.admin, pools.native, pools.bitcoind, pools.btcd,
+        pools.electrum, pools.stratum_v1, pools.stratum_v2
+    })
+    {
+        BOOST_REQUIRE_EQUAL(pool.threads, 0u);
+        BOOST_REQUIRE(pool.cpus.empty());
+        BOOST_REQUIRE_EQUAL(pool.numa_node, -1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(server__limiters__defaults__expected)
+{
+    const server::settings::embedded_pages admin{};
+    const server::settings::embedded_pages native{};
+    const server::settings instance{ selection::none, native, admin };
+    const auto& limits = instance.limits;
+
+    for (const auto& limit: { limits.bitcoind, limits.btcd, limits.electrum })
+    {
+        BOOST_REQUIRE_EQUAL(limit.rate, 0u);
+        BOOST_REQUIRE_EQUAL(limit.burst, 100u);
+        BOOST_REQUIRE_EQUAL(limit.cost, 1u);
+        BOOST_REQUIRE(limit.costs.empty());
+        BOOST_REQUIRE_EQUAL(limit.query_msecs, 10u);
+        BOOST_REQUIRE_EQUAL(limit.query_rows, 100u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(server__coalescers__defaults__expected)
+{
+    const server::settings::embedded_pages admin{};
+    const server::settings::embedded_pages native{};
+    const server::settings instance{ selection::none, native, admin };
+    const auto& batches = instance.batches;
+
+    for (const auto& batch: { batches.native, batches.electrum })
+    {
+        BOOST_REQUIRE_EQUAL(batch.window_msecs, 0u);
+        BOOST_REQUIRE_EQUAL(batch.maximum_batch, 1'000u);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
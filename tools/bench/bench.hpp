@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BS_BENCH_BENCH_HPP
+#define LIBBITCOIN_BS_BENCH_BENCH_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <bitcoin/server.hpp>
+
+namespace libbitcoin {
+namespace server {
+namespace bench {
+
+/// A named operation, timed over repeated invocation.
+struct benchmark
+{
+    std::string name;
+    std::function<void()> operation;
+};
+
+/// Benchmarks registered by static initialization (see BS_BENCHMARK).
+std::vector<benchmark>& registry();
+
+/// Adds the benchmark to the registry, returns true.
+bool enroll(const std::string& name, std::function<void()>&& operation);
+
+/// Prevent the optimizer from discarding an otherwise unused result.
+template <typename Type>
+inline void keep(const Type& value)
+{
+#if defined(HAVE_MSC)
+    static const void* volatile sink{};
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+} // namespace bench
+} // namespace server
+} // namespace libbitcoin
+
+#define BS_BENCH_JOIN_(left, right) left##right
+#define BS_BENCH_JOIN(left, right) BS_BENCH_JOIN_(left, right)
+
+/// Register a benchmark by name, where the body is the timed operation.
+#define BS_BENCHMARK(name, ...) \
+    static const bool BS_BENCH_JOIN(enrolled_, __LINE__) = \
+        libbitcoin::server::bench::enroll(name, __VA_ARGS__)
+
+#endif
@@ -0,0 +1,278 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace bc;
+using namespace bc::server;
+using namespace bc::server::bench;
+using namespace std::chrono;
+
+// Allocation counting.
+// ----------------------------------------------------------------------------
+// Global replacement counts every heap allocation, so each result reports
+// allocations per operation (the primary target of parser optimization).
+
+static std::atomic<size_t> allocations{};
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(one, std::memory_order_relaxed);
+    if (const auto block = std::malloc(std::max(one, size)))
+        return block;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    std::free(block);
+}
+
+// Registry.
+// ----------------------------------------------------------------------------
+
+namespace libbitcoin {
+namespace server {
+namespace bench {
+
+std::vector<benchmark>& registry()
+{
+    static std::vector<benchmark> benchmarks{};
+    return benchmarks;
+}
+
+bool enroll(const std::string& name, std::function<void()>&& operation)
+{
+    registry().push_back({ name, std::move(operation) });
+    return true;
+}
+
+} // namespace bench
+} // namespace server
+} // namespace libbitcoin
+
+// Runner.
+// ----------------------------------------------------------------------------
+
+constexpr auto usage =
+    "Usage: bs-bench [--filter <substring>] [--min_time <ms>] "
+    "[--repetitions <n>]\n"
+    "    [--format text|json] [--out <file>] [--list]";
+
+struct options
+{
+    std::string filter{};
+    size_t min_time{ 500 };
+    size_t repetitions{ 5 };
+    std::string format{ "text" };
+    std::string out{};
+    bool list{};
+};
+
+struct result
+{
+    std::string name;
+    size_t iterations;
+    double median_ns;
+    double min_ns;
+    double max_ns;
+    double allocations;
+};
+
+static bool parse(options& config, int argc, const char* argv[])
+{
+    try
+    {
+        for (auto index = 1; index < argc; ++index)
+        {
+            const std::string name{ argv[index] };
+            if (name == "--list")
+            {
+                config.list = true;
+                continue;
+            }
+
+            if (++index == argc)
+                return false;
+
+            const std::string value{ argv[index] };
+            if (name == "--filter")
+                config.filter = value;
+            else if (name == "--min_time")
+                config.min_time = std::stoul(value);
+            else if (name == "--repetitions")
+                config.repetitions = std::stoul(value);
+            else if (name == "--format")
+                config.format = value;
+            else if (name == "--out")
+                config.out = value;
+            else
+                return false;
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return !is_zero(config.repetitions) &&
+        (config.format == "text" || config.format == "json");
+}
+
+// Nanoseconds per operation over the given number of iterations.
+static double measure(const benchmark& bench, size_t iterations)
+{
+    const auto start = steady_clock::now();
+    for (size_t count{}; count < iterations; ++count)
+        bench.operation();
+
+    const auto span = duration_cast<nanoseconds>(steady_clock::now() - start);
+    return 1.0 * span.count() / iterations;
+}
+
+// Iterations double until one run takes min_time, then each repetition is
+// timed at that count and the median is reported.
+static result run(const benchmark& bench, const options& config)
+{
+    const auto target = 1'000'000.0 * config.min_time;
+    size_t iterations{ 1 };
+    while ((measure(bench, iterations) * iterations) < target &&
+        iterations < (max_size_t / 2u))
+        iterations *= 2u;
+
+    const auto before = allocations.load(std::memory_order_relaxed);
+    std::vector<double> times{};
+    for (size_t repeat{}; repeat < config.repetitions; ++repeat)
+        times.push_back(measure(bench, iterations));
+
+    const auto after = allocations.load(std::memory_order_relaxed);
+    std::sort(times.begin(), times.end());
+    return
+    {
+        bench.name,
+        iterations,
+        times.at(times.size() / 2u),
+        times.front(),
+        times.back(),
+        1.0 * (after - before) / (iterations * config.repetitions)
+    };
+}
+
+// Field names follow Google Benchmark json, so existing comparison tooling
+// (e.g. compare.py) can diff two runs.
+static void write_json(std::ostream& out, const std::vector<result>& results,
+    const options& config)
+{
+    out << "{\n  \"context\": {\"executable\": \"bs-bench\", "
+        << "\"repetitions\": " << config.repetitions << ", "
+        << "\"min_time_ms\": " << config.min_time << "},\n"
+        << "  \"benchmarks\": [";
+
+    auto first = true;
+    for (const auto& value: results)
+    {
+        out << (first ? "\n" : ",\n") << "    {\"name\": \"" << value.name
+            << "\", \"iterations\": " << value.iterations
+            << ", \"real_time\": " << value.median_ns
+            << ", \"cpu_time\": " << value.median_ns
+            << ", \"min_time\": " << value.min_ns
+            << ", \"max_time\": " << value.max_ns
+            << ", \"time_unit\": \"ns\""
+            << ", \"allocations\": " << value.allocations << "}";
+        first = false;
+    }
+
+    out << "\n  ]\n}" << std::endl;
+}
+
+static void write_text(std::ostream& out, const std::vector<result>& results)
+{
+    for (const auto& value: results)
+        out << boost_format("%-44s %12.1f ns %10.1f allocs (min %.1f max "
+            "%.1f, %d iterations)") % value.name % value.median_ns %
+            value.allocations % value.min_ns % value.max_ns %
+            value.iterations << std::endl;
+}
+
+int main(int argc, const char* argv[])
+{
+    options config{};
+    if (!parse(config, argc, argv))
+    {
+        std::cerr << usage << std::endl;
+        return -1;
+    }
+
+    auto benchmarks = registry();
+    std::sort(benchmarks.begin(), benchmarks.end(),
+        [](const auto& left, const auto& right)
+        {
+            return left.name < right.name;
+        });
+
+    std::vector<result> results{};
+    for (const auto& bench: benchmarks)
+    {
+        if (bench.name.find(config.filter) == std::string::npos)
+            continue;
+
+        if (config.list)
+            std::cout << bench.name << std::endl;
+        else
+            results.push_back(run(bench, config));
+    }
+
+    if (config.list)
+        return 0;
+
+    std::ofstream file{};
+    if (!config.out.empty())
+    {
+        file.open(config.out);
+        if (!file.good())
+        {
+            std::cerr << "Cannot open " << config.out << std::endl;
+            return -1;
+        }
+    }
+
+    auto& out = config.out.empty() ? std::cout : file;
+    if (config.format == "json")
+        write_json(out, results, config);
+    else
+        write_text(out, results);
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace libbitcoin {
+namespace server {
+namespace bench {
+
+using namespace network::rpc;
+using namespace network::http;
+
+// Request targets as issued by explorer and rest clients, composed once so
+// that only the parse is timed.
+static const std::string block_hash
+{
+    "000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"
+};
+
+static const std::string native_filter
+{
+    "/v3/block/hash/" + block_hash + "/filter/0"
+};
+
+static const std::string native_details{ "/v3/tx/" + block_hash + "/details" };
+static const std::string native_address{ "/v3/address/" + block_hash };
+static const std::string native_height{ "/v3/block/height/123456" };
+static const std::string native_witness
+{
+    "/v3/tx/" + block_hash + "?format=json&witness=false"
+};
+
+static const std::string native_top{ "/v3/top" };
+static const std::string rest_block{ "/rest/block/" + block_hash + ".bin" };
+static const std::string rest_headers
+{
+    "/rest/headers/2000/" + block_hash + ".json"
+};
+
+static const media_types browser
+{
+    media_type::text_html,
+    media_type::application_json
+};
+
+// The model overload is selected by the parameter type (native_target is
+// overloaded on the output type).
+using target_parser = code(*)(request_t&, const std::string_view&);
+
+static void parse_target(target_parser parser, const std::string_view& target)
+{
+    request_t out{};
+    const auto ec = parser(out, target);
+    keep(ec);
+    keep(out);
+}
+
+// Parse into the compact descriptor, as dispatched by protocol_native.
+static void parse_request(const std::string_view& target,
+    const media_types& accepts)
+{
+    native_request out{};
+    keep(native_target(out, target));
+    keep(native_query(out, target, accepts));
+    keep(out);
+}
+
+// native_target
+// ----------------------------------------------------------------------------
+
+BS_BENCHMARK("native_target/top", []()
+{
+    parse_target(&native_target, "/v3/top");
+});
+
+BS_BENCHMARK("native_target/block_height", []()
+{
+    parse_target(&native_target, native_height);
+});
+
+BS_BENCHMARK("native_target/block_hash_filter", []()
+{
+    parse_target(&native_target, native_filter);
+});
+
+BS_BENCHMARK("native_target/tx_details", []()
+{
+    parse_target(&native_target, native_details);
+});
+
+BS_BENCHMARK("native_target/address", []()
+{
+    parse_target(&native_target, native_address);
+});
+
+// native_query
+// ----------------------------------------------------------------------------
+
+static void parse_query(const std::string& target, const media_types& accepts)
+{
+    request_t out{};
+    out.params = object_t{};
+    keep(native_query(out, target, accepts));
+    keep(out);
+}
+
+BS_BENCHMARK("native_query/none", []()
+{
+    parse_query(native_height, {});
+});
+
+BS_BENCHMARK("native_query/format_witness", []()
+{
+    parse_query(native_witness, {});
+});
+
+BS_BENCHMARK("native_query/accepts", []()
+{
+    parse_query(native_top, browser);
+});
+
+// native_request
+// ----------------------------------------------------------------------------
+
+BS_BENCHMARK("native_request/top", []()
+{
+    parse_request(native_top, browser);
+});
+
+BS_BENCHMARK("native_request/block_hash_filter", []()
+{
+    parse_request(native_filter, {});
+});
+
+BS_BENCHMARK("native_request/tx_witness", []()
+{
+    parse_request(native_witness, {});
+});
+
+// bitcoind_target
+// ----------------------------------------------------------------------------
+
+BS_BENCHMARK("bitcoind_target/chaininfo", []()
+{
+    parse_target(&bitcoind_target, "/rest/chaininfo.json");
+});
+
+BS_BENCHMARK("bitcoind_target/block", []()
+{
+    parse_target(&bitcoind_target, rest_block);
+});
+
+BS_BENCHMARK("bitcoind_target/headers", []()
+{
+    parse_target(&bitcoind_target, rest_headers);
+});
+
+// admin_target
+// ----------------------------------------------------------------------------
+
+BS_BENCHMARK("admin_target/log_subscribe", []()
+{
+    parse_target(&admin_target, "/v1/log/subscribe");
+});
+
+BS_BENCHMARK("admin_target/metrics", []()
+{
+    parse_target(&admin_target, "/v1/metrics");
+});
+
+// electrum_version
+// ----------------------------------------------------------------------------
+
+BS_BENCHMARK("electrum_version/from_string", []()
+{
+    system::config::version out{};
+    keep(electrum::version_from_string(out, "1.4.2"));
+    keep(out);
+});
+
+BS_BENCHMARK("electrum_version/floor", []()
+{
+    const system::config::version value{ 1, 5, 0, 0 };
+    keep(electrum::version_floor(value));
+});
+
+BS_BENCHMARK("electrum_version/to_string", []()
+{
+    keep(electrum::version_to_string(electrum::version::v1_6));
+});
+
+} // namespace bench
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bench.hpp"
+#include "../../test/mocks/blocks.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace libbitcoin {
+namespace server {
+namespace bench {
+
+using namespace system;
+using namespace system::chain;
+
+// Transactions in synthetic blocks (a typical mainnet block).
+constexpr size_t block_txs = 2'500;
+constexpr uint64_t subsidy = 312'500'000;
+
+// block_stats
+// ----------------------------------------------------------------------------
+
+// Coinbase and paying txs with populated prevouts and distinct fees.
+static block make_paying_block()
+{
+    transactions txs{};
+    txs.reserve(block_txs);
+    txs.push_back({ 1, inputs{ { point{}, script{}, 0 } },
+        outputs{ { subsidy, script{} } }, 0 });
+
+    for (size_t index{ 1 }; index < block_txs; ++index)
+    {
+        const auto value = 100'000u + index;
+        transaction tx{ 1, inputs{ { point{ one_hash,
+            possible_narrow_cast<uint32_t>(index) }, script{}, 0 } },
+            outputs{ { value - 100u - index % 1'000u, script{} } }, 0 };
+        tx.inputs_ptr()->front()->prevout = to_shared<output>(value,
+            script{});
+        txs.push_back(std::move(tx));
+    }
+
+    return { header{ 1, null_hash, null_hash, 42, 0x1d00ffff, 0 },
+        std::move(txs) };
+}
+
+static const block& paying_block()
+{
+    static const auto value = make_paying_block();
+    return value;
+}
+
+BS_BENCHMARK("block_stats/summary", []()
+{
+    keep(block_summary(paying_block(), 840'000, 42, false));
+});
+
+BS_BENCHMARK("block_stats/record", []()
+{
+    static const auto record = block_summary(paying_block(), 840'000, 42,
+        false);
+    keep(block_stats(record, null_hash, subsidy));
+});
+
+BS_BENCHMARK("block_stats/block", []()
+{
+    keep(block_stats(paying_block(), 840'000, 42, subsidy, false));
+});
+
+// build_partial_merkle
+// ----------------------------------------------------------------------------
+
+static const hashes& block_txids()
+{
+    static const auto value = []()
+    {
+        hashes out(block_txs);
+        for (size_t index{}; index < block_txs; ++index)
+            out.at(index) = sha256_hash(to_little_endian(index));
+
+        return out;
+    }();
+
+    return value;
+}
+
+// Every stride-th tx is matched.
+static std::vector<bool> make_match(size_t stride)
+{
+    std::vector<bool> out(block_txs, false);
+    for (size_t index{}; index < block_txs; index += stride)
+        out.at(index) = true;
+
+    return out;
+}
+
+static void partial_merkle(const std::vector<bool>& match)
+{
+    data_chunk flags{};
+    hashes branch{};
+    build_partial_merkle(flags, branch, block_txids(), match);
+    keep(flags);
+    keep(branch);
+}
+
+BS_BENCHMARK("partial_merkle/one_match", []()
+{
+    static const auto match = make_match(block_txs);
+    partial_merkle(match);
+});
+
+BS_BENCHMARK("partial_merkle/one_percent", []()
+{
+    static const auto match = make_match(100);
+    partial_merkle(match);
+});
+
+// to_bin/to_hex
+// ----------------------------------------------------------------------------
+// The writer compositions of protocol_native::to_bin and ::to_hex (which are
+// private), over a mock block and its coinbase.
+
+template <typename Object>
+static data_chunk to_bin(const Object& object, size_t size, bool witness)
+{
+    data_chunk out(size);
+    stream::out::fast sink{ out };
+    write::bytes::fast writer{ sink };
+    object.to_data(writer, witness);
+    return out;
+}
+
+template <typename Object>
+static std::string to_hex(const Object& object, size_t size, bool witness)
+{
+    std::string out(two * size, '\0');
+    stream::out::fast sink{ out };
+    write::base16::fast writer{ sink };
+    object.to_data(writer, witness);
+    return out;
+}
+
+BS_BENCHMARK("to_bin/block", []()
+{
+    const auto& block = paying_block();
+    keep(to_bin(block, block.serialized_size(true), true));
+});
+
+BS_BENCHMARK("to_hex/block", []()
+{
+    const auto& block = paying_block();
+    keep(to_hex(block, block.serialized_size(true), true));
+});
+
+BS_BENCHMARK("to_bin/tx", []()
+{
+    const auto& tx = *test::block9.transactions_ptr()->front();
+    keep(to_bin(tx, tx.serialized_size(true), true));
+});
+
+BS_BENCHMARK("to_hex/tx", []()
+{
+    const auto& tx = *test::block9.transactions_ptr()->front();
+    keep(to_hex(tx, tx.serialized_size(true), true));
+});
+
+} // namespace bench
+} // namespace server
+} // namespace libbitcoin
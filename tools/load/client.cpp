@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "load.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+
+namespace libbitcoin {
+namespace server {
+namespace load {
+
+using namespace boost::beast;
+using string_request = http::request<http::string_body>;
+using string_response = http::response<http::string_body>;
+
+// Electrum requires version negotiation before address queries.
+constexpr auto electrum_handshake =
+    R"({"id":0,"method":"server.version","params":["bs-load","1.4"]})" "\n";
+
+client::client(const options& config)
+  : config_(config)
+{
+}
+
+client::~client()
+{
+    network::boost_code ec{};
+    if (websocket_.has_value())
+        websocket_.value().close(websocket::close_code::normal, ec);
+
+    if (electrum_.has_value())
+        electrum_.value().close(ec);
+
+    if (http_.has_value())
+        http_.value().close(ec);
+}
+
+bool client::send(const request& value, size_t& bytes)
+{
+    switch (value.transport)
+    {
+        case transport::electrum:
+            return send_electrum(value.body, bytes);
+        case transport::http:
+            return send_http(value, bytes);
+        case transport::websocket:
+            return send_websocket(value.body, bytes);
+        default:
+            return false;
+    }
+}
+
+bool client::send_electrum(const std::string& body, size_t& bytes)
+{
+    network::boost_code ec{};
+    const auto exchange = [&](const std::string& line)
+    {
+        boost::asio::write(electrum_.value(), boost::asio::buffer(line), ec);
+        if (ec)
+            return false;
+
+        bytes = boost::asio::read_until(electrum_.value(), electrum_buffer_,
+            '\n', ec);
+        if (ec)
+            return false;
+
+        const auto data = electrum_buffer_.data();
+        const std::string response{ boost::asio::buffers_begin(data),
+            std::next(boost::asio::buffers_begin(data), bytes) };
+        electrum_buffer_.consume(bytes);
+        return is_success(response);
+    };
+
+    if (!electrum_.has_value())
+    {
+        electrum_.emplace(io_);
+        electrum_.value().connect(config_.electrum.to_endpoint(), ec);
+        if (ec || !exchange(electrum_handshake))
+        {
+            electrum_.reset();
+            return false;
+        }
+    }
+
+    // An error response is a failure, but the connection remains usable.
+    if (!exchange(body + "\n"))
+    {
+        if (ec)
+            electrum_.reset();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool client::send_http(const request& value, size_t& bytes)
+{
+    network::boost_code ec{};
+    if (!http_.has_value())
+    {
+        http_.emplace(io_);
+        http_.value().connect(config_.http.to_endpoint(), ec);
+        if (ec)
+        {
+            http_.reset();
+            return false;
+        }
+    }
+
+    const auto get = value.body.empty();
+    string_request out{ get ? http::verb::get : http::verb::post,
+        value.target, network::http::version_1_1 };
+    out.set(http::field::host, "localhost");
+    out.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
+    if (!get)
+    {
+        out.set(http::field::content_type, "application/json");
+        out.body() = value.body;
+        out.prepare_payload();
+    }
+
+    out.keep_alive(true);
+    http::write(http_.value(), out, ec);
+    if (ec)
+    {
+        http_.reset();
+        return false;
+    }
+
+    string_response in{};
+    http::read(http_.value(), http_buffer_, in, ec);
+    if (ec || !in.keep_alive())
+        http_.reset();
+
+    bytes = in.body().size();
+    return !ec && in.result() == http::status::ok;
+}
+
+bool client::send_websocket(const std::string& body, size_t& bytes)
+{
+    network::boost_code ec{};
+    if (!websocket_.has_value())
+    {
+        tcp_.emplace(io_);
+        tcp_.value().connect(config_.websocket.to_endpoint(), ec);
+        if (!ec)
+        {
+            websocket_.emplace(tcp_.value());
+            websocket_.value().text(true);
+            websocket_.value().handshake("localhost", "/", ec);
+        }
+
+        if (ec)
+        {
+            websocket_.reset();
+            tcp_.reset();
+            return false;
+        }
+    }
+
+    websocket_.value().write(boost::asio::buffer(body), ec);
+    if (!ec)
+        bytes = websocket_.value().read(websocket_buffer_, ec);
+
+    if (ec)
+    {
+        websocket_.reset();
+        tcp_.reset();
+        return false;
+    }
+
+    const auto response = buffers_to_string(websocket_buffer_.data());
+    websocket_buffer_.consume(websocket_buffer_.size());
+    return is_success(response);
+}
+
+bool client::is_success(std::string_view response)
+{
+    boost::json::error_code ec{};
+    const auto value = boost::json::parse(response, ec);
+    if (ec || !value.is_object())
+        return false;
+
+    const auto error = value.as_object().if_contains("error");
+    return system::is_null(error) || error->is_null();
+}
+
+} // namespace load
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "load.hpp"
+#include "../../test/mocks/blocks.hpp"
+
+#include <future>
+
+namespace libbitcoin {
+namespace server {
+namespace load {
+
+harness::harness(const options& config)
+  : config_(config),
+    configuration_
+    {
+        system::chain::selection::mainnet,
+        test::web_pages,
+        test::web_pages
+    }
+{
+}
+
+harness::~harness()
+{
+    if (server_.has_value())
+        server_.value().close();
+
+    if (store_.has_value())
+        store_.value().close([](auto, auto) {});
+}
+
+code harness::start()
+{
+    auto& database = configuration_.database;
+    auto& network = configuration_.network;
+    auto& node = configuration_.node;
+    auto& server = configuration_.server;
+
+    // Loopback interfaces, each sized to the client count.
+    using connections = decltype(server.electrum.connections);
+    const auto limit = system::possible_narrow_cast<connections>(
+        config_.clients);
+    server.electrum.binds = { config_.electrum };
+    server.electrum.connections = limit;
+    server.bitcoind.binds = { config_.http };
+    server.bitcoind.connections = limit;
+    server.btcd.binds = { config_.websocket };
+    server.btcd.connections = limit;
+
+    // No peers, the store is seeded from the mock chain.
+    database.path = config_.directory;
+    database.interval_depth = 2;
+    node.delay_inbound = false;
+    network.inbound.connections = 0;
+    network.outbound.connections = 0;
+
+    std::error_code error{};
+    std::filesystem::remove_all(config_.directory, error);
+
+    store_.emplace(database);
+    if (const auto ec = store_.value().create([](auto, auto) {}))
+        return ec;
+
+    query_.emplace(store_.value());
+    if (!test::setup_ten_block_store(query_.value()))
+        return error::server_error;
+
+    server_.emplace(query_.value(), configuration_, log_);
+    std::promise<code> started{};
+    server_.value().start([&](const code& ec) NOEXCEPT
+    {
+        started.set_value(ec);
+    });
+
+    if (const auto ec = started.get_future().get())
+        return ec;
+
+    std::promise<code> running{};
+    server_.value().run([&](const code& ec) NOEXCEPT
+    {
+        running.set_value(ec);
+    });
+
+    return running.get_future().get();
+}
+
+} // namespace load
+} // namespace server
+} // namespace libbitcoin
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_BS_LOAD_LOAD_HPP
+#define LIBBITCOIN_BS_LOAD_LOAD_HPP
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <bitcoin/server.hpp>
+
+namespace libbitcoin {
+namespace server {
+namespace load {
+
+/// Interface over which a request is sent.
+enum class transport
+{
+    /// electrum (tcp, newline-delimited json-rpc).
+    electrum,
+
+    /// bitcoind (http, GET when body is empty, otherwise json-rpc POST).
+    http,
+
+    /// btcd (websocket, json-rpc-v1 text frames).
+    websocket
+};
+
+/// One request, sent as is and timed until its response is read.
+struct request
+{
+    load::transport transport;
+    std::string target{};
+    std::string body{};
+};
+
+using requests = std::vector<request>;
+
+/// Command line options.
+struct options
+{
+    std::string workload{ "history" };
+    std::filesystem::path replay{};
+    std::filesystem::path directory{ "load" };
+    std::string format{ "text" };
+    size_t clients{ 8 };
+    size_t requests{ 1'000 };
+    double skew{ 1.0 };
+    bool external{ false };
+    network::config::endpoint electrum{ "127.0.0.1:65002" };
+    network::config::endpoint http{ "127.0.0.1:65003" };
+    network::config::endpoint websocket{ "127.0.0.1:65004" };
+};
+
+/// Synthetic workloads over the keys of test/mocks/blocks (genesis..block9),
+/// with requests for the given client drawn from a fixed seed.
+requests history(const options& config, size_t client);
+requests headers(const options& config, size_t client);
+requests blocks(const options& config, size_t client);
+
+/// Recorded request log, one request per line as one of:
+/// "electrum <json>", "get <target>", "post <target> <json>", "ws <json>".
+/// Blank lines and lines starting with '#' are skipped.
+std::optional<requests> replay(const std::filesystem::path& path);
+
+/// Synchronous client with one lazily-connected socket per transport.
+class client
+{
+public:
+    DELETE_COPY_MOVE(client);
+
+    client(const options& config);
+    ~client();
+
+    /// Send the request and read its response, false on any failure.
+    bool send(const request& value, size_t& bytes);
+
+private:
+    using socket = boost::asio::ip::tcp::socket;
+    using websocket = boost::beast::websocket::stream<socket&>;
+
+    bool send_electrum(const std::string& body, size_t& bytes);
+    bool send_http(const request& value, size_t& bytes);
+    bool send_websocket(const std::string& body, size_t& bytes);
+
+    /// A json object response without a (non-null) error member.
+    static bool is_success(std::string_view response);
+
+    const options& config_;
+    boost::asio::io_context io_{};
+    std::optional<socket> electrum_{};
+    std::optional<socket> http_{};
+    std::optional<socket> tcp_{};
+    std::optional<websocket> websocket_{};
+    boost::asio::streambuf electrum_buffer_{};
+    boost::beast::flat_buffer http_buffer_{};
+    boost::beast::flat_buffer websocket_buffer_{};
+};
+
+/// Embedded server over a store seeded from test/mocks/blocks, with
+/// electrum, bitcoind and btcd bound to the configured local endpoints.
+class harness
+{
+public:
+    DELETE_COPY_MOVE(harness);
+
+    harness(const options& config);
+    ~harness();
+
+    /// Create and seed the store and run the server.
+    code start();
+
+private:
+    using store_t = database::store<database::mmap>;
+    using query_t = database::query<store_t>;
+
+    const options& config_;
+    configuration configuration_;
+    std::optional<store_t> store_{};
+    std::optional<query_t> query_{};
+    network::logger log_{};
+    std::optional<server_node> server_{};
+};
+
+} // namespace load
+} // namespace server
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "load.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace bc;
+using namespace bc::server;
+using namespace bc::server::load;
+using namespace std::chrono;
+
+constexpr auto usage =
+    "Usage: bs-load [--workload history|headers|blocks|replay] "
+    "[--replay <file>]\n"
+    "    [--clients <n>] [--requests <n>] [--skew <exponent>] "
+    "[--format text|json]\n"
+    "    [--electrum <host:port>] [--http <host:port>] "
+    "[--websocket <host:port>]\n"
+    "    [--directory <store>] [--external]\n"
+    "Runs an embedded server over a store seeded from test/mocks/blocks "
+    "unless\n--external, in which case the endpoints name a running server.";
+
+static bool parse(options& config, int argc, const char* argv[])
+{
+    try
+    {
+        for (auto index = 1; index < argc; ++index)
+        {
+            const std::string name{ argv[index] };
+            if (name == "--external")
+            {
+                config.external = true;
+                continue;
+            }
+
+            if (++index == argc)
+                return false;
+
+            const std::string value{ argv[index] };
+            if (name == "--workload")
+                config.workload = value;
+            else if (name == "--replay")
+                config.replay = value;
+            else if (name == "--clients")
+                config.clients = std::stoul(value);
+            else if (name == "--requests")
+                config.requests = std::stoul(value);
+            else if (name == "--skew")
+                config.skew = std::stod(value);
+            else if (name == "--format")
+                config.format = value;
+            else if (name == "--directory")
+                config.directory = value;
+            else if (name == "--electrum")
+                config.electrum = network::config::endpoint{ value };
+            else if (name == "--http")
+                config.http = network::config::endpoint{ value };
+            else if (name == "--websocket")
+                config.websocket = network::config::endpoint{ value };
+            else
+                return false;
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return !is_zero(config.clients) &&
+        (config.format == "text" || config.format == "json");
+}
+
+// Each client's requests (replayed requests are the same for all clients).
+static std::optional<std::vector<requests>> prepare(const options& config)
+{
+    std::vector<requests> out(config.clients);
+    if (config.workload == "replay")
+    {
+        const auto recorded = replay(config.replay);
+        if (!recorded.has_value() || recorded.value().empty())
+            return {};
+
+        std::fill(out.begin(), out.end(), recorded.value());
+        return out;
+    }
+
+    const auto generate =
+        config.workload == "history" ? &load::history :
+        config.workload == "headers" ? &load::headers :
+        config.workload == "blocks" ? &load::blocks : nullptr;
+
+    if (is_null(generate))
+        return {};
+
+    for (size_t index{}; index < config.clients; ++index)
+        out.at(index) = generate(config, index);
+
+    return out;
+}
+
+int main(int argc, const char* argv[])
+{
+    options config{};
+    if (!parse(config, argc, argv))
+    {
+        std::cerr << usage << std::endl;
+        return -1;
+    }
+
+    const auto workloads = prepare(config);
+    if (!workloads.has_value())
+    {
+        std::cerr << "Invalid workload or replay file." << std::endl;
+        return -1;
+    }
+
+    std::optional<harness> server{};
+    if (!config.external)
+    {
+        server.emplace(config);
+        if (const auto ec = server.value().start())
+        {
+            std::cerr << "Server failed: " << ec.message() << std::endl;
+            return -1;
+        }
+    }
+
+    // Per client latencies (microseconds), failures and response bytes.
+    struct totals
+    {
+        std::vector<uint64_t> latencies{};
+        size_t failed{};
+        size_t bytes{};
+    };
+
+    std::vector<totals> results(config.clients);
+    std::vector<std::thread> clients{};
+    clients.reserve(config.clients);
+
+    const auto start = steady_clock::now();
+    for (size_t index{}; index < config.clients; ++index)
+    {
+        clients.emplace_back([&, index]()
+        {
+            client connection{ config };
+            auto& total = results.at(index);
+            const auto& sequence = workloads.value().at(index);
+            total.latencies.reserve(sequence.size());
+            for (const auto& request: sequence)
+            {
+                size_t bytes{};
+                const auto begin = steady_clock::now();
+                const auto success = connection.send(request, bytes);
+                const auto span = steady_clock::now() - begin;
+                total.latencies.push_back(
+                    duration_cast<microseconds>(span).count());
+                total.bytes += bytes;
+                if (!success)
+                    ++total.failed;
+            }
+        });
+    }
+
+    for (auto& thread: clients)
+        thread.join();
+
+    const auto elapsed = duration_cast<microseconds>(steady_clock::now() -
+        start).count() / 1'000'000.0;
+
+    totals total{};
+    for (auto& result: results)
+    {
+        total.failed += result.failed;
+        total.bytes += result.bytes;
+        total.latencies.insert(total.latencies.end(),
+            result.latencies.begin(), result.latencies.end());
+    }
+
+    // Percentiles by nearest rank.
+    auto& latencies = total.latencies;
+    std::sort(latencies.begin(), latencies.end());
+    const auto rank = [&](double percentile) -> uint64_t
+    {
+        if (latencies.empty())
+            return 0;
+
+        const auto size = latencies.size();
+        return latencies.at(std::min(sub1(size),
+            static_cast<size_t>(percentile * size)));
+    };
+
+    const auto count = latencies.size();
+    const auto rate = is_zero(elapsed) ? 0.0 : count / elapsed;
+    const auto format = config.format == "json" ?
+        "{\"workload\":\"%1%\",\"clients\":%2%,\"requests\":%3%,"
+        "\"failed\":%4%,\"bytes\":%5%,\"seconds\":%6%,\"rate\":%7%,"
+        "\"p50_us\":%8%,\"p90_us\":%9%,\"p99_us\":%10%,\"p999_us\":%11%,"
+        "\"max_us\":%12%}" :
+        "%1%: clients %2% requests %3% failed %4% bytes %5% in %6% secs "
+        "rate %7%/s (us) p50 %8% p90 %9% p99 %10% p999 %11% max %12%";
+
+    std::cout << (boost_format(format) % config.workload % config.clients %
+        count % total.failed % total.bytes % elapsed % rate % rank(0.50) %
+        rank(0.90) % rank(0.99) % rank(0.999) % rank(1.0)) << std::endl;
+
+    return is_zero(total.failed) ? 0 : 1;
+}
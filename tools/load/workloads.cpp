@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "load.hpp"
+#include "../../test/mocks/blocks.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace libbitcoin {
+namespace server {
+namespace load {
+
+using namespace system;
+
+// Seeded per client, so that clients do not issue identical sequences.
+static std::mt19937_64 engine(size_t client)
+{
+    return std::mt19937_64{ 42u + client };
+}
+
+static const std::vector<const chain::block*>& mock_blocks()
+{
+    static const std::vector<const chain::block*> blocks
+    {
+        &test::genesis, &test::block1, &test::block2, &test::block3,
+        &test::block4, &test::block5, &test::block6, &test::block7,
+        &test::block8, &test::block9
+    };
+
+    return blocks;
+}
+
+// Electrum scripthash of each block's coinbase output (one per block).
+static const std::vector<std::string>& scripthashes()
+{
+    static const auto hashes = []()
+    {
+        std::vector<std::string> out{};
+        for (const auto block: mock_blocks())
+        {
+            const auto& coinbase = *block->transactions_ptr()->front();
+            out.push_back(encode_hash(
+                coinbase.outputs_ptr()->front()->script().hash()));
+        }
+
+        return out;
+    }();
+
+    return hashes;
+}
+
+// Address popularity is zipfian, rank k is drawn with weight 1/k^skew.
+requests history(const options& config, size_t client)
+{
+    const auto& keys = scripthashes();
+    std::vector<double> weights{};
+    for (size_t rank{}; rank < keys.size(); ++rank)
+        weights.push_back(1.0 / std::pow(add1(rank), config.skew));
+
+    auto random = engine(client);
+    std::discrete_distribution<size_t> distribution
+    {
+        weights.begin(), weights.end()
+    };
+
+    requests out{};
+    out.reserve(config.requests);
+    for (size_t id{}; id < config.requests; ++id)
+    {
+        const auto body = boost_format(R"({"id":%1%,"method":)"
+            R"("blockchain.scripthash.get_history","params":["%2%"]})") %
+            add1(id) % keys.at(distribution(random));
+        out.push_back({ transport::electrum, {}, body.str() });
+    }
+
+    return out;
+}
+
+// Header sync from a random start height to the top of the mock chain.
+requests headers(const options& config, size_t client)
+{
+    const auto count = mock_blocks().size();
+    auto random = engine(client);
+    std::uniform_int_distribution<size_t> distribution{ zero, sub1(count) };
+
+    requests out{};
+    out.reserve(config.requests);
+    for (size_t id{}; id < config.requests; ++id)
+    {
+        const auto start = distribution(random);
+        const auto body = boost_format(R"({"id":%1%,"method":)"
+            R"("blockchain.block.headers","params":[%2%,%3%]})") %
+            add1(id) % start % (count - start);
+        out.push_back({ transport::electrum, {}, body.str() });
+    }
+
+    return out;
+}
+
+// Raw block downloads over the bitcoind REST interface.
+requests blocks(const options& config, size_t client)
+{
+    const auto& chain = mock_blocks();
+    auto random = engine(client);
+    std::uniform_int_distribution<size_t> distribution
+    {
+        zero, sub1(chain.size())
+    };
+
+    requests out{};
+    out.reserve(config.requests);
+    for (size_t id{}; id < config.requests; ++id)
+    {
+        const auto& block = *chain.at(distribution(random));
+        out.push_back({ transport::http, "/rest/block/" +
+            encode_hash(block.hash()) + ".bin", {} });
+    }
+
+    return out;
+}
+
+std::optional<requests> replay(const std::filesystem::path& path)
+{
+    std::ifstream file{ path };
+    if (!file.good())
+        return {};
+
+    requests out{};
+    std::string line{};
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line.front() == '#')
+            continue;
+
+        const auto space = line.find(' ');
+        if (space == std::string::npos)
+            return {};
+
+        const auto verb = line.substr(zero, space);
+        const auto rest = line.substr(add1(space));
+        if (verb == "electrum")
+        {
+            out.push_back({ transport::electrum, {}, rest });
+        }
+        else if (verb == "ws")
+        {
+            out.push_back({ transport::websocket, {}, rest });
+        }
+        else if (verb == "get")
+        {
+            out.push_back({ transport::http, rest, {} });
+        }
+        else if (verb == "post")
+        {
+            const auto split = rest.find(' ');
+            if (split == std::string::npos)
+                return {};
+
+            out.push_back({ transport::http, rest.substr(zero, split),
+                rest.substr(add1(split)) });
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    return out;
+}
+
+} // namespace load
+} // namespace server
+} // namespace libbitcoin